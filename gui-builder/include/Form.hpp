@@ -68,11 +68,13 @@ public:
     TGUI_NODISCARD bool hasFocus() const;
     void load();
     void save();
+    void exportBinary(const tgui::String& filename);
     TGUI_NODISCARD std::stringstream saveState();
     void loadState(std::stringstream& state);
     void updateAlignmentLines();
 
 private:
+    TGUI_NODISCARD std::unique_ptr<tgui::DataIO::Node> createNodeTreeForFile(const tgui::String& filename) const;
     void importLoadedWidgets(const tgui::Container::Ptr& parent);
     void onSelectionSquarePress(const tgui::Button::Ptr& square, tgui::Vector2f pos);
     TGUI_NODISCARD tgui::Widget::Ptr getWidgetBelowMouse(const tgui::Container::Ptr& parent, tgui::Vector2f pos);
@@ -163,6 +163,7 @@ private:
     void menuBarCallbackLoadForm();
     void menuBarCallbackLoadRecent(const tgui::String& filename);
     void menuBarCallbackSaveFile();
+    void menuBarCallbackExportBinary();
     void menuBarCallbackQuit();
     void menuBarCallbackEditThemes();
     void menuBarCallbackBringWidgetToFront();
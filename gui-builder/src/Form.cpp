@@ -906,11 +906,8 @@ void Form::load()
     if (!fileContents)
         throw tgui::Exception("Failed to open '" + filename + "'.");
 
-    /// TODO: Optimize this (DataIO::parse function should be able to use a string view directly on file contents)
-    std::stringstream inStream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-
     // Parse the file from memory
-    auto rootNode = tgui::DataIO::parse(inStream);
+    auto rootNode = tgui::DataIO::parse(tgui::CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
     // If the file was created with TGUI 0.8 then convert it into a valid TGUI 0.9/0.10 form
     importOldForm(rootNode);
@@ -934,12 +931,43 @@ void Form::save()
 {
     setChanged(false);
 
+    // Recreate the file in memory
+    const auto rootNode = createNodeTreeForFile(getFilename());
+    std::stringstream outStream;
+    tgui::DataIO::emit(rootNode, outStream);
+
+    // Write the file to disk
+    const tgui::String filename = (tgui::getResourcePath() / getFilename()).asString();
+    if (!tgui::writeFile(filename, outStream))
+        throw tgui::Exception("Failed to write to '" + filename + "'.");
+
+    m_guiBuilder->formSaved(getFilename());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void Form::exportBinary(const tgui::String& filename)
+{
+    // Paths are made relative to the exported file, so that it can be loaded in the same way as the text form
+    const auto rootNode = createNodeTreeForFile(filename);
+    std::stringstream outStream;
+    tgui::DataIO::emitBinary(rootNode, outStream);
+
+    const tgui::String fullFilename = (tgui::getResourcePath() / filename).asString();
+    if (!tgui::writeFile(fullFilename, outStream, true))
+        throw tgui::Exception("Failed to write to '" + fullFilename + "'.");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<tgui::DataIO::Node> Form::createNodeTreeForFile(const tgui::String& filename) const
+{
     // Save the output file to memory so that it can be edited
     std::stringstream originalOutStream;
     m_widgetsContainer->saveWidgetsToStream(originalOutStream);
     auto rootNode = tgui::DataIO::parse(originalOutStream);
 
-    tgui::String formPath = (tgui::getResourcePath() / getFilename()).getParentPath().asString();
+    tgui::String formPath = (tgui::getResourcePath() / filename).getParentPath().asString();
     if (formPath.back() != '/')
         formPath.push_back('/');
 
@@ -949,17 +977,7 @@ void Form::save()
 
     // Turn all paths into relative paths
     makePathsRelative(rootNode, formPath, guiBuilderPath);
-
-    // Recreate the changed file in memory
-    std::stringstream outStream;
-    tgui::DataIO::emit(rootNode, outStream);
-
-    // Write the file to disk
-    const tgui::String filename = (tgui::getResourcePath() / getFilename()).asString();
-    if (!tgui::writeFile(filename, outStream))
-        throw tgui::Exception("Failed to write to '" + filename + "'.");
-
-    m_guiBuilder->formSaved(getFilename());
+    return rootNode;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,9 +576,7 @@ bool GuiBuilder::loadGuiBuilderState()
     if (!fileContents)
         return false;
 
-    /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-    std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-    const auto node = tgui::DataIO::parse(stream);
+    const auto node = tgui::DataIO::parse(tgui::CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
     if (node->propertyValuePairs["RecentFiles"])
     {
@@ -1002,6 +1000,7 @@ void GuiBuilder::loadEditingScreen(const tgui::String& filename)
     m_menuBar->connectMenuItem({"File", "New"}, [this]{ menuBarCallbackNewForm(); });
     m_menuBar->connectMenuItem({"File", "Load"}, [this]{ menuBarCallbackLoadForm(); });
     m_menuBar->connectMenuItem({"File", "Save"}, [this]{ menuBarCallbackSaveFile(); });
+    m_menuBar->connectMenuItem({"File", "Export binary"}, [this]{ menuBarCallbackExportBinary(); });
     m_menuBar->connectMenuItem({"File", "Quit"}, [this]{ menuBarCallbackQuit(); });
     m_menuBar->connectMenuItem({"Themes", "Edit"}, [this]{ menuBarCallbackEditThemes(); });
     m_menuBar->connectMenuItem({"Widget", "Bring to front"}, [this]{ menuBarCallbackBringWidgetToFront(); });
@@ -1827,15 +1826,13 @@ void GuiBuilder::addPropertyValueLayout(const tgui::String& property, const tgui
     assert(property == U"Left" || property == U"Top" || property.ends_with(U"Width") || property.ends_with(U"Height"));
     const bool isHorizontal = (property == U"Left") || (property.ends_with(U"Width"));
 
+    // The layout is a percentage when the value only consists of a number followed by a percent sign
+    float percentage = 0;
+    const tgui::String trimmedValue = value.trim();
     const bool layoutIsConstant = layout.isConstant();
     const bool layoutIsPercentage = !layoutIsConstant
-        && value.ends_with(U'%')
-        && layout.getLeftOperand()
-        && layout.getRightOperand()
-        && layout.getLeftOperand()->isConstant()
-        && !layout.getRightOperand()->isConstant()
-        && !layout.getRightOperand()->getLeftOperand()
-        && !layout.getRightOperand()->getRightOperand();
+        && trimmedValue.ends_with(U'%')
+        && trimmedValue.substr(0, trimmedValue.length() - 1).attemptToFloat(percentage);
 
     if (layoutIsConstant || layoutIsPercentage)
         addPropertyValueEditBox(property, value, onChange, topPosition, EDIT_BOX_HEIGHT - 1);
@@ -1863,7 +1860,7 @@ void GuiBuilder::addPropertyValueLayout(const tgui::String& property, const tgui
     }
     else if (layoutIsPercentage)
     {
-        const float ratio = layout.getLeftOperand()->getValue();
+        const float ratio = percentage / 100;
 
         auto buttonAbs = addPropertyValueButtonLayoutRelAbs(property, topPosition, false);
         buttonAbs->onPress([this,isHorizontal,ratio,onChange]{
@@ -2643,6 +2640,17 @@ void GuiBuilder::menuBarCallbackSaveFile()
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void GuiBuilder::menuBarCallbackExportBinary()
+{
+    const tgui::Filesystem::Path formPath{m_selectedForm->getFilename()};
+    const tgui::String defaultFilename = formPath.getFilename() + ".bin";
+    showLoadFileWindow("Export binary form", "Export", true, false, defaultFilename, [this](const tgui::String& filename){
+        m_selectedForm->exportBinary(filename);
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void GuiBuilder::menuBarCallbackQuit()
 {
     saveGuiBuilderState();
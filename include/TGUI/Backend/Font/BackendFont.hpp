@@ -31,7 +31,11 @@
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <array>
     #include <cstdint>
+    #include <memory>
+    #include <unordered_map>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,6 +150,36 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal advance of a glyph
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Reference character size
+        /// @param bold           Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Same value as getGlyph(codePoint, characterSize, bold).advance
+        ///
+        /// The advances of the characters in the Basic Latin and Latin-1 Supplement blocks are stored in a table for each
+        /// character size and style, so that measuring text doesn't have to look up the glyph of each character.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getAdvance(char32_t codePoint, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset of two glyphs, using a table when both characters are printable ASCII characters
+        ///
+        /// @param first         Unicode code point of the first character
+        /// @param second        Unicode code point of the second character
+        /// @param characterSize Size of the characters
+        /// @param bold          Are the glyphs bold or regular?
+        ///
+        /// @return Same value as getKerning(first, second, characterSize, bold)
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getCachedKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
@@ -216,6 +250,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual std::shared_ptr<BackendTexture> getTexture(unsigned int characterSize, unsigned int& textureVersion) = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the textures that are used to store glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param textureIndex   Index of the texture, as found in the textureIndex member of the glyphs
+        /// @param textureVersion Counter that is incremented each time the texture is changed, returned by this function
+        ///
+        /// Fonts that need more than one texture for a character size can override this function. All textures of a character
+        /// size have the size that is returned by getTextureSize. The default implementation returns the texture from
+        /// getTexture for index 0 and a nullptr for any other index.
+        ///
+        /// @return Texture to render the glyphs with the given texture index with
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::shared_ptr<BackendTexture> getTextureAtIndex(unsigned int characterSize, unsigned int textureIndex, unsigned int& textureVersion);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the texture that is used to store glyphs of the given character size
         ///
@@ -262,6 +311,39 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD float getFontScale() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the memory used by the glyph textures and the amount of data uploaded to them
+        ///
+        /// @return Statistics of the glyph cache. The default implementation only returns zeros.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual FontGlyphCacheStatistics getGlyphCacheStatistics() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the glyphs of a range of characters in advance, so that they don't need to be loaded while drawing text
+        ///
+        /// @param firstCodePoint  First character of the range to load
+        /// @param lastCodePoint   Last character of the range to load (inclusive)
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /// Characters that don't exist in the font are skipped. The default implementation loads the glyphs immediately,
+        /// font backends may load them in the background instead (see isPreloadingGlyphs).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void preloadGlyphs(char32_t firstCodePoint, char32_t lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs requested with preloadGlyphs are still being loaded in the background
+        ///
+        /// @return Are there preloaded glyphs that haven't been added to the font texture yet?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool isPreloadingGlyphs() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Called after each frame that the gui drew, so that glyphs which are no longer used can be released
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void frameDrawn();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -279,11 +361,43 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::uint64_t constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets the advances and kernings that were stored by getAdvance and getCachedKerning
+        ///
+        /// Font backends have to call this function when the metrics of their glyphs change, e.g. when a new font is loaded.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearMetricsTables();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Advances and kernings of a single character size and style. Values are NaN until they are first requested.
+        struct MetricsTable
+        {
+            static constexpr char32_t AdvanceCount = 0x100; // Basic Latin and Latin-1 Supplement
+            static constexpr char32_t KerningFirst = 0x20; // Kernings are stored between characters in range [0x20, 0x80)
+            static constexpr char32_t KerningCount = 0x80 - KerningFirst;
+
+            std::array<float, AdvanceCount> advances;
+            std::array<float, KerningCount * KerningCount> kernings;
+        };
+
+        // Returns the table for the given character size and style, creating it if it didn't exist yet
+        TGUI_NODISCARD MetricsTable& getMetricsTable(unsigned int characterSize, bool bold);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         bool m_isSmooth = true;
         float m_fontScale = 1;
+
+    private:
+
+        std::unordered_map<unsigned int, std::unique_ptr<MetricsTable>> m_metricsTables;
+        MetricsTable* m_lastMetricsTable = nullptr;
+        unsigned int m_lastMetricsTableKey = 0;
     };
 }
 
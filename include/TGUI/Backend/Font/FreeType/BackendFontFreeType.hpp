@@ -32,6 +32,10 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_map>
+    #include <vector>
+    #include <thread>
+    #include <atomic>
+    #include <mutex>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,11 +52,23 @@ TGUI_MODULE_EXPORT namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Font implementations that uses FreeType directly to load glyphs
+    ///
+    /// All fonts share a single FreeType library object. Fonts that are loaded from identical data (e.g. the same file being
+    /// loaded multiple times) also share the font face and the textures containing their glyphs.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API BackendFontFreetype : public BackendFont
     {
     public:
 
+        // Don't allow copying, the font data would have to be registered again
+        BackendFontFreetype(const BackendFontFreetype&) = delete;
+        BackendFontFreetype& operator=(const BackendFontFreetype&) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendFontFreetype() = default;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Destructor that cleans up the FreeType resources
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +195,17 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::shared_ptr<BackendTexture> getTexture(unsigned int characterSize, unsigned int& textureVersion) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns one of the textures that are used to store glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters that should be part of the texture
+        /// @param textureIndex   Index of the texture, as found in the textureIndex member of the glyphs
+        /// @param textureVersion Counter that is incremented each time the texture is changed, returned by this function
+        ///
+        /// @return Texture to render the glyphs with the given texture index with, or nullptr if the index is out of range
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getTextureAtIndex(unsigned int characterSize, unsigned int textureIndex, unsigned int& textureVersion) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the texture that is used to store glyphs of the given character size
         ///
@@ -208,6 +235,119 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setFontScale(float scale) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of glyph texture memory that a character size may use before its glyphs are cleared
+        ///
+        /// @param size  Width and height of a texture, the character size may use as many pixels as a texture of this size
+        ///
+        /// Glyphs of each character size are stored in their own fixed-size textures. The size of these textures depends on
+        /// the character size and is never larger than this maximum (unless a single glyph wouldn't fit). When a texture is
+        /// full, another texture is added instead of resizing the existing ones. When the textures of a character size
+        /// together contain more pixels than a texture of the maximum size at the end of a frame, all its glyphs are removed
+        /// and only the glyphs that are still being drawn will be added again. If all glyphs are needed within a single
+        /// frame then the character size is allowed to keep using more textures.
+        ///
+        /// Fonts that were loaded from the same data share their textures, this setting is applied to all of them.
+        ///
+        /// The default maximum page size is 1024.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaximumPageSize(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of glyph texture memory that a character size may use before its glyphs are cleared
+        ///
+        /// @return Width and height of a texture, the character size may use as many pixels as a texture of this size
+        ///
+        /// @see setMaximumPageSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMaximumPageSize() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes after how many frames the glyphs of a character size are removed when no text uses that size
+        ///
+        /// @param frames  Amount of frames in which the character size wasn't used, or 0 to never remove the glyphs
+        ///
+        /// This releases the memory of character sizes that were only used temporarily, e.g. when the text size is animated.
+        ///
+        /// Fonts that were loaded from the same data share their textures, this setting is applied to all of them.
+        ///
+        /// The default eviction delay is 600 frames.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEvictionDelay(unsigned int frames);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns after how many frames the glyphs of a character size are removed when no text uses that size
+        ///
+        /// @return Amount of frames in which the character size wasn't used, or 0 if glyphs are never removed
+        ///
+        /// @see setEvictionDelay
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getEvictionDelay() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are stored as signed distance fields
+        ///
+        /// @param enabled  Should glyphs be rendered from a distance field?
+        ///
+        /// Normally every character size has its own glyphs, rasterized at exactly that size. When distance fields are enabled,
+        /// each glyph is only rasterized once and stored as the distance to its edge. Texts of all sizes then share the same
+        /// glyphs, and text remains sharp when it is scaled or its size is animated. Small texts do look slightly less crisp
+        /// than with normal glyphs, because hinting is applied at the fixed size at which the glyphs are rasterized.
+        ///
+        /// Distance fields are only used if the renderer supports them (see BackendRenderer::supportsDistanceFieldTextures),
+        /// which is currently the case for the OpenGL3 and GLES2 renderers. Normal glyphs are used otherwise.
+        ///
+        /// Distance fields are disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are stored as signed distance fields
+        ///
+        /// @return Are glyphs rendered from a distance field when the renderer supports it?
+        ///
+        /// @see setDistanceFieldEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the memory used by the glyph textures and the amount of data uploaded to them
+        ///
+        /// @return Statistics of the glyph cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FontGlyphCacheStatistics getGlyphCacheStatistics() const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the glyphs of a range of characters in advance, so that they don't need to be loaded while drawing text
+        ///
+        /// @param firstCodePoint  First character of the range to load
+        /// @param lastCodePoint   Last character of the range to load (inclusive)
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /// The glyphs are rasterized on background threads, each with their own FreeType face. The results are added to the
+        /// font textures at the end of the following frames (when frameDrawn is called), so the texts that are drawn in the
+        /// mean time simply load the glyphs they need themselves. Characters that don't exist in the font are skipped.
+        ///
+        /// Preloaded glyphs are kept until their character size is drawn. Afterwards they are removed again when their character
+        /// size isn't drawn for a while (see setEvictionDelay).
+        /// When distance fields are used, the glyphs are only rasterized once for all character sizes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(char32_t firstCodePoint, char32_t lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold = false) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs requested with preloadGlyphs are still being loaded in the background
+        ///
+        /// @return Are there preloaded glyphs that haven't been added to the font texture yet?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPreloadingGlyphs() const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Called after each frame that the gui drew, so that glyphs which are no longer used can be released
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void frameDrawn() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -218,12 +358,118 @@ TGUI_MODULE_EXPORT namespace tgui
             float     rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
             FloatRect bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
+            unsigned int textureIndex = 0; //!< Index of the texture in the page that contains the glyph
+        };
+
+        struct Row
+        {
+            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
+
+            unsigned int width;  //!< Current width of the row
+            unsigned int top;    //!< Y position of the row into the texture
+            unsigned int height; //!< Height of the row
+        };
+
+        struct PageTexture
+        {
+            std::vector<Row> rows;
+            unsigned int nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
+
+            std::unique_ptr<std::uint8_t[]> pixels;
+            std::shared_ptr<BackendTexture> texture;
+            UIntRect dirtyRect; //!< Part of the pixels that changed since they were last uploaded to the texture
+        };
+
+        struct Page
+        {
+            std::unordered_map<std::uint64_t, Glyph> glyphs;
+            std::vector<PageTexture> textures; //!< Textures of the same size, a new one is added when the others are full
+            unsigned int textureSize = 0;
+            unsigned int textureVersion = 0;
+            unsigned int glyphCharacterSize = 0; //!< Character size at which the glyphs in this page are rasterized
+            unsigned int requiredTextureSize = 0; //!< Size needed to fit a glyph that was too large for the textures of the page
+            bool distanceField = false; //!< Whether the glyphs are stored as signed distance fields
+
+            std::size_t maximumPixels = 0;  //!< Amount of pixels in the textures above which the page is cleared at the end of the frame
+            std::uint64_t lastUsedFrame = 0;
+            std::uint64_t lastClearedFrame = 0;
+            bool preloaded = false; //!< Whether glyphs were preloaded in the page and the page wasn't used since
+        };
+
+        // Glyph that was rasterized by freetype but hasn't been placed in a texture yet
+        struct RasterizedGlyph
+        {
+            Glyph glyph; //!< Glyph without texture coordinates
+            unsigned int width = 0;
+            unsigned int height = 0;
+            std::vector<std::uint8_t> pixels; //!< Alpha values of the glyph
+        };
+
+        // Glyph that was rasterized on a background thread and still has to be added to its page
+        struct PreloadedGlyph
+        {
+            unsigned int pageKey = 0;
+            bool distanceField = false;
+            unsigned int glyphCharacterSize = 0;
+            char32_t codePoint = 0;
+            bool bold = false;
+            RasterizedGlyph rasterizedGlyph;
+        };
+
+        // Everything that is shared between fonts that were loaded from identical data
+        struct FaceData
+        {
+            FaceData() = default;
+            FaceData(const FaceData&) = delete;
+            FaceData& operator=(const FaceData&) = delete;
+            ~FaceData();
+
+            FT_Library  library = nullptr;  //!< Handle to the freetype library, shared by all fonts
+            FT_Face     face    = nullptr;  //!< Contains the font (typeface and style)
+            FT_Stroker  stroker = nullptr;  //!< Used for rendering outlines
+
+            std::unique_ptr<std::uint8_t[]> fileContents;
+            std::size_t fileSize = 0;
+            std::uint64_t fileHash = 0;
+
+            std::unordered_map<unsigned int, float> cachedLineSpacing;
+            std::unordered_map<unsigned int, float> cachedFontHeights;
+            std::unordered_map<unsigned int, float> cachedAscents;
+            std::unordered_map<unsigned int, float> cachedDescents;
+
+            std::unordered_map<unsigned int, Page> pages; //!< Glyphs are stored in a separate page per (scaled) character size
+            unsigned int textureVersion = 0; //!< Last version given to a page, versions are unique so that texts notice a page change
+            unsigned int maximumPageSize = 1024;
+            unsigned int evictionDelay = 600;
+            std::uint64_t frameCounter = 0;
+            FontGlyphCacheStatistics statistics;
+
+            unsigned int fontCount = 0;       //!< Amount of BackendFontFreetype objects that use this data
+            unsigned int frameDrawnCalls = 0; //!< Amount of fonts that already received the frameDrawn call in the current frame
+
+            std::vector<std::thread> preloadThreads;
+            std::atomic<bool> cancelPreloading{false};
+            std::atomic<unsigned int> runningPreloadThreads{0};
+            std::mutex preloadMutex; //!< Protects preloadedGlyphs
+            std::vector<PreloadedGlyph> preloadedGlyphs; //!< Glyphs that were rasterized by the preload threads
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Loads a glyph with freetype
+        // Loads a glyph with freetype. The character size and outline thickness are already multiplied with the font scale.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
+        TGUI_NODISCARD Glyph loadGlyph(Page& page, char32_t codePoint, unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Renders a glyph to a bitmap. This function only uses the freetype objects that are passed to it, so that it can be
+        // called from any thread that has its own face.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static RasterizedGlyph rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint,
+                                                             unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness, bool distanceField);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies a rasterized glyph into the texture of the page and returns the glyph with its texture coordinates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph addGlyphToPage(Page& page, const RasterizedGlyph& rasterizedGlyph);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns a cached glyph or calls loadGlyph to load it when this is the first time the glyph is requested
@@ -231,50 +477,78 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reserves space in the texture to place the glyph
+        // Reserves space in one of the textures of the page to place the glyph. A new texture is added when the existing ones
+        // are full. An empty rectangle is returned if the glyph is larger than the textures of the page.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        TGUI_NODISCARD UIntRect findAvailableGlyphRect(Page& page, unsigned int width, unsigned int height, unsigned int& textureIndex);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Sets the character size on which the freetype operations are performed
+        // Returns the page that contains the glyphs of the given character size (already multiplied with the font scale).
+        // Smooth and non-smooth glyphs are stored in different pages, while distance field glyphs of all sizes share a single page.
+        // The page is created if it doesn't exist yet.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool setCurrentSize(unsigned int characterSize);
+        TGUI_NODISCARD Page& getPage(unsigned int scaledCharacterSize);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Destroys freetype resources
+        // Returns the key under which the page of the given character size (already multiplied with the font scale) is stored
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void cleanup();
+        TGUI_NODISCARD unsigned int getPageKey(unsigned int scaledCharacterSize, bool distanceField) const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    protected:
+        // Returns the page that is stored with the given key, creating it if it doesn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Page& getPageWithKey(unsigned int pageKey, bool distanceField);
 
-        struct Row
-        {
-            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether distance fields are enabled and supported by the renderer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldUsed() const;
 
-            unsigned int width;  //!< Current width of the row
-            unsigned int top;    //!< Y position of the row into the texture
-            unsigned int height; //!< Height of the row
-        };
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all glyphs from the page and gives it a single empty texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearPage(Page& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an empty texture to the page, with a white square in the top left corner that can be used to draw lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addPageTexture(Page& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the character size (already multiplied with the font scale) on which the freetype operations are performed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool setCurrentSize(FT_Face face, unsigned int scaledCharacterSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the glyphs that were rasterized by the preload threads to their pages and joins the threads once they finished
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mergePreloadedGlyphs();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Function that runs on a preload thread. It rasterizes every stride-th code point starting at firstCodePoint + offset,
+        // for each of the requested glyph sizes. The face data is kept alive until the thread is joined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void preloadGlyphsThread(FaceData* data, std::vector<PreloadedGlyph> glyphSizes, char32_t firstCodePoint,
+                                        char32_t lastCodePoint, unsigned int offset, unsigned int stride);
 
-        FT_Library  m_library = nullptr;  // Handle to the freetype library
-        FT_Face     m_face    = nullptr;  // Contains the font (typeface and style)
-        FT_Stroker  m_stroker = nullptr;  // Used for rendering outlines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops using the font data, which destroys the freetype resources if no other font uses them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cleanup();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the data of all loaded fonts, stored by the hash of their file contents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unordered_map<std::uint64_t, std::vector<std::weak_ptr<FaceData>>>& getLoadedFaces();
 
-        std::unordered_map<unsigned int, float> m_cachedLineSpacing;
-        std::unordered_map<unsigned int, float> m_cachedFontHeights;
-        std::unordered_map<unsigned int, float> m_cachedAscents;
-        std::unordered_map<unsigned int, float> m_cachedDescents;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
 
-        std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        std::shared_ptr<FaceData> m_data; // Face and glyphs, possibly shared with other fonts
 
-        std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
-        unsigned int m_textureVersion = 0;
+        unsigned int m_maximumPageSize = 1024;
+        unsigned int m_evictionDelay = 600;
+        bool m_distanceFieldEnabled = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,12 @@
 #include <TGUI/Outline.hpp>
 #include <TGUI/RenderStates.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <list>
+    #include <functional>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -244,9 +250,134 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD Vector2f getPixelsPerPoint() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws to a texture instead of to the screen
+        ///
+        /// @param texture      Texture to draw to. A new texture is created when it is a nullptr or when its size is different.
+        /// @param textureSize  Size of the texture in pixels
+        /// @param area         Part of the coordinate system of the draw function that will be visible in the texture
+        /// @param drawFunc     Function that draws the contents of the texture, which receives this render target as parameter
+        ///
+        /// @return True if the contents were drawn to the texture, false if the render target doesn't support this
+        ///
+        /// This function may only be called while the gui is being drawn. The texture is cleared to transparent before
+        /// calling the draw function and contains premultiplied alpha afterwards (see BackendTexture::setPremultipliedAlpha).
+        /// It is used by containers that cache their child widgets (see Container::setCachedAsTexture).
+        ///
+        /// The default implementation returns false. Only the OpenGL3, GLES2 and SDL_Renderer render targets support it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool drawToTexture(std::shared_ptr<BackendTexture>& texture, Vector2u textureSize, FloatRect area,
+                                   const std::function<void(BackendRenderTarget&, const RenderStates&)>& drawFunc);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the render target may change the order in which primitives are drawn
+        ///
+        /// @param enabled  Should non-overlapping primitives be reordered so that draws with the same texture become adjacent?
+        ///
+        /// When enabled, the primitives of an entire frame are recorded first. Primitives that don't overlap with any primitive
+        /// that was drawn in between are then moved next to an earlier primitive with the same texture and clipping, so that
+        /// they can be rendered with a single draw call. Overlapping primitives are always drawn in their original order.
+        ///
+        /// This option is currently only used by the OpenGL3 and GLES2 render targets, other render targets ignore it.
+        /// Reordering is disabled by default.
+        ///
+        /// @see BackendGui::setDrawCallReorderingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawCallReorderingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target may change the order in which primitives are drawn
+        ///
+        /// @return Are non-overlapping primitives reordered to reduce the amount of texture and clipping changes?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDrawCallReorderingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many texture or clipping changes were avoided by reordering primitives during the last frame
+        ///
+        /// @return Amount of draw calls that were saved by reordering, or 0 if reordering is disabled or unsupported
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getStateChangesRemovedByReordering() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Primitive that was recorded by a render target to be drawn at the end of the frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct RecordedDrawCall
+        {
+            std::shared_ptr<BackendTexture> texture;
+            FloatRect clipViewport; // Part of the window in which the primitive is visible (in pixels)
+            FloatRect bounds; // Bounding rectangle of the primitive (in view coordinates)
+            std::size_t firstIndex = 0;
+            std::size_t indexCount = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reorders recorded draw calls so that primitives with the same texture and clipping are drawn together
+        ///
+        /// @param drawCalls  Primitives in the order in which they were drawn
+        /// @param indices    Indices that are referenced by the draw calls, will be rearranged to match the returned draw calls
+        ///
+        /// @return Merged draw calls that should be drawn in the returned order
+        ///
+        /// A primitive is only moved in front of other primitives when it doesn't overlap with any of them.
+        /// This function also updates the value returned by getStateChangesRemovedByReordering.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<RecordedDrawCall> reorderDrawCalls(const std::vector<RecordedDrawCall>& drawCalls, std::vector<unsigned int>& indices);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parameters that uniquely define the geometry of a circle or rounded rectangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ShapeGeometryKey
+        {
+            enum class Type
+            {
+                Circle,
+                RoundedRectangle
+            };
+
+            Type type = Type::Circle;
+            Vector2f size;
+            float radius = 0;
+            float borderThickness = 0;
+            Color backgroundColor;
+            Color borderColor;
+
+            TGUI_NODISCARD bool operator==(const ShapeGeometryKey& other) const;
+        };
+
+        struct ShapeGeometryKeyHash
+        {
+            TGUI_NODISCARD std::size_t operator()(const ShapeGeometryKey& key) const;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Vertices and indices of a shape, including its borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ShapeGeometry
+        {
+            std::vector<Vertex> vertices;
+            std::vector<unsigned int> indices;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the geometry of a circle or rounded rectangle, only generating it when it wasn't drawn before
+        ///
+        /// @param key  Parameters of the shape
+        ///
+        /// @return Vertices and indices that can be passed to drawVertexArray
+        ///
+        /// The geometry of these shapes requires trigonometric functions to calculate, so it is retained between frames.
+        /// Widgets that don't change their size, borders or colors will thus only submit the cached vertices each frame.
+        /// When more than MaxCachedShapeGeometries shapes are stored, the one that was used least recently is removed.
+        /// Empty geometry is returned for shapes with NaN parameters.
+        ///
+        /// The returned reference remains valid until the next call to this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const ShapeGeometry& getCachedShapeGeometry(const ShapeGeometryKey& key);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -266,6 +397,13 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
         Vector2f m_pixelsPerPoint = {1, 1};
+
+        bool m_drawCallReorderingEnabled = false;
+        std::size_t m_stateChangesRemovedByReordering = 0;
+
+        static constexpr std::size_t MaxCachedShapeGeometries = 512;
+        std::list<std::pair<ShapeGeometryKey, ShapeGeometry>> m_shapeGeometryCache; // Most recently used shape is at the front
+        std::unordered_map<ShapeGeometryKey, std::list<std::pair<ShapeGeometryKey, ShapeGeometry>>::iterator, ShapeGeometryKeyHash> m_shapeGeometryLookup;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
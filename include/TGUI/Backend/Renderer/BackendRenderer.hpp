@@ -72,6 +72,18 @@ TGUI_MODULE_EXPORT namespace tgui
         /// This maximum size is defined by the graphics driver. Most likely this will return 8192 or 16384.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual unsigned int getMaximumTextureSize() = 0;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render targets of this renderer can draw textures that contain a distance field
+        ///
+        /// @return Are textures for which BackendTexture::setDistanceField was called rendered correctly?
+        ///
+        /// Fonts only store their glyphs as distance fields when this function returns true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool supportsDistanceFieldTextures()
+        {
+            return false;
+        }
     };
 }
 
@@ -198,8 +198,8 @@ TGUI_MODULE_EXPORT namespace tgui
         TextStyles m_style = TextStyle::Regular;
 
         Vector2f m_size;
-        std::shared_ptr<std::vector<Vertex>> m_vertices;
-        std::shared_ptr<std::vector<Vertex>> m_outlineVertices;
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_vertices; // Vertices per font texture, indexed by the texture index of the glyphs
+        std::vector<std::shared_ptr<std::vector<Vertex>>> m_outlineVertices;
         bool m_verticesNeedUpdate = true;
     };
 }
@@ -79,6 +79,31 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture, without uploading the rest of the texture again
+        ///
+        /// @param area    Part of the texture to update, which has to lie inside the texture
+        /// @param pixels  Pointer to array of area.width*area.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the texture doesn't support being partially updated
+        ///
+        /// The pixels that are returned by getPixels are not changed by this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateTexturePart(UIntRect area, const std::uint8_t* pixels);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture, including the pixels that are returned by getPixels
+        ///
+        /// @param area    Part of the texture to update, which has to lie inside the texture
+        /// @param pixels  Pointer to array of area.width*area.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if updating failed
+        ///
+        /// This function can only be called on textures that store their pixels, i.e. that were created with the load function.
+        /// Only the changed part is uploaded if the texture supports updateTexturePart, otherwise the entire texture is reloaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updatePixels(UIntRect area, const std::uint8_t* pixels);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -99,6 +124,40 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isSmooth() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the color channels of the pixels are already multiplied with their alpha channel
+        ///
+        /// @param premultiplied  Are the pixels stored with premultiplied alpha?
+        ///
+        /// Textures that are the result of BackendRenderTarget::drawToTexture contain premultiplied alpha and need a different
+        /// blend mode when being drawn. Loaded images aren't premultiplied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void setPremultipliedAlpha(bool premultiplied);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the color channels of the pixels are already multiplied with their alpha channel
+        ///
+        /// @return Are the pixels stored with premultiplied alpha?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPremultipliedAlpha() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the alpha channel contains a signed distance field instead of the coverage of each pixel
+        ///
+        /// @param distanceField  Does the alpha channel store the distance to the edge of the shape?
+        ///
+        /// A value of 0.5 in the alpha channel lies on the edge, higher values are inside the shape. Render targets that support
+        /// distance fields (see BackendRenderer::supportsDistanceFieldTextures) reconstruct sharp edges at any scale.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceField(bool distanceField);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the alpha channel contains a signed distance field instead of the coverage of each pixel
+        ///
+        /// @return Does the alpha channel store the distance to the edge of the shape?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceField() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks if a certain pixel is transparent
         ///
@@ -121,6 +180,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
         bool m_isSmooth = true;
+        bool m_premultipliedAlpha = false;
+        bool m_distanceField = false;
     };
 }
 
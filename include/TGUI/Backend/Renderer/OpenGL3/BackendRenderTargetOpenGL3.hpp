@@ -95,6 +95,58 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw calls are batched together
+        ///
+        /// @param enabled  Should consecutive draws with the same texture and clipping be merged into a single draw call?
+        ///
+        /// When batching is enabled, the vertices passed to drawVertexArray are transformed on the CPU and collected in a single
+        /// vertex and index buffer. The batch is only submitted to OpenGL when the texture or clipping changes or when drawGui
+        /// finishes, which drastically reduces the amount of draw calls for screens with many widgets.
+        ///
+        /// Batching is disabled by default. Changes only take effect in the next call to drawGui. Batching is always used when
+        /// draw call reordering is enabled (see setDrawCallReorderingEnabled).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw calls are batched together
+        ///
+        /// @return Are consecutive draws with the same texture and clipping merged into a single draw call?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of OpenGL draw calls that were made during the last call to drawGui
+        ///
+        /// @return Number of draw calls in the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getDrawCallCount() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Submits all batched vertices to OpenGL
+        ///
+        /// This function is called automatically when needed, but it has to be called manually before making OpenGL calls
+        /// in the middle of drawing the gui (e.g. from within the draw function of a custom widget).
+        /// When draw call reordering is enabled, the primitives that were recorded so far are reordered and drawn first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws to a texture instead of to the screen
+        ///
+        /// @param texture      Texture to draw to. A new texture is created when it is a nullptr or when its size is different.
+        /// @param textureSize  Size of the texture in pixels
+        /// @param area         Part of the coordinate system of the draw function that will be visible in the texture
+        /// @param drawFunc     Function that draws the contents of the texture, which receives this render target as parameter
+        ///
+        /// @return True if the contents were drawn to the texture
+        ///
+        /// The texture is attached to a framebuffer object while drawing to it. Calls to this function may be nested.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawToTexture(std::shared_ptr<BackendTexture>& texture, Vector2u textureSize, FloatRect area,
+                           const std::function<void(BackendRenderTarget&, const RenderStates&)>& drawFunc) override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -112,6 +164,37 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture (or the empty texture when nullptr is passed) if it differs from the currently bound one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeTexture(const std::shared_ptr<BackendTexture>& texture);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the batched vertices and indices into the vertex and index buffers, reallocating them when they are too small
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void uploadBatch();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores a primitive in the batch together with its texture and clipping, used when draw call reordering is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recordDrawCall(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                            const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reorders the primitives that were recorded during the frame and draws them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushRecordedDrawCalls();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the scissor rectangle, taking into account that the rows are flipped while drawing to a texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setScissor(const FloatRect& clipViewport);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Selects the blend function based on the current texture and on whether we are drawing to a texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateBlendFunc();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -127,6 +210,24 @@ TGUI_MODULE_EXPORT namespace tgui
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldShaderUniformLocation = -1;
+        bool m_distanceFieldShaderEnabled = false; // Whether the shader currently treats the alpha channel as a distance field
+
+        bool m_batchingEnabled = false;
+        bool m_batchingActive = false; // Whether batching is used during the current frame
+        FloatRect m_clipRect;
+        FloatRect m_clipViewport;
+        std::vector<RecordedDrawCall> m_recordedDrawCalls;
+        std::vector<Vertex> m_batchVertices;
+        std::vector<unsigned int> m_batchIndices;
+        std::size_t m_vertexBufferOffset = 0; // Amount of vertices already stored in the vertex buffer during this frame
+        std::size_t m_indexBufferOffset = 0; // Amount of indices already stored in the index buffer during this frame
+        std::size_t m_drawCallCount = 0;
+        std::size_t m_drawCallCountLastFrame = 0;
+
+        std::vector<unsigned int> m_frameBuffers; // One framebuffer for each nesting level of drawToTexture
+        std::size_t m_textureDrawDepth = 0; // Amount of nested drawToTexture calls that are currently active
+        bool m_premultipliedBlending = false; // Whether the blend function is set for a texture with premultiplied alpha
     };
 }
 
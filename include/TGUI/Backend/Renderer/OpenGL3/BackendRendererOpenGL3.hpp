@@ -90,6 +90,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD unsigned int getMaximumTextureSize() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render targets of this renderer can draw textures that contain a distance field
+        ///
+        /// @return Always true, the shader of the render target supports distance fields
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool supportsDistanceFieldTextures() override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
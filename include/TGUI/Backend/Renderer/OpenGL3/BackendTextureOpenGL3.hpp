@@ -57,6 +57,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture, without uploading the rest of the texture again
+        ///
+        /// @param area    Part of the texture to update, which has to lie inside the texture
+        /// @param pixels  Pointer to array of area.width*area.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the texture wasn't loaded yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTexturePart(UIntRect area, const std::uint8_t* pixels) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
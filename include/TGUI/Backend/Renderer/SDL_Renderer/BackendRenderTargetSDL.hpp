@@ -87,6 +87,19 @@ TGUI_MODULE_EXPORT namespace tgui
         void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws to a texture instead of to the screen
+        ///
+        /// @param texture      Texture to draw to. A new texture is created when it is a nullptr or when its size is different.
+        /// @param textureSize  Size of the texture in pixels
+        /// @param area         Part of the coordinate system of the draw function that will be visible in the texture
+        /// @param drawFunc     Function that draws the contents of the texture, which receives this render target as parameter
+        ///
+        /// @return True if the contents were drawn to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawToTexture(std::shared_ptr<BackendTexture>& texture, Vector2u textureSize, FloatRect area,
+                           const std::function<void(BackendRenderTarget&, const RenderStates&)>& drawFunc) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -69,6 +69,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture, without uploading the rest of the texture again
+        ///
+        /// @param area    Part of the texture to update, which has to lie inside the texture
+        /// @param pixels  Pointer to array of area.width*area.height*4 bytes with RGBA pixels
+        ///
+        /// @return True if the texture was updated, false if the texture wasn't loaded yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTexturePart(UIntRect area, const std::uint8_t* pixels) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
@@ -76,6 +86,15 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setSmooth(bool smooth) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the color channels of the pixels are already multiplied with their alpha channel
+        ///
+        /// @param premultiplied  Are the pixels stored with premultiplied alpha?
+        ///
+        /// This changes the blend mode of the SDL_Texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPremultipliedAlpha(bool premultiplied) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a pointer to the internal SDL_Texture
         /// @return Pointer to internal texture
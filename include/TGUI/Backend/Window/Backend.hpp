@@ -298,6 +298,14 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void setFontBackend(std::shared_ptr<BackendFontFactory> fontBackend);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Informs all fonts that a frame was drawn
+        ///
+        /// This function gets called internally by the gui after drawing. Fonts use it to find glyphs that are no longer used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void frameDrawn();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Informs the backend about the existence of a font object
@@ -334,6 +342,15 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unregisterSvgSprite(Sprite* sprite);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Updates the vertices of all sprites that display an SVG image
+        ///
+        /// This function gets called internally when an SVG image finished rasterizing in the background, so that sprites
+        /// which were still showing an image of a different size can switch to the new texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSvgSprites();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -34,6 +34,10 @@
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <chrono>
     #include <stack>
+    #include <deque>
+    #include <unordered_map>
+    #include <unordered_set>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -457,6 +461,8 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// The file may also be a binary file that was created by saveWidgetsToFile with the binary parameter set to true.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsFromFile(const String& filename, bool replaceExisting = true);
 
@@ -464,10 +470,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Saves the child widgets to a text file
         ///
         /// @param filename  Filename of the widget file
+        /// @param binary    Store the widgets in the binary format of DataIO::emitBinary instead of as text.
+        ///                  Binary files load faster with loadWidgetsFromFile, but they can't be edited by hand.
         ///
         /// @throw Exception when file could not be opened for writing
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToFile(const String& filename);
+        void saveWidgetsToFile(const String& filename, bool binary = false);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
@@ -633,9 +641,171 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isKeyboardNavigationEnabled() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the render target may reorder primitives to reduce the amount of draw calls
+        ///
+        /// @param enabled  Should non-overlapping primitives with the same texture be drawn together?
+        ///
+        /// Widgets are drawn one after another, so a background, some text and an image of one widget are followed by the
+        /// background, text and image of the next widget. Every change of texture requires a separate draw call. When this
+        /// option is enabled, the primitives of a frame are reordered so that primitives with the same texture and clipping
+        /// are drawn together, as long as they don't overlap with anything that was drawn in between.
+        ///
+        /// This option is only supported by the OpenGL3 and GLES2 renderers and is disabled by default.
+        ///
+        /// @see getStateChangesRemovedByReordering
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawCallReorderingEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render target may reorder primitives to reduce the amount of draw calls
+        ///
+        /// @return Are non-overlapping primitives with the same texture drawn together?
+        ///
+        /// @see setDrawCallReorderingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDrawCallReorderingEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many texture or clipping changes were removed by reordering primitives in the last drawn frame
+        ///
+        /// @return Amount of draw calls that were saved by reordering
+        ///
+        /// @see setDrawCallReorderingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getStateChangesRemovedByReordering() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether only the parts of the screen that changed are redrawn by the main loop
+        ///
+        /// @param enabled       Should the main loop only redraw the damaged parts of the screen?
+        /// @param backBufferAge Amount of frames that the contents of the back buffer lag behind when drawing a new frame
+        ///
+        /// Widgets report the area they occupy whenever their appearance may have changed (e.g. when the mouse enters them,
+        /// when they are moved or when their caret blinks). The main loop no longer draws a frame when nothing changed, and
+        /// otherwise only redraws the damaged area, by erasing it with the clear color and drawing the widgets clipped to it.
+        /// Signal handlers and timers can change anything, so the entire screen is redrawn after they are called.
+        ///
+        /// This requires that the contents of the back buffer are still available when drawing the next frame. With a back
+        /// buffer age of 1, the back buffer must contain the previous frame (e.g. EGL_SWAP_BEHAVIOR set to EGL_BUFFER_PRESERVED).
+        /// When swapping between 2 buffers, pass 2 as back buffer age so that the damage of the last 2 frames gets redrawn.
+        /// The clear color must be opaque, otherwise the entire screen is still redrawn every time something changes.
+        ///
+        /// When you have your own main loop instead of calling mainLoop(), you can use isRedrawRequired() to skip frames.
+        /// The draw() function always redraws the entire screen when called directly.
+        ///
+        /// Partial redrawing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled, unsigned int backBufferAge = 1);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether only the parts of the screen that changed are redrawn by the main loop
+        ///
+        /// @return Is partial redrawing enabled?
+        ///
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPartialRedrawEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks a part of the screen as needing to be redrawn
+        ///
+        /// @param region  Damaged area, in the coordinate system of the view
+        ///
+        /// This function only has an effect when partial redrawing is enabled.
+        ///
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRegion(const FloatRect& region);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the entire screen as needing to be redrawn
+        ///
+        /// This function only has an effect when partial redrawing is enabled.
+        ///
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether anything changed since the last time the gui was drawn
+        ///
+        /// @return False when partial redrawing is enabled and no part of the screen was damaged, true otherwise
+        ///
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRedrawRequired() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts that depend on other widgets are updated immediately or only once per frame
+        ///
+        /// @param enabled  Should layout updates be deferred until the next call to updateLayouts()?
+        ///
+        /// Normally, moving or resizing a widget immediately recalculates all layouts that are bound to it, which may resize
+        /// other widgets and recalculate the layouts that are bound to them. A single change (e.g. resizing the window) can
+        /// thereby evaluate the same layouts many times.
+        ///
+        /// When enabled, widgets in this gui only remember which widgets have layouts that depend on them. The updateLayouts
+        /// function then evaluates these widgets in the order of their dependencies, so that each widget is updated only once.
+        /// The gui calls updateLayouts() before handling an event and before drawing. Until then, getPosition() and getSize()
+        /// of dependent widgets still return their old values.
+        ///
+        /// Layout updates are not deferred by default.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDeferredLayoutUpdatesEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts that depend on other widgets are only updated once per frame
+        ///
+        /// @return Are layout updates deferred until the next call to updateLayouts()?
+        ///
+        /// @see setDeferredLayoutUpdatesEnabled
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDeferredLayoutUpdatesEnabled() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the widgets with layouts that depend on widgets that were moved or resized
+        ///
+        /// This function only has an effect when deferred layout updates are enabled. Widgets are updated after all widgets
+        /// that they depend on. If the layouts contain a dependency cycle, a warning is printed with the widgets in the cycle.
+        ///
+        /// @see setDeferredLayoutUpdatesEnabled
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLayouts();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Schedules the layouts of a widget to be recalculated by the next updateLayouts call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestLayoutUpdate(Widget* widget);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Called when a widget is removed from the gui, so that its layouts are no longer updated by the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cancelLayoutUpdate(Widget* widget);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called by the main loop before drawing a frame. Clears the screen when needed and returns false if nothing has to
+        // be drawn. When only part of the screen is damaged, the screen isn't cleared and the next draw() call only redraws
+        // the damaged area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool prepareRedraw(Color clearColor);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Handles the event without keeping track of which part of the screen was damaged by it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processEvent(const Event& event);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Handles the backend-independent part of the two finger scrolling.
         // Returns whether the touch event should be absorbed by the gui.
@@ -685,10 +855,32 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
         bool m_keyboardNavigationEnabled = false; // TGUI_NEXT: Enable by default?
+        bool m_drawCallReorderingEnabled = false;
+
+        bool m_partialRedrawEnabled = false;
+        unsigned int m_backBufferAge = 1;
+        bool m_fullRedrawRequired = true;
+        bool m_partialRedrawPrepared = false;
+        Optional<FloatRect> m_damagedRegion;
+        std::deque<Optional<FloatRect>> m_previousRedrawRegions; // Empty value means that the entire screen was redrawn
 
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
+        // Widgets whose layouts have to be recalculated when layout updates are deferred
+        enum class LayoutUpdateState
+        {
+            Waiting,  // The widget will be updated later during the current updateLayouts call
+            Updating, // The layouts of the widget are currently being recalculated
+            Updated,  // The widget was already updated during the current updateLayouts call
+            Removed   // The widget was removed from the gui during the current updateLayouts call
+        };
+        bool m_deferredLayoutUpdatesEnabled = false;
+        bool m_updatingLayouts = false;
+        std::vector<Widget*> m_pendingLayoutWidgets;
+        std::unordered_set<Widget*> m_pendingLayoutWidgetsSet;
+        std::unordered_map<Widget*, LayoutUpdateState> m_layoutUpdateStates;
+
         std::shared_ptr<BackendRenderTarget> m_backendRenderTarget = nullptr;
     };
 
@@ -197,6 +197,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
         ///
+        /// The file may also be a binary file that was created by saveWidgetsToFile with the binary parameter set to true.
+        ///
         /// @throw Exception when file could not be opened or parsing failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsFromFile(const String& filename, bool replaceExisting = true);
@@ -205,10 +207,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Saves the child widgets to a text file
         ///
         /// @param filename  Filename of the widget file
+        /// @param binary    Store the widgets in the binary format of DataIO::emitBinary instead of as text.
+        ///                  Binary files load faster with loadWidgetsFromFile, but they can't be edited by hand.
         ///
         /// @throw Exception when file could not be opened for writing
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToFile(const String& filename);
+        void saveWidgetsToFile(const String& filename, bool binary = false);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
@@ -442,6 +446,43 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool processTextEnteredEvent(char32_t key);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether the child widgets should be drawn to a texture that is reused in the next frames
+        /// @param cached  Should the child widgets be drawn from a cached texture?
+        ///
+        /// When enabled, the child widgets are only drawn to the screen via a single texture. The texture is only redrawn when
+        /// the geometry that the child widgets would draw changes (e.g. because the text of a label changed or because a button
+        /// is now shown in its hover state) or when the container is resized or drawn at a different scale.
+        /// This can save a lot of draw calls for containers with many widgets that rarely change.
+        ///
+        /// The geometry of the child widgets is still generated every frame to detect changes, only the drawing itself is saved.
+        /// Changes to the contents of a texture that a child widget uses (e.g. drawing to a canvas) aren't detected,
+        /// invalidateTextureCache has to be called in such case.
+        ///
+        /// Rotated or scaled containers are always drawn normally. Caching is only supported by backends that can render to
+        /// a texture (OpenGL3, GLES2 and SDL_Renderer), other backends ignore this setting.
+        ///
+        /// Caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCachedAsTexture(bool cached);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn to a texture that is reused in the next frames
+        /// @return Are the child widgets drawn from a cached texture?
+        /// @see setCachedAsTexture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isCachedAsTexture() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes certain that the cached texture is redrawn the next time the container is drawn
+        ///
+        /// This only needs to be called when a texture that is used by a child widget was altered (e.g. a canvas was redrawn),
+        /// all other changes to the child widgets are detected automatically.
+        ///
+        /// @see setCachedAsTexture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateTextureCache();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Called when one of the child widgets of this container gains focus.
@@ -528,6 +569,13 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Marks the focused widgets (for keyboard events) or the widgets below the mouse and on which the mouse was pressed
+        // (for mouse events) as needing to be redrawn. Used by the gui to find the area that may be changed by an event.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateInteractedWidgets(bool keyboardEvent);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container. You should not call this function yourself.
@@ -592,6 +640,22 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr updateWidgetBelowMouse(Vector2f mousePos);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Invalidates the child widgets that are being interacted with. Returns false if there were no such widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool invalidateInteractedChildWidgets(bool keyboardEvent);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets directly to the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(BackendRenderTarget& target, const RenderStates& states) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets via the cached texture, after updating the texture if needed.
+        // Returns false if the texture can't be used, in which case nothing was drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawFromTextureCache(BackendRenderTarget& target, const RenderStates& states) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +702,13 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        bool m_cachedAsTexture = false;
+        mutable std::shared_ptr<BackendTexture> m_cacheTexture;
+        mutable FloatRect m_cacheArea; // Part of the container that is stored in the cached texture
+        mutable bool m_cacheValid = false;
+        mutable std::uint64_t m_cacheContentsHash = 0; // Hash of everything that the child widgets drew to the cached texture
+        mutable std::unique_ptr<BackendRenderTarget> m_cacheHashTarget; // Render target that calculates the hash without drawing
+
         friend class SubwidgetContainer; // Needs access to save and load functions
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -686,6 +757,23 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void mouseNoLongerOnWidget() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Restricts the next draw calls to a part of the screen, which is first filled with the background color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRedrawRegion(const FloatRect& region, Color backgroundColor);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Makes the next draw calls draw the entire screen again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetRedrawRegion();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateInteractedWidgets(bool keyboardEvent) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all widgets to a render target
         ///
@@ -706,6 +794,10 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Optional<FloatRect> m_redrawRegion;
+        Color m_redrawBackgroundColor;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,7 @@
     #include <string>
     #include <cstddef>
     #include <memory>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +50,21 @@ TGUI_MODULE_EXPORT namespace tgui
         float     advance = 0;  //!< Offset to move horizontally to the next character
         FloatRect bounds;       //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
         UIntRect  textureRect;  //!< Texture coordinates of the glyph inside the font's texture
+        unsigned int textureIndex = 0; //!< Index of the texture that contains the glyph, when a character size needs multiple textures
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Information about the textures in which a font stores its glyphs
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API FontGlyphCacheStatistics
+    {
+        std::size_t   pageCount = 0;      //!< Amount of textures that currently contain glyphs
+        std::size_t   glyphCount = 0;     //!< Amount of glyphs that are currently stored in the textures
+        std::size_t   textureBytes = 0;   //!< Size of the pixel data of all textures, in bytes
+        std::uint64_t uploadedBytes = 0;  //!< Total amount of pixel data that was uploaded to the textures, in bytes
+        std::uint64_t fullUploads = 0;    //!< Amount of times that an entire texture was uploaded
+        std::uint64_t partialUploads = 0; //!< Amount of times that only the changed part of a texture was uploaded
+        std::uint64_t evictedGlyphs = 0;  //!< Amount of glyphs that were removed from the textures because they weren't used
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -151,12 +167,26 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal advance of a glyph
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Reference character size
+        /// @param bold           Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Same value as getGlyph(codePoint, characterSize, bold).advance, but faster for Latin-1 characters
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getAdvance(char32_t codePoint, unsigned int characterSize, bool bold = false) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
         /// The kerning is an extra offset (negative) to apply between two glyphs when rendering them, to make the pair look
         /// more "natural". For example, the pair "AV" have a special kerning to make them closer than other characters.
         /// Most of the glyphs pairs have a kerning offset of zero, though.
+        /// Kernings between printable ASCII characters are cached by the font.
         ///
         /// @param first         Unicode code point of the first character
         /// @param second        Unicode code point of the second character
@@ -207,6 +237,40 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isSmooth() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the memory used by the glyph textures and the amount of data uploaded to them
+        ///
+        /// @return Statistics of the glyph cache, or only zeros if the font backend doesn't keep track of them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD FontGlyphCacheStatistics getGlyphCacheStatistics() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the glyphs of a range of characters in advance, so that they don't need to be loaded while drawing text
+        ///
+        /// @param firstCodePoint  First character of the range to load
+        /// @param lastCodePoint   Last character of the range to load (inclusive)
+        /// @param characterSizes  Text sizes for which the glyphs should be loaded
+        /// @param bold            Load the bold glyphs instead of the regular ones?
+        ///
+        /// This can be used to avoid a stutter when text in a large character set (e.g. CJK) is shown for the first time.
+        /// Characters that don't exist in the font are skipped.
+        ///
+        /// The FreeType font backend rasterizes the glyphs on background threads and adds them to the font texture at the end
+        /// of the frames that are drawn afterwards. Other font backends load the glyphs before this function returns.
+        ///
+        /// @code
+        /// font.preloadGlyphs(U'\u4E00', U'\u9FFF', {16, 24}); // CJK Unified Ideographs
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(char32_t firstCodePoint, char32_t lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs requested with preloadGlyphs are still being loaded in the background
+        ///
+        /// @return Are there preloaded glyphs that haven't been added to the font texture yet?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPreloadingGlyphs() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal font
         /// @return Backend font that is used internally
@@ -146,20 +146,22 @@ TGUI_MODULE_EXPORT namespace tgui
     ///
     /// @param filename    Path to the file to write
     /// @param textToWrite Contents to be written to the file
+    /// @param binary      Write the contents unmodified instead of converting line endings when the file is opened on Windows
     ///
     /// @return True on success, false if opening or writing to the file failed
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API bool writeFile(const String& filename, const std::stringstream& textToWrite);
+    TGUI_API bool writeFile(const String& filename, const std::stringstream& textToWrite, bool binary = false);
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Opens a file and writes the given contents to it
     ///
     /// @param filename    Path to the file to write
     /// @param textToWrite Contents to be written to the file
+    /// @param binary      Write the contents unmodified instead of converting line endings when the file is opened on Windows
     ///
     /// @return True on success, false if opening or writing to the file failed
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    TGUI_API bool writeFile(const String& filename, CharStringView textToWrite);
+    TGUI_API bool writeFile(const String& filename, CharStringView textToWrite, bool binary = false);
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
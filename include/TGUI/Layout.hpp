@@ -34,6 +34,7 @@
     #include <functional>
     #include <memory>
     #include <string>
+    #include <vector>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +98,9 @@ TGUI_MODULE_EXPORT namespace tgui
     /// @brief Class to store the left, top, width or height of a widget
     ///
     /// You don't have to create an instance of this class, numbers are implicitly cast to this class.
+    ///
+    /// Expressions are compiled into a flat list of instructions in postfix order, with the bound widgets stored inside the
+    /// instructions. Evaluating the layout doesn't allocate memory and copying it only copies this list.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Layout
     {
@@ -165,6 +169,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Constructs the layout based on a string which will be parsed to determine the value of the layout
         ///
         /// @param expression  String to parse
+        ///
+        /// Recently parsed expressions are cached, constructing a layout from the same string again only copies the result.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Layout(String expression);
 
@@ -180,6 +186,14 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Constructs the layout with a mathematical operation between two other layouts
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit Layout(Operation operation, Layout leftOperand, Layout rightOperand);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Copy constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,11 +220,13 @@ TGUI_MODULE_EXPORT namespace tgui
         ~Layout();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Replaces the value of the layout without overwriting its parent
+        /// @brief Replaces the value of the layout
         ///
         /// @param value  New value of the layout
+        ///
+        /// @deprecated Layouts no longer consist of sub-layouts, so this function does the same as the assignment operator.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void replaceValue(const Layout& value);
+        TGUI_DEPRECATED("Use operator= instead") void replaceValue(const Layout& value);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Return the cached value of the layout
@@ -229,7 +245,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD bool isConstant() const
         {
-            return m_operation == Operation::Value;
+            return m_instructions.empty();
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,63 +268,107 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
+        ///
+        /// @param widget  Widget that is being destroyed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout and tell the connected widget about it when the value has changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns a pointer to the left operand (or nullptr if this layout does not store an operation on two operands)
+        /// @brief Recalculates the value of the layout without informing the connected widget about the new value
+        ///
+        /// This is used when layout updates are deferred, to evaluate each layout only once.
+        ///
+        /// @since TGUI 1.7
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Layout* getLeftOperand() const;
+        void calculateValue();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns a pointer to the right operand (or nullptr if this layout does not store an operation on two operands)
+        /// @brief Returns the widget whose position or size is determined by this layout
+        ///
+        /// @return Widget that was passed to connectWidget, or nullptr if the layout isn't connected to a widget
+        ///
+        /// @since TGUI 1.7
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Layout* getRightOperand() const;
+        TGUI_NODISCARD Widget* getConnectedWidget() const
+        {
+            return m_connectedWidget;
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /// A single step of the compiled expression
+        struct Instruction
+        {
+            Operation operation = Operation::Value;
+            float value = 0; // Constant value, or the last value of the bound widget in case the operation is a binding
+            Widget* boundWidget = nullptr; // The widget on which this instruction depends in case the operation is a binding
+            int boundStringIndex = -1; // Index in m_boundStrings in case the instruction was created from a string that contains a binding
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses the string and stores the result in this layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseExpression(String expression);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Creates a layout that consists of a single binding that still has to be parsed when the layout is connected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void initBindingString(String expression);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Appends the instructions of the other layout to the end of the instructions of this layout
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendInstructions(const Layout& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts an instruction containing a binding to a string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String bindingToString(const Instruction& instruction) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tell the bound widgets that the layout no longer binds them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unbindLayout();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Tell the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindLayout();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widgets that were found by parsing strings, the same names may refer to different widgets later
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        void resetBindingStrings();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Find the widget corresponding to the given name and bind it to the instruction if found. Returns false when the
+        // instruction was left unchanged because the widget wasn't found.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        static bool parseBindingString(Instruction& instruction, const String& expression, Widget* widget, bool xAxis);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Prints a warning that the layout is part of a dependency cycle
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const String& expression, Widget* widget, bool xAxis);
+        void printDependencyCycleWarning() const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        String m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::vector<Instruction> m_instructions; // Expression in postfix order, empty when the layout is a constant
+        std::shared_ptr<const std::vector<String>> m_boundStrings; // Strings referring to widgets that were used when parsing the expression
+        unsigned int m_stackSize = 0; // Amount of values that need to be stored at the same time while evaluating the instructions
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout is not a constant
+        Widget* m_connectedWidget = nullptr; // Widget that was passed to connectWidget, whose position or size is determined by this layout
         int m_callingCallbackCount = 0; // Used to detect that connectWidget is called in an infinity loop if certain layouts depend on each other
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
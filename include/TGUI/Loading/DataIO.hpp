@@ -100,6 +100,44 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::unique_ptr<Node> parse(std::stringstream& stream);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  UTF-8 encoded contents of the widget file, which only need to remain valid during this call
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// This function is faster than the overload that takes a stream, the data is parsed directly without copying it.
+        /// If the data was created with emitBinary then it is loaded with parseBinary instead.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parse(CharStringView data);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the data contains a widget file in the binary format that is created by emitBinary
+        ///
+        /// @param data  Contents of the widget file
+        ///
+        /// @return True if the data starts with the header of a binary widget file
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isBinary(CharStringView data);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a widget file that was created with emitBinary
+        ///
+        /// @param data  Contents of the binary widget file, which only need to remain valid during this call
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data isn't a valid binary widget file
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parseBinary(CharStringView data);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -107,6 +145,19 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param stream   Stream to which the widget file will be added
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the widget file in a compact binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be stored
+        /// @param stream   Stream to which the binary data will be added
+        ///
+        /// The binary data stores the tree of nodes after inheritance between sections has been resolved. Every distinct name
+        /// and value is only stored once, so loading it with parseBinary or parse requires almost no parsing.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,7 +32,7 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     tgui::Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getOutline(); \
         else \
@@ -48,7 +48,7 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     tgui::Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getColor(); \
         else \
@@ -64,7 +64,7 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTextStyle(); \
         else \
@@ -80,7 +80,7 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getNumber(); \
         else \
@@ -99,7 +99,7 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getBool(); \
         else \
@@ -118,13 +118,14 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {tgui::Texture{}}; \
-            return m_data->propertyValuePairs[tgui::String(#NAME)].getTexture(); \
+            auto& value = m_data->propertyValuePairs[tgui::String(#NAME)]; \
+            value = {tgui::Texture{}}; \
+            return value.getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const tgui::Texture& texture) \
@@ -137,7 +138,7 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER_WITH_DEFAULT(CLASS, NAME, RENDERER, DEFAULT) \
     std::shared_ptr<tgui::RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID(#NAME)); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getRenderer(); \
         else \
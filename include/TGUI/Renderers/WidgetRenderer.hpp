@@ -31,7 +31,11 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_set>
+    #include <type_traits>
+    #include <cstdint>
+    #include <vector>
     #include <map>
+    #include <utility>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +45,265 @@ TGUI_MODULE_EXPORT namespace tgui
     class Theme;
     class Widget;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Integer that identifies the name of a renderer property
+    ///
+    /// The id is a hash of the property name. Use the TGUI_RENDERER_PROPERTY_ID macro to calculate the id of a string literal
+    /// at compile time. The value of such an id is a constant expression, so it can be used as case label:
+    /// @code
+    /// switch (RendererPropertyId{property}.getValue())
+    /// {
+    ///     case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+    ///         m_bordersCached = getSharedRenderer()->getBorders();
+    ///         break;
+    /// }
+    /// @endcode
+    ///
+    /// @since TGUI 1.7
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class RendererPropertyId
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id from a property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr explicit RendererPropertyId(const char32_t* name) :
+            m_value{hash(name)}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id from a property name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit RendererPropertyId(const String& name) :
+            m_value{hash(name)}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id from the integer value that was returned by getValue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static constexpr RendererPropertyId fromValue(std::uint64_t value)
+        {
+            return RendererPropertyId{value, 0};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the integer value of the id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr std::uint64_t getValue() const
+        {
+            return m_value;
+        }
+
+        TGUI_NODISCARD constexpr bool operator==(RendererPropertyId other) const
+        {
+            return m_value == other.m_value;
+        }
+
+        TGUI_NODISCARD constexpr bool operator!=(RendererPropertyId other) const
+        {
+            return m_value != other.m_value;
+        }
+
+        TGUI_NODISCARD constexpr bool operator<(RendererPropertyId other) const
+        {
+            return m_value < other.m_value;
+        }
+
+    private:
+
+        constexpr RendererPropertyId(std::uint64_t value, int) :
+            m_value{value}
+        {
+        }
+
+        // 64-bit FNV-1a hash of the characters in the name
+        TGUI_NODISCARD static constexpr std::uint64_t hash(const char32_t* name)
+        {
+            std::uint64_t value = 14695981039346656037ull;
+            while (*name)
+            {
+                value ^= static_cast<std::uint64_t>(*name++);
+                value *= 1099511628211ull;
+            }
+            return value;
+        }
+
+        TGUI_NODISCARD static std::uint64_t hash(const String& name)
+        {
+            std::uint64_t value = 14695981039346656037ull;
+            for (const char32_t c : name)
+            {
+                value ^= static_cast<std::uint64_t>(c);
+                value *= 1099511628211ull;
+            }
+            return value;
+        }
+
+    private:
+
+        std::uint64_t m_value;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Property-value pairs of a renderer, which can be looked up by name or by RendererPropertyId
+    ///
+    /// The pairs are stored in a map that is sorted on the property name, like in older TGUI versions. A flat array that is
+    /// sorted on the property id is kept next to it, so that lookups don't require comparing strings.
+    ///
+    /// The class provides the commonly used functions of std::map and converts implicitly to a const std::map, so that code
+    /// that was written when propertyValuePairs was still a std::map keeps working.
+    ///
+    /// @since TGUI 1.7
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyMap
+    {
+    public:
+
+        using key_type = String;
+        using mapped_type = ObjectConverter;
+        using value_type = std::map<String, ObjectConverter>::value_type;
+        using size_type = std::size_t;
+        using iterator = std::map<String, ObjectConverter>::iterator;
+        using const_iterator = std::map<String, ObjectConverter>::const_iterator;
+
+        RendererPropertyMap() = default;
+        RendererPropertyMap(const RendererPropertyMap& other);
+        RendererPropertyMap(RendererPropertyMap&& other) noexcept;
+        RendererPropertyMap& operator=(const RendererPropertyMap& other);
+        RendererPropertyMap& operator=(RendererPropertyMap&& other) noexcept;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the object from a map of property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap(const std::map<String, ObjectConverter>& pairs);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, the property is created when it didn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](const String& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property
+        /// @throw std::out_of_range when the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter& at(const String& property);
+        TGUI_NODISCARD const ObjectConverter& at(const String& property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a property-value pair if the property doesn't exist yet
+        /// @return Iterator to the property-value pair and whether the pair was inserted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::pair<iterator, bool> insert(const value_type& pair);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs a property-value pair and adds it if the property doesn't exist yet
+        /// @return Iterator to the property-value pair and whether the pair was inserted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args)
+        {
+            return insert(value_type(std::forward<Args>(args)...));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the number of properties with the given name (0 or 1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t count(const String& property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property by name
+        /// @return Iterator to the property-value pair, or end() if the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator find(const String& property);
+        TGUI_NODISCARD const_iterator find(const String& property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property by its id, without comparing strings
+        /// @return Iterator to the property-value pair, or end() if the property doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator find(RendererPropertyId id);
+        TGUI_NODISCARD const_iterator find(RendererPropertyId id) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        /// @return Iterator to the property-value pair behind the removed one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator erase(const_iterator it);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a property
+        /// @return Number of removed properties (0 or 1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(const String& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+        TGUI_NODISCARD bool empty() const
+        {
+            return m_pairs.empty();
+        }
+
+        TGUI_NODISCARD std::size_t size() const
+        {
+            return m_pairs.size();
+        }
+
+        TGUI_NODISCARD iterator begin()
+        {
+            return m_pairs.begin();
+        }
+
+        TGUI_NODISCARD const_iterator begin() const
+        {
+            return m_pairs.begin();
+        }
+
+        TGUI_NODISCARD iterator end()
+        {
+            return m_pairs.end();
+        }
+
+        TGUI_NODISCARD const_iterator end() const
+        {
+            return m_pairs.end();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the property-value pairs as a map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::map<String, ObjectConverter>& asMap() const
+        {
+            return m_pairs;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the property-value pairs as a map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        operator const std::map<String, ObjectConverter>&() const
+        {
+            return m_pairs;
+        }
+
+    private:
+
+        // Adds a pair that was just inserted in m_pairs to m_index
+        void addToIndex(iterator it);
+
+        // Fills m_index from scratch
+        void rebuildIndex();
+
+    private:
+
+        std::map<String, ObjectConverter> m_pairs;
+        std::vector<std::pair<RendererPropertyId, iterator>> m_index; // Sorted on id
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,7 +318,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @internal
         TGUI_NODISCARD static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
-        std::map<String, ObjectConverter> propertyValuePairs;
+        RendererPropertyMap propertyValuePairs;
         std::unordered_set<Widget*> observers;
         Theme* connectedTheme = nullptr;
         bool themePropertiesInherited = false;
@@ -196,6 +459,18 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD ObjectConverter getProperty(const String& property) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the value of a certain property
+        ///
+        /// @param property  Id of the property that you would like to retrieve
+        ///
+        /// @return The value inside a ObjectConverter object which you can extract with the correct get function or
+        ///         an ObjectConverter object with type ObjectConverter::Type::None when the property did not exist.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter getProperty(RendererPropertyId property) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets a map with all properties and their values
         ///
@@ -254,4 +529,10 @@ TGUI_MODULE_EXPORT namespace tgui
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Id of a renderer property name, which is always calculated at compile time (NAME has to be a string literal)
+#define TGUI_RENDERER_PROPERTY_ID(NAME) \
+    tgui::RendererPropertyId::fromValue(std::integral_constant<std::uint64_t, tgui::RendererPropertyId{U"" NAME}.getValue()>::value)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif // TGUI_WIDGETS_HPP
@@ -35,6 +35,7 @@
 #include <TGUI/Filesystem.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
     #include <unordered_map>
     #include <type_traits>
     #include <functional>
@@ -211,6 +212,18 @@ TGUI_MODULE_EXPORT namespace tgui
             return m_enabled;
         }
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many times a signal with connected handlers has been emitted
+        ///
+        /// The gui compares this value before and after handling an event to find out whether user code may have changed
+        /// widgets that it isn't tracking, in which case partial redrawing can't be used for the next frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::uint64_t getEmitCount()
+        {
+            return m_emitCount;
+        }
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -258,6 +271,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         static unsigned int m_lastSignalId;
         static std::deque<const void*> m_parameters;
+        static std::uint64_t m_emitCount;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
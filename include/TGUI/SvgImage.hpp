@@ -92,6 +92,29 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rasterize(BackendTexture& texture, Vector2u size);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture on which the image is drawn with a given size
+        ///
+        /// @param size            Size that the texture should have (before the font scale is applied)
+        /// @param currentTexture  Texture that is currently being displayed, if any
+        ///
+        /// @return Cached texture of the requested size, or currentTexture while the requested size is still being rasterized
+        ///
+        /// Rasterized textures are cached per size in pixels, so that sprites of the same size share the same texture.
+        /// If there is no texture yet for the requested size and a current texture is passed, then the image is rasterized
+        /// on a background thread and the current texture keeps being displayed (scaled) until the new one is available.
+        /// The sprites displaying svg images are updated automatically once the rasterization finishes.
+        /// If no current texture exists then the image is rasterized immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> getTexture(Vector2u size, const std::shared_ptr<BackendTexture>& currentTexture = nullptr);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the amount of rasterizations that are still being performed in the background
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getPendingRasterizationCount();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -63,6 +63,19 @@ TGUI_MODULE_EXPORT namespace tgui
             Vector2u     gapSize;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Widths of the characters in a string, as returned by measureCharacters
+        ///
+        /// This is used to word-wrap the same text with different maximum widths without having to access the font each time.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct CharacterWidths
+        {
+            std::vector<float> advances; //!< Horizontal advance of each character (0 for newline and carriage return characters)
+            std::vector<float> kernings; //!< Kerning between each character and the character before it (ignoring carriage returns)
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a small distance that text should be placed from the side of a widget as padding.
         ///
@@ -92,6 +105,23 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static float getLineWidth(const String &text, const Font& font, unsigned int characterSize, TextStyles textStyle = {});
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widths of multiple single lines of text that share the same font, character size and style
+        ///
+        /// @param texts          The texts to measure
+        /// @param font           Font of the texts
+        /// @param characterSize  Character size of the texts
+        /// @param textStyle      Style of the texts
+        ///
+        /// @return Width of each text, identical to what getLineWidth would return for it
+        ///
+        /// This is faster than calling getLineWidth for each text, as the font is only looked up once.
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<float> getLineWidths(const std::vector<String>& texts, const Font& font,
+                                                               unsigned int characterSize, TextStyles textStyle = {});
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Finds the best character size for the text
         ///
@@ -116,6 +146,33 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static String wordWrap(float maxWidth, const String& text, const Font& font, unsigned int textSize, bool bold);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Takes a string and inserts newlines into it so that the width does not exceed maxWidth, using previously measured widths.
+        ///
+        /// @param maxWidth         Maximum width of the text
+        /// @param text             The text to wrap
+        /// @param characterWidths  Widths of the characters in the text, as returned by measureCharacters(text, ...)
+        ///
+        /// @return Text with additional '\n' characters, identical to what wordWrap with the font would return
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static String wordWrap(float maxWidth, const String& text, const CharacterWidths& characterWidths);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Measures the characters in a string, so that it can be word-wrapped multiple times without accessing the font again
+        ///
+        /// @param text             The text to measure
+        /// @param font             Font of the text
+        /// @param textSize         The text size
+        /// @param bold             Should the text be bold?
+        ///
+        /// @return Widths of all characters in the text
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static CharacterWidths measureCharacters(const String& text, const Font& font, unsigned int textSize, bool bold);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// Takes multiple lines of potentially multiple text pieces, and splits lines so that the width does not exceed maxWidth
         ///
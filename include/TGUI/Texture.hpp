@@ -60,6 +60,7 @@ TGUI_MODULE_EXPORT namespace tgui
         using CallbackFunc = std::function<void(std::shared_ptr<TextureData>)>;
         using BackendTextureLoaderFunc = std::function<bool(BackendTexture&, const String&, bool smooth)>;
         using TextureLoaderFunc = std::function<std::shared_ptr<TextureData>(Texture&, const String&, bool smooth)>;
+        using AsyncLoadedFunc = std::function<void(const Texture&)>;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
@@ -194,6 +195,29 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadFromMemory(const std::uint8_t* data, std::size_t dataSize, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture without blocking the gui thread while the image is being decoded
+        ///
+        /// @param id         Id for the the image to load (for the default loader, the id is the filename)
+        /// @param onLoaded   Function that is called on the gui thread with the loaded texture
+        /// @param partRect   Load only part of the image. Don't pass this parameter if you want to load the full image
+        /// @param middleRect Choose the middle part of the image for 9-slice scaling (relative to the part defined by partRect)
+        /// @param smooth     Enable smoothing on the texture
+        ///
+        /// The image is decoded on a background thread (see TextureManager::getTextureAsync). Until the callback function is
+        /// called, the widgets that should show the image can remain without texture or use a placeholder texture.
+        /// If loading fails then the texture that is passed to the callback is empty (i.e. its getData function returns nullptr).
+        ///
+        /// The image is only decoded in the background when the default texture loader and backend texture loader are used.
+        /// When a custom loader is set, the texture is loaded immediately and the callback is called before this function returns.
+        ///
+        /// @code
+        /// auto picture = tgui::Picture::create();
+        /// tgui::Texture::loadAsync("image.png", [picture](const tgui::Texture& texture){ picture->getRenderer()->setTexture(texture); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void loadAsync(const String& id, const AsyncLoadedFunc& onLoaded, const UIntRect& partRect = {}, const UIntRect& middleRect = {}, bool smooth = m_defaultSmooth);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the texture from an array of 32-bits RGBA pixels
         ///
@@ -50,6 +50,10 @@ TGUI_MODULE_EXPORT namespace tgui
         // Either svgImage or backendTexture MUST have a value
         Optional<SvgImage> svgImage;
         std::shared_ptr<BackendTexture> backendTexture;
+
+        // Part of backendTexture that contains the image, only set when the image was packed in a texture atlas.
+        // The backend texture is then shared with other images.
+        Optional<UIntRect> atlasRect;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
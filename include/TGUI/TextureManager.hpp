@@ -30,7 +30,9 @@
 #include <TGUI/TextureData.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <functional>
     #include <memory>
+    #include <vector>
     #include <list>
     #include <map>
 #endif
@@ -40,12 +42,16 @@
 TGUI_MODULE_EXPORT namespace tgui
 {
     class Texture;
+    class Timer;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API TextureManager
     {
     public:
+
+        using AsyncLoadedFunc = std::function<void(std::shared_ptr<TextureData>)>;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -66,6 +72,30 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void copyTexture(const std::shared_ptr<TextureData>& textureDataToCopy);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a texture in the background
+        ///
+        /// @param filename  Filename of the image to load
+        /// @param smooth    Enable smoothing on the texture
+        /// @param callback  Function that is called on the gui thread once the texture is loaded, with nullptr if loading failed
+        ///
+        /// The image is decoded on a background thread with ImageLoader, the texture is created on the gui thread during one of
+        /// the following BackendGui::updateTime calls (which are made by the main loop and while drawing). If the image was
+        /// already loaded then the callback is called before this function returns. When the same file is requested multiple
+        /// times while it is still being decoded, it is only decoded once.
+        ///
+        /// Just like with getTexture, the texture data that is passed to the callback has to be given to removeTexture when
+        /// it is no longer needed. Texture::loadAsync takes care of this.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void getTextureAsync(const String& filename, bool smooth, const AsyncLoadedFunc& callback);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of image files that are still being loaded in the background
+        ///
+        /// @return Number of files requested with getTextureAsync for which the callbacks haven't been called yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAsyncLoadingCount();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes the texture
         ///
@@ -85,10 +115,119 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD static std::size_t getCachedImagesCount();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images are packed together in shared textures
+        ///
+        /// @param enabled  Should small images be stored in a texture atlas?
+        ///
+        /// When the atlas is enabled, images that are loaded from a file and that aren't larger than the maximum atlas image
+        /// size are copied into large atlas pages. Widgets that use different small images then use the same texture, which
+        /// allows the renderer to batch their draw calls. The Texture and Sprite classes take care of using the correct part
+        /// of the atlas page, the backend texture of TextureData is the entire page.
+        ///
+        /// An atlas page is released when none of the images in it are still used. The space of an image that is no longer
+        /// used is not reused by other images as long as the page exists.
+        ///
+        /// Only images that are loaded after this call are affected. The atlas is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together in shared textures
+        ///
+        /// @return Are small images stored in a texture atlas?
+        ///
+        /// @see setAtlasEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool isAtlasEnabled();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size up to which images are stored in the texture atlas
+        ///
+        /// @param size  Maximum width and height of an image that is packed in the atlas, in pixels
+        ///
+        /// Larger images get their own texture, because they would fill an atlas page too quickly.
+        /// The maximum image size can't be larger than the size of the atlas pages, which is 1024x1024.
+        ///
+        /// The default maximum image size is 128.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasMaximumImageSize(unsigned int size);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size up to which images are stored in the texture atlas
+        ///
+        /// @return Maximum width and height of an image that is packed in the atlas, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static unsigned int getAtlasMaximumImageSize();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns how many atlas pages are currently in use
+        ///
+        /// @return Number of textures that contain packed images
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getAtlasPageCount();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct AtlasRow
+        {
+            unsigned int top = 0;    //!< Y position of the row in the page
+            unsigned int height = 0; //!< Height of the row
+            unsigned int width = 0;  //!< Part of the row that is already in use
+        };
+
+        struct AtlasPage
+        {
+            std::shared_ptr<BackendTexture> texture;
+            bool smooth = true;
+            std::vector<AtlasRow> rows;
+            unsigned int nextRowTop = 0;
+            unsigned int imageCount = 0; //!< Amount of images in the page that are still in use
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the pixels of the image into an atlas page and makes the texture data refer to the page.
+        // Returns false if the image can't be stored in the atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool addToAtlas(TextureData& data, const BackendTexture& image, bool smooth);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Releases the space in the atlas page that the image is stored in
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFromAtlas(const TextureData& data);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the texture data of an image that was already loaded with the same settings and marks it as used again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<TextureData> findLoadedTexture(const String& filename, bool smooth);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the texture data for an image that was loaded by a background thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<TextureData> addLoadedImage(const String& filename, bool smooth, Vector2u imageSize, std::unique_ptr<std::uint8_t[]> pixels);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the textures of the images that were decoded by the background threads and calls the callbacks that wait for them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void finishAsyncLoading();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct AsyncRequest
+        {
+            bool smooth = true;
+            AsyncLoadedFunc callback;
+        };
+
         static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+        static std::list<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
+        static unsigned int m_atlasMaximumImageSize;
+        static std::map<String, std::vector<AsyncRequest>> m_asyncRequests;
+        static std::shared_ptr<Timer> m_asyncLoadingTimer;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +153,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Removes all active timers, including the ones that TGUI uses internally
+        ///
+        /// The removed timers are disabled, they can be started again by calling setEnabled(true) on them.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void clearTimers();
 
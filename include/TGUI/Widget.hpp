@@ -295,6 +295,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual Vector2f getWidgetOffset() const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the area occupied by the widget as needing to be redrawn
+        ///
+        /// This function only has an effect when partial redrawing was enabled in the gui (see BackendGui::setPartialRedrawEnabled).
+        /// Changes made by the gui itself (e.g. hovering, moving or resizing the widget) are already tracked automatically.
+        /// You only need to call this function when the widget changes while the gui doesn't know about it, e.g. when a
+        /// custom widget changes its appearance outside of event handling, signals, timers and updateTime.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets how the position is determined compared to the other widgets in the parent
         ///
@@ -965,6 +975,20 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setAutoLayoutUpdateEnabled(bool enabled);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Recalculates the position and size layouts of the widget and applies their values.
+        /// This is called by the gui when layout updates are deferred.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLayouts();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Adds the widgets whose position or size layouts are bound to the position or size of this widget to the list.
+        /// A widget is added once for every layout that binds this widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendLayoutDependents(std::vector<Widget*>& dependents) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -1175,6 +1199,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reports the area occupied by the widget to the gui as needing to be redrawn. The position offset and size allow
+        // reporting the area where the widget was located before it was moved or resized.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateArea(Vector2f positionOffset, Vector2f fullSize);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief This function is called when the mouse enters the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1187,11 +1217,15 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Calls recalculateValue() on each layout in m_boundPositionLayouts
+        ///
+        /// When the gui defers layout updates, the widgets that own the layouts are scheduled to be updated by the gui instead.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateBoundPositionLayouts();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Calls recalculateValue() on each layout in m_boundSizeLayouts
+        ///
+        /// When the gui defers layout updates, the widgets that own the layouts are scheduled to be updated by the gui instead.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateBoundSizeLayouts();
 
@@ -52,6 +52,9 @@ TGUI_MODULE_EXPORT namespace tgui
         {
             Text text;
             String string;
+            float height = 0; //!< Height of the word-wrapped text, cached so that lines don't need to be measured again
+            float top = 0;    //!< Position of the line, relative to an origin that doesn't change when lines are added or removed
+            bool wrapped = false; //!< Whether the text was word-wrapped, until then the height is only an estimate
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,6 +143,37 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addLine(const String& text, Color color, TextStyles style);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// This gives the same result as calling addLine for each of the lines, but the layout of the chat box is only updated
+        /// once. When more lines are passed than the line limit allows, the lines that would immediately be removed again are
+        /// skipped. This makes it suitable for displaying log messages that arrive at a high rate, by collecting the messages
+        /// and passing them to this function once per frame.
+        ///
+        /// Lines are only word-wrapped once they become visible. Until then the scrollbar is based on an estimate of their height.
+        ///
+        /// The default text color and style will be used.
+        ///
+        /// @param lines  Lines that will be added to the chat box
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& lines);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple lines of text to the chat box at once
+        ///
+        /// @param lines  Lines that will be added to the chat box
+        /// @param color  Color of the text
+        /// @param style  Text style
+        ///
+        /// @see addLines(const std::vector<String>&)
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLines(const std::vector<String>& lines, Color color, TextStyles style);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
@@ -335,12 +369,47 @@ TGUI_MODULE_EXPORT namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the text attribute of the line
+        // Creates a line and places it above or below the other lines, without updating the scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLineInternal(const String& text, Color color, TextStyles style);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the oldest lines, without updating the scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeOldestLines(std::size_t count);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width available to the lines, at which they are word-wrapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getMaxLineWidth() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the text attribute and height of the line
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateLineText(Line& line);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Estimates the height of the line without word-wrapping it, the line is wrapped once it becomes visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void estimateLineHeight(Line& line) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first visible line and the index past the last visible line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::pair<std::size_t, std::size_t> getVisibleLines() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the visible lines that were only estimated so far. Returns whether any line was wrapped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool wrapVisibleLines();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the positions of the lines, starting from the given line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLinePositions(std::size_t firstIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Estimates the heights of all lines again and recalculates the full text height
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
@@ -392,6 +461,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTextSize() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns the size without the borders
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,6 +485,8 @@ TGUI_MODULE_EXPORT namespace tgui
         std::size_t m_maxLines = 0;
 
         float m_fullTextHeight = 0;
+        float m_wrapWidth = 0;
+        bool m_relayoutRequired = false; // Lines have to be laid out again in the next frame, because their width or text size changed
 
         bool m_linesStartFromTop = false;
         bool m_newLinesBelowOthers = true;
@@ -520,6 +520,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void connectTitleButtonCallbacks();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the size when the size of the decoration changed while the size was set with setClientSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSizeFromClientSize();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -554,8 +559,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2f       m_draggingPosition;
         Vector2f       m_maximumSize    = {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()};
         Vector2f       m_minimumSize    = {0, 0};
-        Layout*        m_decorationLayoutX = nullptr;
-        Layout*        m_decorationLayoutY = nullptr;
+        Layout2d       m_clientSizeLayout; // Layout that was passed to setClientSize
+        bool           m_sizeSetFromClientSize = false; // Does the size still consist of m_clientSizeLayout and the size of the decoration?
         HorizontalAlignment m_titleAlignment = HorizontalAlignment::Center;
         unsigned int   m_titleButtons   = TitleButton::Close;
         unsigned int   m_titleTextSize  = 0;
@@ -360,6 +360,12 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateTextPiecePositions(float maxWidth);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns m_string word-wrapped to the given width. The widths of the characters and the last results are cached, so that
+        // calling this function again for the same text only has to access the font when the font, text size or style changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const String& getWordWrappedText(float maxWidth);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,6 +390,19 @@ TGUI_MODULE_EXPORT namespace tgui
 
         float m_maximumTextWidth = 0;
 
+        // Cache used by getWordWrappedText
+        struct WordWrapCache
+        {
+            String text;
+            Font font;
+            float fontScale = 1; // The character widths also change when the font scale changes
+            unsigned int textSize = 0;
+            bool bold = false;
+            Text::CharacterWidths characterWidths;
+            std::vector<std::pair<float, String>> wrappedTexts; // Maximum width and result of the most recent word-wraps
+        };
+        WordWrapCache m_wordWrapCache;
+
         bool m_ignoringMouseEvents = false; // TGUI_NEXT: Remove this property
 
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
@@ -57,6 +57,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         using ColumnAlignment TGUI_DEPRECATED("Use tgui::HorizontalAlignment instead") = HorizontalAlignment;
 
+        using CellProviderFunc = std::function<String(std::size_t row, std::size_t column)>; //!< Returns the text of a cell when using setVirtualItems
+
         struct Item
         {
             std::vector<Text> texts;
@@ -561,6 +563,50 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list view request the texts of its cells from a callback instead of storing all items
+        ///
+        /// @param itemCount     Amount of rows in the list view
+        /// @param cellProvider  Function that returns the text to display in a given row and column
+        ///
+        /// This is intended for list views with a very large amount of rows. Texts are only created for the rows that are
+        /// visible and they are reused while scrolling, so the memory usage no longer depends on the amount of items.
+        ///
+        /// Items that were added before are removed. While the cells are provided by a callback, items can't be added and
+        /// properties of individual items (such as icons and item data) can't be set. Selecting, hovering and sorting still
+        /// work, but on row indices. Auto-resizing columns only take the header into account.
+        /// Calling removeAllItems returns the list view to its normal mode.
+        ///
+        /// Example:
+        /// @code
+        /// listView->setVirtualItems(lines.size(), [&lines](std::size_t row, std::size_t){ return lines[row]; });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, const CellProviderFunc& cellProvider);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of rows when the cells are provided by a callback
+        ///
+        /// @param itemCount  New amount of rows in the list view
+        ///
+        /// @see setVirtualItems
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t itemCount);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Requests the texts of the visible cells again from the callback that was passed to setVirtualItems
+        ///
+        /// This function has to be called when the data returned by the callback changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshVirtualItems();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texts of the cells are provided by a callback
+        ///
+        /// @return Was setVirtualItems called (and removeAllItems wasn't called afterwards)?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasVirtualItems() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -933,7 +979,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Text createText(const String& caption);
+        TGUI_NODISCARD Text createText(const String& caption) const;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for a header text from the given caption, using the preset color, font, text size and opacity
@@ -1075,6 +1121,26 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void drawColumn(BackendRenderTarget& target, RenderStates states, std::size_t firstItem, std::size_t lastItem, std::size_t column, float columnWidth) const;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the text of a cell by calling the cell provider, taking sorting into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getVirtualItemCell(std::size_t rowIndex, std::size_t columnIndex) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color that the texts of an item should have, based on whether it is selected or hovered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Color getItemTextColor(std::size_t index) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or reuses the Text objects of the visible rows when the cells are provided by a callback
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the item to draw, which is stored in m_visibleItems when the cells are provided by a callback
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const Item& getItemForDrawing(std::size_t index) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1106,6 +1172,15 @@ TGUI_MODULE_EXPORT namespace tgui
         std::vector<Item>   m_items;
         std::set<std::size_t> m_selectedItems;
 
+        CellProviderFunc m_cellProvider; // Only set when the items are virtual, m_items is empty in that case
+        std::size_t m_virtualItemCount = 0;
+        std::vector<std::size_t> m_virtualItemOrder; // Rows in the order in which they are displayed, empty if not sorted
+
+        // When the items are virtual, these contain the rows that were last drawn. They are updated while drawing.
+        mutable std::vector<Item> m_visibleItems;
+        mutable std::size_t m_visibleItemsFirstIndex = 0;
+        mutable bool m_visibleItemsOutdated = false;
+
         int m_hoveredItem = -1;
         int m_firstSelectedItemIndex = -1;
         int m_focusedItemIndex = -1;
@@ -126,6 +126,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float calculateTextHeight(const std::vector<std::vector<Text::Blueprint>>& textPiecesLines, float defaultLineSpacing);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Helper function used by rearrangeText() to word-wrap the lines, which reuses the result when the lines and width didn't change
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::vector<Text::Blueprint>>& getWordWrappedLines(float maxWidth, const std::vector<std::vector<Text::Blueprint>>& textPiecesLines);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +141,16 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<Sprite> m_images;
 
+        // Cache used by getWordWrappedLines
+        struct BlueprintWordWrapCache
+        {
+            Font font;
+            float fontScale = 1;
+            std::vector<std::vector<Text::Blueprint>> lines;
+            std::vector<std::pair<float, std::vector<std::vector<Text::Blueprint>>>> wrappedLines; // Results of the most recent word-wraps
+        };
+        BlueprintWordWrapCache m_blueprintWordWrapCache;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -476,13 +476,30 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection, const bool emitCaretChangedPosition = true);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearrange the text after m_text was changed, by only word-wrapping the paragraphs that contain the changed characters.
+        // The change is described by its position in the text and the amount of characters that were removed and inserted there.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeChangedText(std::size_t changeStart, std::size_t removedChars, std::size_t insertedChars, bool emitCaretChangedPosition = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word-wraps the characters between charStart and charEnd and replaces the given paragraphs and their lines with the result.
+        // Returns false when there is no room for the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool rewrapParagraphs(std::size_t firstParagraph, std::size_t oldParagraphCount, std::size_t charStart, std::size_t charEnd);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the selection, the width of the longest line and the scrollbars after the lines were rearranged.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRearrangedLines(bool keepSelection, std::size_t selStart, std::size_t selEnd, bool emitCaretChangedPosition);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the caret position and scrolls it into view after the text or the selection was changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -585,6 +602,11 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will split the visible lines into five pieces so that the text can be easily drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -626,6 +648,14 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void scrollbarPolicyChanged(Orientation orientation) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called when the value of one of the scrollbars has been changed by calling either
+        ///        getVerticalScrollbar()->setValue(...) or getHorizontalScrollbar()->setValue(...)
+        ///
+        /// @param orientation  Vertical or Horizontal depending on which scrollbar triggered the callback
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scrollbarValueChanged(Orientation orientation) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,6 +685,15 @@ TGUI_MODULE_EXPORT namespace tgui
 
         std::vector<String> m_lines;
 
+        // Each paragraph (text between newlines) is word-wrapped separately, so that a change only has to rewrap its own paragraph
+        struct Paragraph
+        {
+            std::size_t length = 0;    // Amount of characters, without the newline at the end
+            std::size_t lineCount = 0; // Amount of lines in m_lines that are occupied by the paragraph
+            float width = 0;           // Width of the line, only calculated when the text isn't word-wrapped
+        };
+        std::vector<Paragraph> m_paragraphs;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
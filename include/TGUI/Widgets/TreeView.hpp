@@ -59,10 +59,20 @@ TGUI_MODULE_EXPORT namespace tgui
             Text text;
             unsigned int depth = 0;
             bool expanded = true;
+            bool childrenPending = false; //!< Children still have to be requested from the children provider
             Node* parent = nullptr;
             std::vector<std::shared_ptr<Node>> nodes;
         };
 
+        /// @brief Child item returned by the children provider
+        struct LazyItem
+        {
+            String text;
+            bool hasChildren = false; //!< Is the item a branch whose children are only requested when it gets expanded?
+        };
+
+        using ChildrenProviderFunc = std::function<std::vector<LazyItem>(const std::vector<String>& hierarchy)>; //!< Returns the children of a lazy item
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Constructor
@@ -146,6 +156,44 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool addItem(const std::vector<String>& hierarchy, bool createParents = true);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a collapsed branch item of which the children are only requested when the item is expanded
+        ///
+        /// @param hierarchy     Hierarchy of items, with the last item being the lazy item
+        /// @param createParents Should the hierarchy be created if it did not exist yet?
+        ///
+        /// @return True when the item was added (always the case if createParents is true)
+        ///
+        /// The first time the item gets expanded, the function passed to setChildrenProvider is called to create its children.
+        /// Children that are returned with hasChildren set to true are lazy items themselves. This allows displaying huge
+        /// hierarchies where only the branches that the user opens are ever loaded into the tree view.
+        ///
+        /// Example code:
+        /// @code
+        /// treeView->setChildrenProvider([](const std::vector<tgui::String>& hierarchy) {
+        ///     std::vector<tgui::TreeView::LazyItem> children;
+        ///     for (unsigned int i = 0; i < 1000; ++i)
+        ///         children.push_back({hierarchy.back() + "." + tgui::String(i), hierarchy.size() < 10});
+        ///     return children;
+        /// });
+        /// treeView->addLazyItem({"Root"});
+        /// @endcode
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addLazyItem(const std::vector<String>& hierarchy, bool createParents = true);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the function that is called to create the children of a lazy item when it is expanded for the first time
+        ///
+        /// @param func  Function that receives the hierarchy of the expanded item and returns its children
+        ///
+        /// @see addLazyItem
+        ///
+        /// @since TGUI 1.7
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setChildrenProvider(const ChildrenProviderFunc& func);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the text of a leaf item
         ///
@@ -172,6 +220,8 @@ TGUI_MODULE_EXPORT namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Expands all items
+        ///
+        /// Lazy items of which the children haven't been requested yet remain collapsed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void expandAll();
 
@@ -532,6 +582,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void toggleNodeInternal(std::size_t index);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Requests the children of a lazy node from the children provider
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadPendingChildren(Node& node);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the visible items below a node that was just expanded or collapsed, without rebuilding the entire list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleChildNodes(std::size_t index);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Expands or collapses a node
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -543,9 +603,14 @@ TGUI_MODULE_EXPORT namespace tgui
         void loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Rebuilds the list of visible items and positions the texts
+        // Adds the nodes that are visible to the list and positions their texts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
+        void updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, std::vector<std::shared_ptr<Node>>& visibleNodes, float textPadding);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars after the amount of visible items or their width changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the text colors of the selected and hovered items
@@ -578,6 +643,8 @@ TGUI_MODULE_EXPORT namespace tgui
         std::vector<std::shared_ptr<Node>> m_nodes;
         std::vector<std::shared_ptr<Node>> m_visibleNodes;
 
+        ChildrenProviderFunc m_childrenProvider;
+
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
 
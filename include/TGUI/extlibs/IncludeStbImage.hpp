@@ -62,6 +62,38 @@
 #if TGUI_USE_SYSTEM_STB
 #   include <stb_image.h>
 #else
+    // Let stb_image allocate its memory with new[] so that the ImageLoader can take ownership of the decoded pixels
+#   include <cstring>
+#   include <new>
+    namespace tgui
+    {
+    namespace priv
+    {
+        inline void* stbiMalloc(std::size_t size)
+        {
+            return new(std::nothrow) unsigned char[size];
+        }
+
+        inline void* stbiRealloc(void* ptr, std::size_t oldSize, std::size_t newSize)
+        {
+            auto* newPtr = new(std::nothrow) unsigned char[newSize];
+            if (newPtr && ptr)
+            {
+                std::memcpy(newPtr, ptr, (oldSize < newSize) ? oldSize : newSize);
+                delete[] static_cast<unsigned char*>(ptr);
+            }
+            return newPtr;
+        }
+
+        inline void stbiFree(void* ptr)
+        {
+            delete[] static_cast<unsigned char*>(ptr);
+        }
+    }
+    }
+#   define STBI_MALLOC(size) tgui::priv::stbiMalloc(size)
+#   define STBI_REALLOC_SIZED(ptr, oldSize, newSize) tgui::priv::stbiRealloc(ptr, oldSize, newSize)
+#   define STBI_FREE(ptr) tgui::priv::stbiFree(ptr)
 #   define STB_IMAGE_STATIC
 #   define STB_IMAGE_IMPLEMENTATION
 #   include <TGUI/extlibs/stb/stb_image.h>
@@ -27,6 +27,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -77,6 +78,7 @@ namespace tgui
         {
             m_isSmooth = other.m_isSmooth;
             m_fontScale = other.m_fontScale;
+            clearMetricsTables();
         }
 
         return *this;
@@ -90,6 +92,7 @@ namespace tgui
         {
             m_isSmooth = std::move(other.m_isSmooth);
             m_fontScale = std::move(other.m_fontScale);
+            clearMetricsTables();
         }
 
         return *this;
@@ -118,6 +121,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFont::getAdvance(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        if (codePoint >= MetricsTable::AdvanceCount)
+            return getGlyph(codePoint, characterSize, bold).advance;
+
+        float& advance = getMetricsTable(characterSize, bold).advances[codePoint];
+        if (std::isnan(advance))
+            advance = getGlyph(codePoint, characterSize, bold).advance;
+
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFont::getCachedKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        const char32_t firstIndex = first - MetricsTable::KerningFirst; // Wraps around for characters below the range
+        const char32_t secondIndex = second - MetricsTable::KerningFirst;
+        if ((firstIndex >= MetricsTable::KerningCount) || (secondIndex >= MetricsTable::KerningCount))
+            return getKerning(first, second, characterSize, bold);
+
+        float& kerning = getMetricsTable(characterSize, bold).kernings[(firstIndex * MetricsTable::KerningCount) + secondIndex];
+        if (std::isnan(kerning))
+            kerning = getKerning(first, second, characterSize, bold);
+
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::clearMetricsTables()
+    {
+        m_metricsTables.clear();
+        m_lastMetricsTable = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFont::MetricsTable& BackendFont::getMetricsTable(unsigned int characterSize, bool bold)
+    {
+        // Text is usually measured with the same size and style many times in a row, so the last table is checked first
+        const unsigned int key = (characterSize << 1) | static_cast<unsigned int>(bold);
+        if (m_lastMetricsTable && (m_lastMetricsTableKey == key))
+            return *m_lastMetricsTable;
+
+        auto& table = m_metricsTables[key];
+        if (!table)
+        {
+            table = std::make_unique<MetricsTable>();
+            table->advances.fill(std::numeric_limits<float>::quiet_NaN());
+            table->kernings.fill(std::numeric_limits<float>::quiet_NaN());
+        }
+
+        m_lastMetricsTable = table.get();
+        m_lastMetricsTableKey = key;
+        return *table;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::uint64_t BackendFont::constructGlyphKey(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
     {
         // Create a unique key for every character.
@@ -135,6 +198,9 @@ namespace tgui
 
     void BackendFont::setSmooth(bool smooth)
     {
+        if (smooth != m_isSmooth)
+            clearMetricsTables(); // Disabling anti-aliasing can change the hinting and thereby the advances
+
         m_isSmooth = smooth;
     }
 
@@ -153,6 +219,7 @@ namespace tgui
             return;
 
         m_fontScale = scale;
+        clearMetricsTables();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +230,50 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFont::getTextureAtIndex(unsigned int characterSize, unsigned int textureIndex, unsigned int& textureVersion)
+    {
+        if (textureIndex == 0)
+            return getTexture(characterSize, textureVersion);
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontGlyphCacheStatistics BackendFont::getGlyphCacheStatistics() const
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::preloadGlyphs(char32_t firstCodePoint, char32_t lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold)
+    {
+        for (const unsigned int characterSize : characterSizes)
+        {
+            for (char32_t codePoint = firstCodePoint; (codePoint >= firstCodePoint) && (codePoint <= lastCodePoint); ++codePoint)
+            {
+                if (hasGlyph(codePoint))
+                    (void)getGlyph(codePoint, characterSize, bold);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFont::isPreloadingGlyphs() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::frameDrawn()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
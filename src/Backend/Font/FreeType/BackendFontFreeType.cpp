@@ -45,7 +45,11 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
+    #include <cstring>
+    #include <iterator>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +57,120 @@
 namespace tgui
 {
     static const float unitsPerPixel = 64; // Freetype's 26.6 pixel format uses 1/64th of a pixel as unit
+    static const unsigned int distanceFieldCharacterSize = 48; // Size at which distance field glyphs are rasterized
+    static const unsigned int distanceFieldSpread = 6; // Distance from the glyph edge (in pixels) up to which the distance field is stored
+    static const unsigned int distanceFieldPageKey = std::numeric_limits<unsigned int>::max();
+
+    namespace
+    {
+        // The freetype library is shared by all fonts and destroyed when the last font is destroyed.
+        // Fonts may be created and destroyed on different threads, so the reference count is protected by a mutex.
+        // FreeType also requires faces of the same library to be created and destroyed one at a time.
+        FT_Library sharedLibrary = nullptr;
+        unsigned int sharedLibraryUsers = 0;
+        std::mutex sharedLibraryMutex;
+
+        // Protects the registry returned by BackendFontFreetype::getLoadedFaces
+        std::mutex loadedFacesMutex;
+
+        FT_Library acquireLibrary()
+        {
+            const std::lock_guard<std::mutex> lock(sharedLibraryMutex);
+            if (!sharedLibrary)
+            {
+                if (FT_Init_FreeType(&sharedLibrary) != 0)
+                {
+                    sharedLibrary = nullptr;
+                    throw Exception{U"Failed to initialize Freetype"};
+                }
+            }
+
+            ++sharedLibraryUsers;
+            return sharedLibrary;
+        }
+
+        void releaseLibrary()
+        {
+            const std::lock_guard<std::mutex> lock(sharedLibraryMutex);
+            TGUI_ASSERT(sharedLibraryUsers > 0, "releaseLibrary can't be called more often than acquireLibrary");
+            if (--sharedLibraryUsers > 0)
+                return;
+
+            FT_Done_FreeType(sharedLibrary);
+            sharedLibrary = nullptr;
+        }
+
+        // FNV-1a hash of the font file, used to quickly find fonts that were already loaded
+        TGUI_NODISCARD std::uint64_t hashFileContents(const std::uint8_t* data, std::size_t sizeInBytes)
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (std::size_t i = 0; i < sizeInBytes; ++i)
+            {
+                hash ^= data[i];
+                hash *= 1099511628211ULL;
+            }
+
+            return hash;
+        }
+
+        // Creates a signed distance field of a rasterized glyph, which is distanceFieldSpread pixels larger on each side.
+        // A value of 128 lies on the edge of the glyph, higher values are inside the glyph.
+        TGUI_NODISCARD std::vector<std::uint8_t> createDistanceField(const FT_Bitmap& bitmap)
+        {
+            const int width = static_cast<int>(bitmap.width);
+            const int height = static_cast<int>(bitmap.rows);
+            std::vector<std::uint8_t> inside(static_cast<std::size_t>(width * height));
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                        inside[static_cast<std::size_t>((y * width) + x)] = (bitmap.buffer[(y * bitmap.pitch) + (x / 8)] & (1 << (7 - (x % 8)))) ? 1 : 0;
+                    else
+                        inside[static_cast<std::size_t>((y * width) + x)] = (bitmap.buffer[(y * bitmap.pitch) + x] >= 128) ? 1 : 0;
+                }
+            }
+
+            const auto isInside = [&](int x, int y){
+                return (x >= 0) && (y >= 0) && (x < width) && (y < height) && (inside[static_cast<std::size_t>((y * width) + x)] != 0);
+            };
+
+            const int spread = static_cast<int>(distanceFieldSpread);
+            const int fieldWidth = width + (2 * spread);
+            const int fieldHeight = height + (2 * spread);
+            std::vector<std::uint8_t> field(static_cast<std::size_t>(fieldWidth * fieldHeight));
+            for (int fieldY = 0; fieldY < fieldHeight; ++fieldY)
+            {
+                for (int fieldX = 0; fieldX < fieldWidth; ++fieldX)
+                {
+                    const int x = fieldX - spread;
+                    const int y = fieldY - spread;
+                    const bool pixelInside = isInside(x, y);
+
+                    // Search the nearest pixel on the other side of the edge
+                    int minDistanceSquared = (spread + 1) * (spread + 1);
+                    for (int offsetY = -spread; offsetY <= spread; ++offsetY)
+                    {
+                        for (int offsetX = -spread; offsetX <= spread; ++offsetX)
+                        {
+                            if (isInside(x + offsetX, y + offsetY) != pixelInside)
+                                minDistanceSquared = std::min(minDistanceSquared, (offsetX * offsetX) + (offsetY * offsetY));
+                        }
+                    }
+
+                    // The edge lies halfway between the centers of the pixels inside and outside the glyph
+                    float distance = std::sqrt(static_cast<float>(minDistanceSquared)) - 0.5f;
+                    if (!pixelInside)
+                        distance = -distance;
+
+                    const float value = std::max(0.f, std::min(1.f, 0.5f + (distance / (2.f * spread))));
+                    field[static_cast<std::size_t>((fieldY * fieldWidth) + fieldX)] = static_cast<std::uint8_t>((value * 255) + 0.5f);
+                }
+            }
+
+            return field;
+        }
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -66,67 +184,59 @@ namespace tgui
     bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
         cleanup();
-        m_cachedLineSpacing.clear();
-        m_cachedFontHeights.clear();
-        m_cachedAscents.clear();
-        m_cachedDescents.clear();
-        m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
-        m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
-
-        constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
-
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
+        clearMetricsTables();
+
+        // If the same font was already loaded then we reuse its face and glyphs
+        const std::uint64_t fileHash = hashFileContents(data.get(), sizeInBytes);
+        const std::lock_guard<std::mutex> lock(loadedFacesMutex);
+        auto& facesWithHash = getLoadedFaces()[fileHash];
+        for (auto it = facesWithHash.begin(); it != facesWithHash.end();)
+        {
+            auto faceData = it->lock();
+            if (!faceData)
             {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
+                it = facesWithHash.erase(it);
+                continue;
             }
-        }
 
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
-        {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
-        }
+            if ((faceData->fileSize == sizeInBytes) && (std::memcmp(faceData->fileContents.get(), data.get(), sizeInBytes) == 0))
+            {
+                ++faceData->fontCount;
+                m_data = std::move(faceData);
+                return true;
+            }
 
-        m_textureSize = initialTextureSize;
+            ++it;
+        }
 
-        // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
-        FT_Library library;
-        if (FT_Init_FreeType(&library) != 0)
-            throw Exception{U"Failed to initialize Freetype"};
+        auto faceData = std::make_shared<FaceData>();
+        faceData->library = acquireLibrary();
+        faceData->fileHash = fileHash;
 
         // Load the font face from the font file that we have in memory
-        FT_Face face;
-        if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(data.get()), static_cast<FT_Long>(sizeInBytes), 0, &face) != 0)
+        FT_Error error;
         {
-            FT_Done_FreeType(library);
+            const std::lock_guard<std::mutex> libraryLock(sharedLibraryMutex);
+            error = FT_New_Memory_Face(faceData->library, static_cast<const FT_Byte*>(data.get()), static_cast<FT_Long>(sizeInBytes), 0, &faceData->face);
+        }
+        if (error != 0)
+        {
+            faceData->face = nullptr;
             throw Exception{U"Failed to load font face"};
         }
 
         // Select the unicode character map. Can we ignore a failure from this function?
-        if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
-        {
-            FT_Done_Face(face);
-            FT_Done_FreeType(library);
+        if (FT_Select_Charmap(faceData->face, FT_ENCODING_UNICODE) != 0)
             throw Exception{U"Failed to select font character map"};
-        }
 
-        m_fileContents = std::move(data);
-        m_library = library;
-        m_face = face;
+        faceData->fileContents = std::move(data);
+        faceData->fileSize = sizeInBytes;
+        faceData->maximumPageSize = m_maximumPageSize;
+        faceData->evictionDelay = m_evictionDelay;
+        faceData->fontCount = 1;
+
+        facesWithHash.push_back(faceData);
+        m_data = std::move(faceData);
         return true;
     }
 
@@ -134,7 +244,7 @@ namespace tgui
 
     bool BackendFontFreetype::hasGlyph(char32_t codePoint) const
     {
-        return FT_Get_Char_Index(m_face, static_cast<FT_ULong>(codePoint)) != 0; // m_face is allowed to be nullptr
+        return m_data && (FT_Get_Char_Index(m_data->face, static_cast<FT_ULong>(codePoint)) != 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,7 +252,7 @@ namespace tgui
     FontGlyph BackendFontFreetype::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
         FontGlyph glyph;
-        if (!m_face)
+        if (!m_data)
             return glyph;
 
         const Glyph& internalGlyph = getInternalGlyph(codePoint, characterSize, bold, outlineThickness);
@@ -150,6 +260,7 @@ namespace tgui
         glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
         glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
         glyph.textureRect = internalGlyph.textureRect;
+        glyph.textureIndex = internalGlyph.textureIndex;
         return glyph;
     }
 
@@ -161,25 +272,29 @@ namespace tgui
         if ((first == 0) || (second == 0))
             return 0;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_data)
             return 0;
 
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag.
+        // This is done before setting the character size, as loading a distance field glyph changes the size of the face.
         const float firstRsbDelta = getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
         const float secondLsbDelta = getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
 
+        if (!setCurrentSize(m_data->face, static_cast<unsigned int>(characterSize * m_fontScale)))
+            return 0;
+
         // Get the kerning vector if present
         FT_Vector kerning;
         kerning.x = kerning.y = 0;
-        if (FT_HAS_KERNING(m_face))
+        if (FT_HAS_KERNING(m_data->face))
         {
-            const FT_UInt index1 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(first));
-            const FT_UInt index2 = FT_Get_Char_Index(m_face, static_cast<FT_ULong>(second));
-            FT_Get_Kerning(m_face, index1, index2, FT_KERNING_UNFITTED, &kerning);
+            const FT_UInt index1 = FT_Get_Char_Index(m_data->face, static_cast<FT_ULong>(first));
+            const FT_UInt index2 = FT_Get_Char_Index(m_data->face, static_cast<FT_ULong>(second));
+            FT_Get_Kerning(m_data->face, index1, index2, FT_KERNING_UNFITTED, &kerning);
         }
 
         // X advance is already in pixels for bitmap fonts
-        if (!FT_IS_SCALABLE(m_face))
+        if (!FT_IS_SCALABLE(m_data->face))
             return static_cast<float>(kerning.x) / m_fontScale;
 
         // Combine kerning with compensation deltas and return the X advance
@@ -193,15 +308,18 @@ namespace tgui
     {
         unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
 
-        const auto it = m_cachedLineSpacing.find(scaledCharacterSize);
-        if (it != m_cachedLineSpacing.end())
+        if (!m_data)
+            return 0;
+
+        const auto it = m_data->cachedLineSpacing.find(scaledCharacterSize);
+        if (it != m_data->cachedLineSpacing.end())
             return it->second / m_fontScale;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!setCurrentSize(m_data->face, scaledCharacterSize))
             return 0;
 
-        const float lineSpacing = m_face->size->metrics.height / unitsPerPixel;
-        m_cachedLineSpacing[scaledCharacterSize] = lineSpacing;
+        const float lineSpacing = m_data->face->size->metrics.height / unitsPerPixel;
+        m_data->cachedLineSpacing[scaledCharacterSize] = lineSpacing;
         return lineSpacing / m_fontScale;
     }
 
@@ -211,20 +329,23 @@ namespace tgui
     {
         unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
 
-        const auto it = m_cachedFontHeights.find(scaledCharacterSize);
-        if (it != m_cachedFontHeights.end())
+        if (!m_data)
+            return 0;
+
+        const auto it = m_data->cachedFontHeights.find(scaledCharacterSize);
+        if (it != m_data->cachedFontHeights.end())
             return it->second / m_fontScale;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!setCurrentSize(m_data->face, scaledCharacterSize))
             return 0;
 
         float fontHeight;
-        if (FT_IS_SCALABLE(m_face))
-            fontHeight = std::ceil(static_cast<float>(FT_MulFix(m_face->ascender - m_face->descender, m_face->size->metrics.y_scale)) / unitsPerPixel);
+        if (FT_IS_SCALABLE(m_data->face))
+            fontHeight = std::ceil(static_cast<float>(FT_MulFix(m_data->face->ascender - m_data->face->descender, m_data->face->size->metrics.y_scale)) / unitsPerPixel);
         else // Use the line spacing when we don't have a scalable font
-            fontHeight = m_face->size->metrics.height / unitsPerPixel;
+            fontHeight = m_data->face->size->metrics.height / unitsPerPixel;
 
-        m_cachedFontHeights[scaledCharacterSize] = fontHeight;
+        m_data->cachedFontHeights[scaledCharacterSize] = fontHeight;
         return fontHeight / m_fontScale;
     }
 
@@ -234,20 +355,23 @@ namespace tgui
     {
         unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
 
-        const auto it = m_cachedAscents.find(scaledCharacterSize);
-        if (it != m_cachedAscents.end())
+        if (!m_data)
+            return 0;
+
+        const auto it = m_data->cachedAscents.find(scaledCharacterSize);
+        if (it != m_data->cachedAscents.end())
             return it->second / m_fontScale;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!setCurrentSize(m_data->face, scaledCharacterSize))
             return 0;
 
         float ascent;
-        if (FT_IS_SCALABLE(m_face))
-            ascent = std::ceil(static_cast<float>(FT_MulFix(m_face->ascender, m_face->size->metrics.y_scale)) / unitsPerPixel);
+        if (FT_IS_SCALABLE(m_data->face))
+            ascent = std::ceil(static_cast<float>(FT_MulFix(m_data->face->ascender, m_data->face->size->metrics.y_scale)) / unitsPerPixel);
         else
-            ascent = m_face->size->metrics.ascender / unitsPerPixel;
+            ascent = m_data->face->size->metrics.ascender / unitsPerPixel;
 
-        m_cachedAscents[scaledCharacterSize] = ascent;
+        m_data->cachedAscents[scaledCharacterSize] = ascent;
         return ascent / m_fontScale;
     }
 
@@ -257,20 +381,23 @@ namespace tgui
     {
         unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
 
-        const auto it = m_cachedDescents.find(scaledCharacterSize);
-        if (it != m_cachedDescents.end())
+        if (!m_data)
+            return 0;
+
+        const auto it = m_data->cachedDescents.find(scaledCharacterSize);
+        if (it != m_data->cachedDescents.end())
             return it->second / m_fontScale;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!setCurrentSize(m_data->face, scaledCharacterSize))
             return 0;
 
         float descent;
-        if (FT_IS_SCALABLE(m_face))
-            descent = std::ceil(static_cast<float>(FT_MulFix(-m_face->descender, m_face->size->metrics.y_scale)) / unitsPerPixel);
+        if (FT_IS_SCALABLE(m_data->face))
+            descent = std::ceil(static_cast<float>(FT_MulFix(-m_data->face->descender, m_data->face->size->metrics.y_scale)) / unitsPerPixel);
         else
-            descent = -m_face->size->metrics.descender / unitsPerPixel;
+            descent = -m_data->face->size->metrics.descender / unitsPerPixel;
 
-        m_cachedDescents[scaledCharacterSize] = descent;
+        m_data->cachedDescents[scaledCharacterSize] = descent;
         return descent / m_fontScale;
     }
 
@@ -278,116 +405,356 @@ namespace tgui
 
     float BackendFontFreetype::getUnderlinePosition(unsigned int characterSize)
     {
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_data || !setCurrentSize(m_data->face, static_cast<unsigned int>(characterSize * m_fontScale)))
             return 0;
 
         // Return a fixed position if font is a bitmap font
-        if (!FT_IS_SCALABLE(m_face))
+        if (!FT_IS_SCALABLE(m_data->face))
             return characterSize / 10.f;
 
-        return -static_cast<float>(FT_MulFix(m_face->underline_position, m_face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
+        return -static_cast<float>(FT_MulFix(m_data->face->underline_position, m_data->face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float BackendFontFreetype::getUnderlineThickness(unsigned int characterSize)
     {
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_data || !setCurrentSize(m_data->face, static_cast<unsigned int>(characterSize * m_fontScale)))
             return 0;
 
         // Return a fixed thickness if font is a bitmap font
-        if (!FT_IS_SCALABLE(m_face))
+        if (!FT_IS_SCALABLE(m_data->face))
             return characterSize / 14.f;
 
-        return static_cast<float>(FT_MulFix(m_face->underline_thickness, m_face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
+        return static_cast<float>(FT_MulFix(m_data->face->underline_thickness, m_data->face->size->metrics.y_scale)) / unitsPerPixel / m_fontScale;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int characterSize, unsigned int& textureVersion)
     {
-        if (m_texture)
+        return getTextureAtIndex(characterSize, 0, textureVersion);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTextureAtIndex(unsigned int characterSize, unsigned int textureIndex, unsigned int& textureVersion)
+    {
+        if (!m_data)
+            return nullptr;
+
+        Page& page = getPage(static_cast<unsigned int>(characterSize * m_fontScale));
+        page.lastUsedFrame = m_data->frameCounter;
+        page.preloaded = false;
+        textureVersion = page.textureVersion;
+
+        if (textureIndex >= page.textures.size())
+            return nullptr;
+
+        PageTexture& pageTexture = page.textures[textureIndex];
+        if (!pageTexture.texture)
         {
-            textureVersion = m_textureVersion;
-            return m_texture;
+            pageTexture.texture = getBackend()->getRenderer()->createTexture();
+            pageTexture.texture->setDistanceField(page.distanceField);
+            pageTexture.texture->loadTextureOnly({page.textureSize, page.textureSize}, pageTexture.pixels.get(), m_isSmooth || page.distanceField);
+            pageTexture.dirtyRect = {};
+
+            ++m_data->statistics.fullUploads;
+            m_data->statistics.uploadedBytes += static_cast<std::uint64_t>(page.textureSize) * page.textureSize * 4;
+            return pageTexture.texture;
         }
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+        if ((pageTexture.dirtyRect.width == 0) || (pageTexture.dirtyRect.height == 0))
+            return pageTexture.texture;
+
+        // Only upload the pixels of the glyphs that were added since the texture was last updated
+        const UIntRect& rect = pageTexture.dirtyRect;
+        auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(rect.width * rect.height * 4);
+        for (unsigned int y = 0; y < rect.height; ++y)
+            std::memcpy(&pixels[y * rect.width * 4], &pageTexture.pixels[(((rect.top + y) * page.textureSize) + rect.left) * 4], rect.width * 4);
 
-        textureVersion = ++m_textureVersion;
-        return m_texture;
+        if (pageTexture.texture->updateTexturePart(rect, pixels.get()))
+        {
+            ++m_data->statistics.partialUploads;
+            m_data->statistics.uploadedBytes += static_cast<std::uint64_t>(rect.width) * rect.height * 4;
+        }
+        else // The texture doesn't support partial updates
+        {
+            pageTexture.texture->loadTextureOnly({page.textureSize, page.textureSize}, pageTexture.pixels.get(), m_isSmooth || page.distanceField);
+
+            ++m_data->statistics.fullUploads;
+            m_data->statistics.uploadedBytes += static_cast<std::uint64_t>(page.textureSize) * page.textureSize * 4;
+        }
+
+        pageTexture.dirtyRect = {};
+        return pageTexture.texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Vector2u BackendFontFreetype::getTextureSize(unsigned int)
+    Vector2u BackendFontFreetype::getTextureSize(unsigned int characterSize)
     {
-        return {m_textureSize, m_textureSize};
+        if (!m_data)
+            return {};
+
+        const Page& page = getPage(static_cast<unsigned int>(characterSize * m_fontScale));
+        return {page.textureSize, page.textureSize};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendFontFreetype::setSmooth(bool smooth)
     {
+        // Smooth and non-smooth glyphs are stored in different pages, so we don't need to change any texture here.
+        // This way fonts that share their glyphs don't have to use the same smooth setting.
         BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendFontFreetype::setFontScale(float scale)
     {
-        if (m_fontScale == scale)
+        // Glyphs are stored per scaled character size, so texts will automatically use other pages after the scale changes.
+        // The pages of the old scale are removed once they are no longer used.
+        BackendFont::setFontScale(scale);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setMaximumPageSize(unsigned int size)
+    {
+        m_maximumPageSize = size;
+        if (!m_data)
             return;
 
-        BackendFont::setFontScale(scale);
+        m_data->maximumPageSize = size;
+        for (auto& pair : m_data->pages)
+        {
+            Page& page = pair.second;
+            page.maximumPixels = std::max(static_cast<std::size_t>(size) * size, static_cast<std::size_t>(page.textureSize) * page.textureSize);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getMaximumPageSize() const
+    {
+        return m_data ? m_data->maximumPageSize : m_maximumPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+    void BackendFontFreetype::setEvictionDelay(unsigned int frames)
+    {
+        m_evictionDelay = frames;
+        if (m_data)
+            m_data->evictionDelay = frames;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    unsigned int BackendFontFreetype::getEvictionDelay() const
     {
-        Glyph glyph;
-        if (!m_face)
-            return glyph;
+        return m_data ? m_data->evictionDelay : m_evictionDelay;
+    }
 
-        if (!setCurrentSize(characterSize))
-            return glyph;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setDistanceFieldEnabled(bool enabled)
+    {
+        // Distance field glyphs are scaled from a fixed size, so their advances may differ slightly from the normal glyphs
+        if (enabled != m_distanceFieldEnabled)
+            clearMetricsTables();
+
+        m_distanceFieldEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isDistanceFieldEnabled() const
+    {
+        return m_distanceFieldEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontGlyphCacheStatistics BackendFontFreetype::getGlyphCacheStatistics() const
+    {
+        if (!m_data)
+            return {};
+
+        FontGlyphCacheStatistics statistics = m_data->statistics;
+        for (const auto& pair : m_data->pages)
+        {
+            const Page& page = pair.second;
+            statistics.pageCount += page.textures.size();
+            statistics.glyphCount += page.glyphs.size();
+            statistics.textureBytes += page.textures.size() * page.textureSize * page.textureSize * 4;
+        }
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::preloadGlyphs(char32_t firstCodePoint, char32_t lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold)
+    {
+        if (!m_data || (firstCodePoint > lastCodePoint))
+            return;
+
+        // The pages are determined here, as the settings of the font may have changed by the time the glyphs are merged.
+        // With distance fields, the glyphs of all character sizes are identical and only have to be rasterized once.
+        std::vector<PreloadedGlyph> glyphSizes;
+        const bool distanceField = isDistanceFieldUsed();
+        for (const unsigned int characterSize : characterSizes)
+        {
+            PreloadedGlyph glyphSize;
+            glyphSize.pageKey = getPageKey(static_cast<unsigned int>(characterSize * m_fontScale), distanceField);
+            glyphSize.distanceField = distanceField;
+            glyphSize.glyphCharacterSize = distanceField ? distanceFieldCharacterSize : static_cast<unsigned int>(characterSize * m_fontScale);
+            glyphSize.bold = bold;
+
+            if ((glyphSize.glyphCharacterSize == 0)
+             || (std::find_if(glyphSizes.begin(), glyphSizes.end(), [&glyphSize](const PreloadedGlyph& other){ return other.pageKey == glyphSize.pageKey; }) != glyphSizes.end()))
+                continue;
+
+            glyphSizes.push_back(std::move(glyphSize));
+        }
+
+        if (glyphSizes.empty())
+            return;
+
+        const unsigned int threadCount = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            ++m_data->runningPreloadThreads;
+            m_data->preloadThreads.emplace_back(&BackendFontFreetype::preloadGlyphsThread, m_data.get(), glyphSizes, firstCodePoint, lastCodePoint, i, threadCount);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isPreloadingGlyphs() const
+    {
+        if (!m_data)
+            return false;
+
+        // The running threads have to be checked first, as a thread adds its last glyphs before it stops running
+        if (m_data->runningPreloadThreads > 0)
+            return true;
+
+        const std::lock_guard<std::mutex> lock(m_data->preloadMutex);
+        return !m_data->preloadedGlyphs.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::frameDrawn()
+    {
+        if (!m_data)
+            return;
+
+        // Every font that shares the glyphs gets called once per frame, the frame is only counted by the last call
+        if (++m_data->frameDrawnCalls < m_data->fontCount)
+            return;
+
+        m_data->frameDrawnCalls = 0;
+        ++m_data->frameCounter;
+
+        if (!m_data->preloadThreads.empty())
+            mergePreloadedGlyphs();
+
+        for (auto it = m_data->pages.begin(); it != m_data->pages.end();)
+        {
+            Page& page = it->second;
+
+            // Remove the glyphs of character sizes that are no longer being drawn. Preloaded glyphs are kept until they get used.
+            if ((m_data->evictionDelay > 0) && !page.preloaded && (m_data->frameCounter - page.lastUsedFrame > m_data->evictionDelay))
+            {
+                m_data->statistics.evictedGlyphs += page.glyphs.size();
+                it = m_data->pages.erase(it);
+                continue;
+            }
+
+            // If a glyph didn't fit in the textures of the page then the page is recreated with larger textures
+            if (page.requiredTextureSize > page.textureSize)
+            {
+                m_data->statistics.evictedGlyphs += page.glyphs.size();
+                clearPage(page);
+                ++it;
+                continue;
+            }
+
+            // If the page uses too many textures then we start over with an empty page, which will only be filled with the glyphs
+            // that are still in use. If the page was just cleared then all glyphs are needed and the page has to stay large.
+            const std::size_t pixelCount = page.textures.size() * page.textureSize * page.textureSize;
+            if (pixelCount > page.maximumPixels)
+            {
+                if (m_data->frameCounter - page.lastClearedFrame <= 1)
+                    page.maximumPixels = pixelCount;
+                else
+                {
+                    m_data->statistics.evictedGlyphs += page.glyphs.size();
+                    clearPage(page);
+                }
+            }
+
+            ++it;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(Page& page, char32_t codePoint, unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness)
+    {
+        if (!m_data)
+            return {};
+
+        const RasterizedGlyph rasterizedGlyph = rasterizeGlyph(m_data->library, m_data->face, m_data->stroker, codePoint,
+                                                               scaledCharacterSize, bold, scaledOutlineThickness, page.distanceField);
+        return addGlyphToPage(page, rasterizedGlyph);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::RasterizedGlyph BackendFontFreetype::rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint,
+                                                                             unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness, bool distanceField)
+    {
+        RasterizedGlyph rasterizedGlyph;
+        Glyph& glyph = rasterizedGlyph.glyph;
+
+        if (!setCurrentSize(face, scaledCharacterSize))
+            return rasterizedGlyph;
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wold-style-cast"
 #endif
         // Load the glyph corresponding to the code point
         FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-        if (outlineThickness != 0)
+        if (scaledOutlineThickness != 0)
             flags |= FT_LOAD_NO_BITMAP;
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
-        if (FT_Load_Char(m_face, codePoint, flags) != 0)
-            return glyph;
+        if (FT_Load_Char(face, codePoint, flags) != 0)
+            return rasterizedGlyph;
 
         // Retrieve the glyph
         FT_Glyph glyphDesc;
-        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
-            return glyph;
+        if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+            return rasterizedGlyph;
 
         // Add an outline if requested and the font supports it
-        if ((outlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
+        if ((scaledOutlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
         {
             // Create the stroker if this is the first time an outline was requested with this font
-            if (!m_stroker)
-                FT_Stroker_New(m_library, &m_stroker);
+            if (!stroker)
+                FT_Stroker_New(library, &stroker);
 
-            if (m_stroker)
+            if (stroker)
             {
-                FT_Stroker_Set(m_stroker, static_cast<FT_Fixed>(outlineThickness * m_fontScale * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-                FT_Glyph_Stroke(&glyphDesc, m_stroker, true);
+                FT_Stroker_Set(stroker, static_cast<FT_Fixed>(scaledOutlineThickness * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+                FT_Glyph_Stroke(&glyphDesc, stroker, true);
             }
         }
 
@@ -405,7 +772,7 @@ namespace tgui
         if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
         {
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return rasterizedGlyph;
         }
         FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
         FT_Bitmap& bitmap = bitmapGlyph->bitmap;
@@ -413,15 +780,15 @@ namespace tgui
         // If bold was requested but the font didn't support outlines then apply bold here using a different (lower quality) method.
         // We have to cache the outline support bool because FT_Glyph_To_Bitmap changes format to FT_GLYPH_FORMAT_BITMAP.
         if (bold && !outlineSupport)
-            FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, boldWeight, boldWeight);
+            FT_Bitmap_Embolden(library, &bitmap, boldWeight, boldWeight);
 
         // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
         glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
         if (bold)
             glyph.advance += static_cast<float>(boldWeight) / unitsPerPixel;
 
-        glyph.lsbDelta = static_cast<float>(m_face->glyph->lsb_delta);
-        glyph.rsbDelta = static_cast<float>(m_face->glyph->rsb_delta);
+        glyph.lsbDelta = static_cast<float>(face->glyph->lsb_delta);
+        glyph.rsbDelta = static_cast<float>(face->glyph->rsb_delta);
 
         // Compute the glyph's bounding box
         glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
@@ -433,19 +800,30 @@ namespace tgui
         {
             // This branch will e.g. be executed when loading a space character. The glyph will have an advance but no bitmap.
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return rasterizedGlyph;
         }
 
-        // Find a good position for the new glyph into the texture.
-        // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
-        const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
-        glyph.textureRect.left += padding;
-        glyph.textureRect.top += padding;
-        glyph.textureRect.width -= 2 * padding;
-        glyph.textureRect.height -= 2 * padding;
+        // Distance field glyphs store the distance to the edge of the glyph instead of its coverage, so that they can be drawn
+        // at any size. The distance field extends beyond the bitmap, so the bounds of the glyph are enlarged to match.
+        if (distanceField)
+        {
+            rasterizedGlyph.pixels = createDistanceField(bitmap);
+            rasterizedGlyph.width = bitmap.width + (2 * distanceFieldSpread);
+            rasterizedGlyph.height = bitmap.rows + (2 * distanceFieldSpread);
+
+            glyph.bounds.left -= distanceFieldSpread;
+            glyph.bounds.top -= distanceFieldSpread;
+            glyph.bounds.width += 2 * distanceFieldSpread;
+            glyph.bounds.height += 2 * distanceFieldSpread;
+
+            FT_Done_Glyph(glyphDesc);
+            return rasterizedGlyph;
+        }
 
         // Extract the glyph's pixels from the bitmap
+        rasterizedGlyph.width = bitmap.width;
+        rasterizedGlyph.height = bitmap.rows;
+        rasterizedGlyph.pixels.resize(static_cast<std::size_t>(bitmap.width) * bitmap.rows);
         const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
         if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
         {
@@ -453,31 +831,71 @@ namespace tgui
             for (unsigned int y = 0; y < bitmap.rows; ++y)
             {
                 for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
-                }
+                    rasterizedGlyph.pixels[(y * bitmap.width) + x] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
             }
         }
         else
         {
             // Pixels are 8 bits gray levels
             for (unsigned int y = 0; y < bitmap.rows; ++y)
+                std::memcpy(&rasterizedGlyph.pixels[y * bitmap.width], &glyphBitmapPixels[static_cast<int>(y) * bitmap.pitch], bitmap.width);
+        }
+
+        FT_Done_Glyph(glyphDesc);
+        return rasterizedGlyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::addGlyphToPage(Page& page, const RasterizedGlyph& rasterizedGlyph)
+    {
+        Glyph glyph = rasterizedGlyph.glyph;
+        if ((rasterizedGlyph.width == 0) || (rasterizedGlyph.height == 0))
+            return glyph;
+
+        // Find a good position for the new glyph into the texture.
+        // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
+        const unsigned int padding = 2;
+        glyph.textureRect = findAvailableGlyphRect(page, rasterizedGlyph.width + (2 * padding), rasterizedGlyph.height + (2 * padding), glyph.textureIndex);
+        if ((glyph.textureRect.width == 0) || (glyph.textureRect.height == 0))
+        {
+            // The glyph is too large for the textures of the page, it won't be drawn until the page gets larger textures
+            glyph.bounds = {};
+            return glyph;
+        }
+
+        glyph.textureRect.left += padding;
+        glyph.textureRect.top += padding;
+        glyph.textureRect.width -= 2 * padding;
+        glyph.textureRect.height -= 2 * padding;
+
+        PageTexture& pageTexture = page.textures[glyph.textureIndex];
+        for (unsigned int y = 0; y < rasterizedGlyph.height; ++y)
+        {
+            for (unsigned int x = 0; x < rasterizedGlyph.width; ++x)
             {
-                for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
-                }
+                // The color channels remain white, just fill the alpha channel
+                const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * page.textureSize;
+                pageTexture.pixels[index * 4 + 3] = rasterizedGlyph.pixels[(y * rasterizedGlyph.width) + x];
             }
         }
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
+        // Mark the pixels as changed, so that they get uploaded to the texture before the texture is used again
+        if (pageTexture.texture)
+        {
+            UIntRect& dirtyRect = pageTexture.dirtyRect;
+            if ((dirtyRect.width == 0) || (dirtyRect.height == 0))
+                dirtyRect = glyph.textureRect;
+            else
+            {
+                const unsigned int left = std::min(dirtyRect.left, glyph.textureRect.left);
+                const unsigned int top = std::min(dirtyRect.top, glyph.textureRect.top);
+                const unsigned int right = std::max(dirtyRect.left + dirtyRect.width, glyph.textureRect.left + glyph.textureRect.width);
+                const unsigned int bottom = std::max(dirtyRect.top + dirtyRect.height, glyph.textureRect.top + glyph.textureRect.height);
+                dirtyRect = {left, top, right - left, bottom - top};
+            }
+        }
 
-        FT_Done_Glyph(glyphDesc);
         return glyph;
     }
 
@@ -485,90 +903,98 @@ namespace tgui
 
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
-        const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
-                                                         bold, outlineThickness * m_fontScale);
+        const unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+        unsigned int glyphCharacterSize = scaledCharacterSize;
+        float glyphOutlineThickness = outlineThickness * m_fontScale;
+        float scale = 1;
+
+        Page& page = getPage(scaledCharacterSize);
+        page.lastUsedFrame = m_data->frameCounter;
+        page.preloaded = false;
 
-        const auto it = m_glyphs.find(glyphKey);
-        if (it != m_glyphs.end())
+        // Distance field glyphs are rasterized once at a fixed size and are scaled to the requested character size
+        if (page.distanceField)
+        {
+            glyphCharacterSize = distanceFieldCharacterSize;
+            scale = static_cast<float>(scaledCharacterSize) / distanceFieldCharacterSize;
+            glyphOutlineThickness = (scale > 0) ? (glyphOutlineThickness / scale) : 0;
+        }
+
+        const std::uint64_t glyphKey = constructGlyphKey(codePoint, glyphCharacterSize, bold, glyphOutlineThickness);
+        auto it = page.glyphs.find(glyphKey);
+        if (it == page.glyphs.end())
+            it = page.glyphs.insert({glyphKey, loadGlyph(page, codePoint, glyphCharacterSize, bold, glyphOutlineThickness)}).first;
+
+        if (!page.distanceField)
             return it->second;
 
-        const Glyph& glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return m_glyphs.insert({glyphKey, glyph}).first->second;
+        Glyph glyph = it->second;
+        glyph.advance *= scale;
+        glyph.lsbDelta *= scale;
+        glyph.rsbDelta *= scale;
+        glyph.bounds = {glyph.bounds.left * scale, glyph.bounds.top * scale, glyph.bounds.width * scale, glyph.bounds.height * scale};
+        return glyph;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    UIntRect BackendFontFreetype::findAvailableGlyphRect(Page& page, unsigned int width, unsigned int height, unsigned int& textureIndex)
     {
         // Find the line that where the glyph fits well.
         // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
         Row* bestRow = nullptr;
         float bestRatio = 0;
-        for (auto& row : m_rows)
+        for (unsigned int i = 0; i < page.textures.size(); ++i)
         {
-            float ratio = static_cast<float>(height) / row.height;
+            for (auto& row : page.textures[i].rows)
+            {
+                float ratio = static_cast<float>(height) / row.height;
 
-            // Ignore rows that are either too small or too high
-            if ((ratio < 0.7f) || (ratio > 1.f))
-                continue;
+                // Ignore rows that are either too small or too high
+                if ((ratio < 0.7f) || (ratio > 1.f))
+                    continue;
 
-            // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
-                continue;
+                // Check if there's enough horizontal space left in the row
+                if (width > page.textureSize - row.width)
+                    continue;
 
-            // Make sure that this new row is the best found so far
-            if (ratio < bestRatio)
-                continue;
+                // Make sure that this new row is the best found so far
+                if (ratio < bestRatio)
+                    continue;
 
-            // The current row passed all the tests: we can select it
-            bestRow = &row;
-            bestRatio = ratio;
+                // The current row passed all the tests: we can select it
+                bestRow = &row;
+                bestRatio = ratio;
+                textureIndex = i;
+            }
         }
 
         // If we didn't find a matching row, create a new one (10% taller than the glyph)
         if (!bestRow)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
+            // The glyph has to fit in an empty texture. Otherwise the page will be recreated with larger textures.
             const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+            const unsigned int emptyTextureRow = 3; // First 2 rows contain pixels for underlining
+            if ((emptyTextureRow + rowHeight >= page.textureSize) || (width >= page.textureSize))
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
-
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
-
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
-                    {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
-                    }
-                }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
-                {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
-                }
+                unsigned int requiredTextureSize = page.textureSize * 2;
+                while ((emptyTextureRow + rowHeight >= requiredTextureSize) || (width >= requiredTextureSize))
+                    requiredTextureSize *= 2;
 
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
+                page.requiredTextureSize = std::max(page.requiredTextureSize, requiredTextureSize);
+                return {};
             }
 
-            // We can now create the new row
-            m_rows.emplace_back(m_nextRow, rowHeight);
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
+            // When the last texture is full, we don't resize it but add another texture of the same size.
+            // The existing textures remain valid, so texts that use them don't have to be updated.
+            if (page.textures.back().nextRow + rowHeight >= page.textureSize)
+                addPageTexture(page);
+
+            PageTexture& pageTexture = page.textures.back();
+            pageTexture.rows.emplace_back(pageTexture.nextRow, rowHeight);
+            pageTexture.nextRow += rowHeight;
+            bestRow = &pageTexture.rows.back();
+            textureIndex = static_cast<unsigned int>(page.textures.size() - 1);
         }
 
         // Find the glyph's rectangle on the selected row
@@ -581,33 +1007,245 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
+    BackendFontFreetype::Page& BackendFontFreetype::getPage(unsigned int scaledCharacterSize)
     {
-        unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
+        const bool distanceField = isDistanceFieldUsed();
+        return getPageWithKey(getPageKey(scaledCharacterSize, distanceField), distanceField);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    unsigned int BackendFontFreetype::getPageKey(unsigned int scaledCharacterSize, bool distanceField) const
+    {
+        return distanceField ? distanceFieldPageKey : ((scaledCharacterSize << 1) | (m_isSmooth ? 1u : 0u));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Page& BackendFontFreetype::getPageWithKey(unsigned int pageKey, bool distanceField)
+    {
+        const auto it = m_data->pages.find(pageKey);
+        if (it != m_data->pages.end())
+            return it->second;
+
+        Page& page = m_data->pages[pageKey];
+        page.distanceField = distanceField;
+        page.glyphCharacterSize = distanceField ? distanceFieldCharacterSize : (pageKey >> 1);
+        clearPage(page);
+        return page;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isDistanceFieldUsed() const
+    {
+        if (!m_distanceFieldEnabled || !isBackendSet())
+            return false;
+
+        const auto& renderer = getBackend()->getRenderer();
+        return renderer && renderer->supportsDistanceFieldTextures();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::clearPage(Page& page)
+    {
+        // The textures are large enough to contain quite some glyphs of the character size, without exceeding the maximum size
+        unsigned int textureSize = 128;
+        while ((textureSize < 8 * page.glyphCharacterSize) && (textureSize < m_data->maximumPageSize))
+            textureSize *= 2;
+        while (textureSize < page.requiredTextureSize)
+            textureSize *= 2;
+
+        page.glyphs.clear();
+        page.textures.clear();
+        page.textureSize = textureSize;
+        page.textureVersion = ++m_data->textureVersion;
+        page.maximumPixels = std::max(static_cast<std::size_t>(m_data->maximumPageSize) * m_data->maximumPageSize,
+                                      static_cast<std::size_t>(textureSize) * textureSize);
+        page.lastUsedFrame = m_data->frameCounter;
+        page.lastClearedFrame = m_data->frameCounter;
+
+        addPageTexture(page);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addPageTexture(Page& page)
+    {
+        const unsigned int textureSize = page.textureSize;
+
+        PageTexture pageTexture;
+        pageTexture.pixels = MakeUniqueForOverwrite<std::uint8_t[]>(textureSize * textureSize * 4);
+
+        std::uint8_t* pixelPtr = pageTexture.pixels.get();
+        for (unsigned int y = 0; y < textureSize; ++y)
+        {
+            for (unsigned int x = 0; x < textureSize; ++x)
+            {
+                // Color is always white, alpha channel contains whether the pixel is empty of not
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 255;
+                *pixelPtr++ = 0;
+            }
+        }
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                pageTexture.pixels[((textureSize * y) + x) * 4 + 3] = 255;
+        }
+
+        page.textures.push_back(std::move(pageTexture));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::setCurrentSize(FT_Face face, unsigned int scaledCharacterSize)
+    {
         // Don't call FT_Set_Pixel_Sizes if we don't have to
-        if (scaledCharacterSize == m_face->size->metrics.x_ppem)
+        if (scaledCharacterSize == face->size->metrics.x_ppem)
             return true;
 
-        return (FT_Set_Pixel_Sizes(m_face, 0, scaledCharacterSize) == FT_Err_Ok);
+        return (FT_Set_Pixel_Sizes(face, 0, scaledCharacterSize) == FT_Err_Ok);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::mergePreloadedGlyphs()
+    {
+        // Threads add their last glyphs before they stop running, so this has to be checked before taking the glyphs
+        const bool threadsFinished = (m_data->runningPreloadThreads == 0);
+
+        std::vector<PreloadedGlyph> preloadedGlyphs;
+        {
+            const std::lock_guard<std::mutex> lock(m_data->preloadMutex);
+            preloadedGlyphs.swap(m_data->preloadedGlyphs);
+        }
+
+        for (const auto& preloadedGlyph : preloadedGlyphs)
+        {
+            Page& page = getPageWithKey(preloadedGlyph.pageKey, preloadedGlyph.distanceField);
+            const std::uint64_t glyphKey = constructGlyphKey(preloadedGlyph.codePoint, preloadedGlyph.glyphCharacterSize, preloadedGlyph.bold, 0);
+            if (page.glyphs.find(glyphKey) == page.glyphs.end())
+                page.glyphs.insert({glyphKey, addGlyphToPage(page, preloadedGlyph.rasterizedGlyph)});
+
+            // The page may use more textures than the maximum page size allows, it shouldn't be cleared to make it smaller again
+            page.maximumPixels = std::max(page.maximumPixels, page.textures.size() * page.textureSize * page.textureSize);
+            page.lastUsedFrame = m_data->frameCounter;
+            page.preloaded = true;
+        }
+
+        if (threadsFinished)
+        {
+            for (auto& thread : m_data->preloadThreads)
+                thread.join();
+
+            m_data->preloadThreads.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::preloadGlyphsThread(FaceData* data, std::vector<PreloadedGlyph> glyphSizes, char32_t firstCodePoint,
+                                                  char32_t lastCodePoint, unsigned int offset, unsigned int stride)
+    {
+        // A freetype library and face can't be used by multiple threads at once, so each thread creates its own
+        FT_Library library = nullptr;
+        FT_Face face = nullptr;
+        FT_Stroker stroker = nullptr;
+        if ((FT_Init_FreeType(&library) == 0)
+         && (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(data->fileContents.get()), static_cast<FT_Long>(data->fileSize), 0, &face) == 0)
+         && (FT_Select_Charmap(face, FT_ENCODING_UNICODE) == 0))
+        {
+            // Glyphs are passed to the gui thread in small batches to limit the amount of locking
+            constexpr std::size_t batchSize = 64;
+            std::vector<PreloadedGlyph> batch;
+            for (std::uint64_t codePoint = std::uint64_t{firstCodePoint} + offset; codePoint <= lastCodePoint; codePoint += stride)
+            {
+                if (data->cancelPreloading)
+                    break;
+
+                if (FT_Get_Char_Index(face, static_cast<FT_ULong>(codePoint)) == 0)
+                    continue;
+
+                for (const auto& glyphSize : glyphSizes)
+                {
+                    PreloadedGlyph preloadedGlyph = glyphSize;
+                    preloadedGlyph.codePoint = static_cast<char32_t>(codePoint);
+                    preloadedGlyph.rasterizedGlyph = rasterizeGlyph(library, face, stroker, preloadedGlyph.codePoint,
+                                                                    glyphSize.glyphCharacterSize, glyphSize.bold, 0, glyphSize.distanceField);
+                    batch.push_back(std::move(preloadedGlyph));
+                }
+
+                if (batch.size() >= batchSize)
+                {
+                    const std::lock_guard<std::mutex> lock(data->preloadMutex);
+                    std::move(batch.begin(), batch.end(), std::back_inserter(data->preloadedGlyphs));
+                    batch.clear();
+                }
+            }
+
+            if (!batch.empty())
+            {
+                const std::lock_guard<std::mutex> lock(data->preloadMutex);
+                std::move(batch.begin(), batch.end(), std::back_inserter(data->preloadedGlyphs));
+            }
+        }
+
+        if (face)
+            FT_Done_Face(face);
+        if (library)
+            FT_Done_FreeType(library);
+
+        --data->runningPreloadThreads;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendFontFreetype::cleanup()
     {
-        if (m_stroker)
-            FT_Stroker_Done(m_stroker);
+        if (!m_data)
+            return;
 
-        if (m_face)
-            FT_Done_Face(m_face);
+        {
+            // The count is also changed by other fonts that find this face in the registry
+            const std::lock_guard<std::mutex> lock(loadedFacesMutex);
+            --m_data->fontCount;
+        }
+
+        m_data = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_library)
-            FT_Done_FreeType(m_library);
+    std::unordered_map<std::uint64_t, std::vector<std::weak_ptr<BackendFontFreetype::FaceData>>>& BackendFontFreetype::getLoadedFaces()
+    {
+        static std::unordered_map<std::uint64_t, std::vector<std::weak_ptr<FaceData>>> loadedFaces;
+        return loadedFaces;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::FaceData::~FaceData()
+    {
+        cancelPreloading = true;
+        for (auto& thread : preloadThreads)
+            thread.join();
+
+        if (stroker)
+            FT_Stroker_Done(stroker);
+
+        if (face)
+        {
+            const std::lock_guard<std::mutex> lock(sharedLibraryMutex);
+            FT_Done_Face(face);
+        }
 
-        m_library = nullptr;
-        m_face    = nullptr;
-        m_stroker = nullptr;
+        if (library)
+            releaseLibrary();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
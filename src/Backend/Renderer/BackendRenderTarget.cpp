@@ -28,6 +28,7 @@
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <array>
     #include <cmath>
 
@@ -42,14 +43,14 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawCircleHelperGetPoints(unsigned int nrPoints, float radius, float offset)
+    static void drawCircleHelperGetPoints(std::vector<Vector2f>& points, unsigned int nrPoints, float radius, float offset)
     {
 #if defined(__cpp_lib_math_constants) && (__cpp_lib_math_constants >= 201907L)
         const float twoPi = 2.f * std::numbers::pi_v<float>;
 #else
         const float twoPi = 2.f * 3.14159265359f;
 #endif
-        std::vector<Vector2f> points;
+        points.clear();
         points.reserve(nrPoints);
 
         for (unsigned int i = 0; i < nrPoints; ++i)
@@ -57,13 +58,11 @@ namespace tgui
             points.emplace_back(offset + radius + (radius * std::cos(twoPi * i / nrPoints)),
                                 offset + radius + (radius * std::sin(twoPi * i / nrPoints)));
         }
-
-        return points;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TGUI_NODISCARD static std::vector<Vector2f> drawRoundedRectHelperGetPoints(unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
+    static void drawRoundedRectHelperGetPoints(std::vector<Vector2f>& points, unsigned int nrCornerPoints, const Vector2f& size, float radius, float offset)
     {
         assert(nrCornerPoints != 0);
 
@@ -72,7 +71,7 @@ namespace tgui
 #else
         const float twoPi = 2.f * 3.14159265359f;
 #endif
-        std::vector<Vector2f> points;
+        points.clear();
         points.reserve(nrCornerPoints * 4);
 
         const unsigned int nrPointsInCircle = 4 * (nrCornerPoints - 1);
@@ -104,72 +103,157 @@ namespace tgui
             points.emplace_back(offset + size.x - radius + (radius * std::cos(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)),
                                 offset + size.y - radius - (radius * std::sin(twoPi * (3*(nrCornerPoints - 1) + i) / nrPointsInCircle)));
         }
-
-        return points;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawBordersAroundShape(BackendRenderTarget* renderTarget, const RenderStates& states,
-                                       const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
+    static void addBordersAroundShape(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                                      const std::vector<Vector2f>& outerPoints, const std::vector<Vector2f>& innerPoints, const Color& color)
     {
         TGUI_ASSERT(outerPoints.size() == innerPoints.size(), "Inner and outer ring of cicle border should have the same amount of points");
 
         // Create the vertices
-        std::vector<Vertex> vertices;
-        vertices.reserve(outerPoints.size() + innerPoints.size());
+        const auto firstVertex = static_cast<unsigned int>(vertices.size());
+        vertices.reserve(vertices.size() + outerPoints.size() + innerPoints.size());
         for (const auto& point : outerPoints)
             vertices.emplace_back(point, Vertex::Color(color));
         for (const auto& point : innerPoints)
             vertices.emplace_back(point, Vertex::Color(color));
 
         // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * (outerPoints.size() + innerPoints.size()));
-        for (std::size_t i = 0; i < outerPoints.size(); ++i)
+        const auto nrPoints = static_cast<unsigned int>(outerPoints.size());
+        indices.reserve(indices.size() + 3 * (outerPoints.size() + innerPoints.size()));
+        for (unsigned int i = 0; i < nrPoints; ++i)
         {
-            indices.push_back(static_cast<unsigned int>(i));
-            indices.push_back(static_cast<unsigned int>(i+1));
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i));
+            indices.push_back(firstVertex + i);
+            indices.push_back(firstVertex + i+1);
+            indices.push_back(firstVertex + nrPoints + i);
 
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i));
-            indices.push_back(static_cast<unsigned int>(outerPoints.size() + i+1));
-            indices.push_back(static_cast<unsigned int>(i+1));
+            indices.push_back(firstVertex + nrPoints + i);
+            indices.push_back(firstVertex + nrPoints + i+1);
+            indices.push_back(firstVertex + i+1);
         }
 
         // The last two triangles were given wrong indices by the loop (where there are "+1" in the code), and need to be overwitten to close the circle
-        indices[indices.size() - 1] = 0;
-        indices[indices.size() - 2] = static_cast<unsigned int>(outerPoints.size());
-        indices[indices.size() - 5] = 0;
-
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
+        indices[indices.size() - 1] = firstVertex;
+        indices[indices.size() - 2] = firstVertex + nrPoints;
+        indices[indices.size() - 5] = firstVertex;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void drawInnerShape(BackendRenderTarget* renderTarget, const RenderStates& states, const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
+    static void addInnerShape(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                              const std::vector<Vector2f>& points, const Vector2f& centerPoint, const Color& color)
     {
         // Create the vertices (one point in the middle of the circle and the others as provided in the 'points' parameter)
-        std::vector<Vertex> vertices;
-        vertices.reserve(1 + points.size());
+        const auto firstVertex = static_cast<unsigned int>(vertices.size());
+        vertices.reserve(vertices.size() + 1 + points.size());
         vertices.emplace_back(centerPoint, Vertex::Color(color));
         for (const auto& point : points)
             vertices.emplace_back(point, Vertex::Color(color));
 
         // Create the indices
-        std::vector<unsigned int> indices;
-        indices.reserve(3 * points.size());
-        for (std::size_t i = 1; i <= points.size(); ++i)
+        const auto nrPoints = static_cast<unsigned int>(points.size());
+        indices.reserve(indices.size() + 3 * points.size());
+        for (unsigned int i = 1; i <= nrPoints; ++i)
+        {
+            indices.push_back(firstVertex); // Center point
+            indices.push_back(firstVertex + i);
+            indices.push_back(firstVertex + i+1);
+        }
+        indices.back() = firstVertex + 1; // Last index was one too far and should use the first point again, to close the circle
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void generateCircleGeometry(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices,
+                                       float size, const Color& backgroundColor, float borderThickness, const Color& borderColor)
+    {
+        std::vector<Vector2f> outerPoints;
+        std::vector<Vector2f> innerPoints;
+
+        const float radius = size / 2.f;
+        const unsigned int nrPoints = static_cast<unsigned int>(std::ceil((radius + std::abs(borderThickness)) * 4));
+        if (borderThickness > 0)
+        {
+            drawCircleHelperGetPoints(outerPoints, nrPoints, radius + borderThickness, -borderThickness);
+            drawCircleHelperGetPoints(innerPoints, nrPoints, radius, 0);
+
+            addBordersAroundShape(vertices, indices, outerPoints, innerPoints, borderColor);
+            addInnerShape(vertices, indices, innerPoints, {radius, radius}, backgroundColor);
+        }
+        else if (borderThickness < 0)
+        {
+            drawCircleHelperGetPoints(outerPoints, nrPoints, radius, 0);
+            drawCircleHelperGetPoints(innerPoints, nrPoints, radius + borderThickness, -borderThickness);
+
+            addBordersAroundShape(vertices, indices, outerPoints, innerPoints, borderColor);
+            addInnerShape(vertices, indices, innerPoints, {radius, radius}, backgroundColor);
+        }
+        else // No outline
+        {
+            drawCircleHelperGetPoints(innerPoints, nrPoints, radius, 0);
+            addInnerShape(vertices, indices, innerPoints, {radius, radius}, backgroundColor);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void generateRoundedRectangleGeometry(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices, const Vector2f& size,
+                                                 const Color& backgroundColor, float radius, float borderWidth, const Color& borderColor)
+    {
+        // Radius can never be larger than half the width or height
+        if (radius > size.x / 2)
+            radius = size.x / 2;
+        if (radius > size.y / 2)
+            radius = size.y / 2;
+
+        std::vector<Vector2f> outerPoints;
+        const unsigned int nrCornerPoints = std::max(1u, static_cast<unsigned int>(std::ceil(radius * 2)));
+        drawRoundedRectHelperGetPoints(outerPoints, nrCornerPoints, size, radius, 0);
+
+        if (borderWidth > 0)
         {
-            indices.push_back(0); // Center point
-            indices.push_back(static_cast<unsigned int>(i));
-            indices.push_back(static_cast<unsigned int>(i+1));
+            radius = std::max(0.f, radius - borderWidth);
+            const Vector2f innerSize = {std::max(0.f, size.x - 2*borderWidth), std::max(0.f, size.y - 2*borderWidth)};
+            if (radius > innerSize.x / 2)
+                radius = innerSize.x / 2;
+            if (radius > innerSize.y / 2)
+                radius = innerSize.y / 2;
+
+            std::vector<Vector2f> innerPoints;
+            drawRoundedRectHelperGetPoints(innerPoints, nrCornerPoints, innerSize, radius, borderWidth);
+
+            addBordersAroundShape(vertices, indices, outerPoints, innerPoints, borderColor);
+            addInnerShape(vertices, indices, innerPoints, size/2.f, backgroundColor);
         }
-        indices.back() = 1; // Last index was one too far and should use the first point again, to close the circle
+        else // There are no borders
+            addInnerShape(vertices, indices, outerPoints, size/2.f, backgroundColor);
+    }
 
-        // Draw the triangles
-        renderTarget->drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), nullptr);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::ShapeGeometryKey::operator==(const ShapeGeometryKey& other) const
+    {
+        return (type == other.type) && (size == other.size) && (radius == other.radius) && (borderThickness == other.borderThickness)
+            && (backgroundColor == other.backgroundColor) && (borderColor == other.borderColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTarget::ShapeGeometryKeyHash::operator()(const ShapeGeometryKey& key) const
+    {
+        std::size_t hash = std::hash<int>()(static_cast<int>(key.type));
+        const auto combine = [&hash](std::size_t value){ hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+        combine(std::hash<float>()(key.size.x));
+        combine(std::hash<float>()(key.size.y));
+        combine(std::hash<float>()(key.radius));
+        combine(std::hash<float>()(key.borderThickness));
+        combine(std::hash<std::uint32_t>()((std::uint32_t{key.backgroundColor.getRed()} << 24) | (std::uint32_t{key.backgroundColor.getGreen()} << 16)
+                                           | (std::uint32_t{key.backgroundColor.getBlue()} << 8) | key.backgroundColor.getAlpha()));
+        combine(std::hash<std::uint32_t>()((std::uint32_t{key.borderColor.getRed()} << 24) | (std::uint32_t{key.borderColor.getGreen()} << 16)
+                                           | (std::uint32_t{key.borderColor.getBlue()} << 8) | key.borderColor.getAlpha()));
+        return hash;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,29 +508,8 @@ namespace tgui
 
     void BackendRenderTarget::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness, const Color& borderColor)
     {
-        const float radius = size / 2.f;
-        const unsigned int nrPoints = static_cast<unsigned int>(std::ceil((radius + std::abs(borderThickness)) * 4));
-        if (borderThickness > 0)
-        {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
-        }
-        else if (borderThickness < 0)
-        {
-            const std::vector<Vector2f>& outerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius + borderThickness, -borderThickness);
-
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
-        }
-        else // No outline
-        {
-            const std::vector<Vector2f>& innerPoints = drawCircleHelperGetPoints(nrPoints, radius, 0);
-            drawInnerShape(this, states, innerPoints, {radius, radius}, backgroundColor);
-        }
+        const ShapeGeometry& geometry = getCachedShapeGeometry({ShapeGeometryKey::Type::Circle, {size, size}, 0, borderThickness, backgroundColor, borderColor});
+        drawVertexArray(states, geometry.vertices.data(), geometry.vertices.size(), geometry.indices.data(), geometry.indices.size(), nullptr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,32 +517,49 @@ namespace tgui
     void BackendRenderTarget::drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor,
                                                    float radius, const Borders& borders, const Color& borderColor)
     {
-        // Radius can never be larger than half the width or height
-        if (radius > size.x / 2)
-            radius = size.x / 2;
-        if (radius > size.y / 2)
-            radius = size.y / 2;
+        const ShapeGeometry& geometry = getCachedShapeGeometry({ShapeGeometryKey::Type::RoundedRectangle, size, radius, borders.getLeft(), backgroundColor, borderColor});
+        drawVertexArray(states, geometry.vertices.data(), geometry.vertices.size(), geometry.indices.data(), geometry.indices.size(), nullptr);
+    }
 
-        const unsigned int nrCornerPoints = std::max(1u, static_cast<unsigned int>(std::ceil(radius * 2)));
-        const std::vector<Vector2f>& outerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, size, radius, 0);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        const float borderWidth = borders.getLeft();
-        if (borderWidth > 0)
+    const BackendRenderTarget::ShapeGeometry& BackendRenderTarget::getCachedShapeGeometry(const ShapeGeometryKey& key)
+    {
+        const auto generateShapeGeometry = [](ShapeGeometry& geometry, const ShapeGeometryKey& shapeKey){
+            if (shapeKey.type == ShapeGeometryKey::Type::Circle)
+                generateCircleGeometry(geometry.vertices, geometry.indices, shapeKey.size.x, shapeKey.backgroundColor, shapeKey.borderThickness, shapeKey.borderColor);
+            else
+                generateRoundedRectangleGeometry(geometry.vertices, geometry.indices, shapeKey.size, shapeKey.backgroundColor, shapeKey.radius, shapeKey.borderThickness, shapeKey.borderColor);
+        };
+
+        // A shape with NaN parameters can't be drawn. It also shouldn't be stored, as NaN never compares equal to itself and
+        // the shape would thus never be found in the cache while pushing other shapes out of it.
+        if (std::isnan(key.size.x) || std::isnan(key.size.y) || std::isnan(key.radius) || std::isnan(key.borderThickness))
         {
-            radius = std::max(0.f, radius - borderWidth);
-            const Vector2f innerSize = {std::max(0.f, size.x - 2*borderWidth), std::max(0.f, size.y - 2*borderWidth)};
-            if (radius > innerSize.x / 2)
-                radius = innerSize.x / 2;
-            if (radius > innerSize.y / 2)
-                radius = innerSize.y / 2;
+            static const ShapeGeometry emptyGeometry;
+            return emptyGeometry;
+        }
 
-            const std::vector<Vector2f>& innerPoints = drawRoundedRectHelperGetPoints(nrCornerPoints, innerSize, radius, borderWidth);
+        const auto it = m_shapeGeometryLookup.find(key);
+        if (it != m_shapeGeometryLookup.end())
+        {
+            m_shapeGeometryCache.splice(m_shapeGeometryCache.begin(), m_shapeGeometryCache, it->second);
+            return it->second->second;
+        }
 
-            drawBordersAroundShape(this, states, outerPoints, innerPoints, borderColor);
-            drawInnerShape(this, states, innerPoints, size/2.f, backgroundColor);
+        // Shapes that are no longer drawn (e.g. because a color is being animated) are eventually removed from the cache
+        if (m_shapeGeometryCache.size() >= MaxCachedShapeGeometries)
+        {
+            m_shapeGeometryLookup.erase(m_shapeGeometryCache.back().first);
+            m_shapeGeometryCache.pop_back();
         }
-        else // There are no borders
-            drawInnerShape(this, states, outerPoints, size/2.f, backgroundColor);
+
+        m_shapeGeometryCache.emplace_front(key, ShapeGeometry{});
+        m_shapeGeometryLookup.emplace(key, m_shapeGeometryCache.begin());
+
+        ShapeGeometry& geometry = m_shapeGeometryCache.front().second;
+        generateShapeGeometry(geometry, key);
+        return geometry;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,6 +570,115 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::drawToTexture(std::shared_ptr<BackendTexture>&, Vector2u, FloatRect,
+                                            const std::function<void(BackendRenderTarget&, const RenderStates&)>&)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::setDrawCallReorderingEnabled(bool enabled)
+    {
+        m_drawCallReorderingEnabled = enabled;
+        if (!enabled)
+            m_stateChangesRemovedByReordering = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isDrawCallReorderingEnabled() const
+    {
+        return m_drawCallReorderingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTarget::getStateChangesRemovedByReordering() const
+    {
+        return m_stateChangesRemovedByReordering;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<BackendRenderTarget::RecordedDrawCall> BackendRenderTarget::reorderDrawCalls(const std::vector<RecordedDrawCall>& drawCalls, std::vector<unsigned int>& indices)
+    {
+        // Limit how far back we look for a compatible batch, to keep the cost linear in the amount of primitives
+        const std::size_t maxBatchesToSearch = 64;
+
+        struct Batch
+        {
+            RecordedDrawCall state; // The bounds contain the union of the bounds of all primitives in the batch
+            std::vector<std::size_t> drawCallIndices;
+        };
+        std::vector<Batch> batches;
+
+        std::size_t originalStateChanges = 0;
+        for (std::size_t i = 0; i < drawCalls.size(); ++i)
+        {
+            const RecordedDrawCall& drawCall = drawCalls[i];
+            if ((i == 0) || (drawCall.texture != drawCalls[i-1].texture) || (drawCall.clipViewport != drawCalls[i-1].clipViewport))
+                ++originalStateChanges;
+
+            // Search backwards for a batch with the same state. The primitive can only be moved in front of the batches that
+            // come after it when it doesn't overlap with any of them, otherwise the painter's order would be broken.
+            std::size_t selectedBatch = batches.size();
+            const std::size_t lastBatchToSearch = (batches.size() > maxBatchesToSearch) ? (batches.size() - maxBatchesToSearch) : 0;
+            for (std::size_t batchIndex = batches.size(); batchIndex > lastBatchToSearch; --batchIndex)
+            {
+                const RecordedDrawCall& batchState = batches[batchIndex - 1].state;
+                if ((batchState.texture == drawCall.texture) && (batchState.clipViewport == drawCall.clipViewport))
+                {
+                    selectedBatch = batchIndex - 1;
+                    break;
+                }
+
+                if (batchState.bounds.intersects(drawCall.bounds))
+                    break;
+            }
+
+            if (selectedBatch < batches.size())
+            {
+                Batch& batch = batches[selectedBatch];
+                const float left = std::min(batch.state.bounds.left, drawCall.bounds.left);
+                const float top = std::min(batch.state.bounds.top, drawCall.bounds.top);
+                const float right = std::max(batch.state.bounds.left + batch.state.bounds.width, drawCall.bounds.left + drawCall.bounds.width);
+                const float bottom = std::max(batch.state.bounds.top + batch.state.bounds.height, drawCall.bounds.top + drawCall.bounds.height);
+                batch.state.bounds = {left, top, right - left, bottom - top};
+                batch.state.indexCount += drawCall.indexCount;
+                batch.drawCallIndices.push_back(i);
+            }
+            else
+                batches.push_back({drawCall, {i}});
+        }
+
+        // Rearrange the indices so that the primitives in each batch are stored next to each other
+        std::vector<unsigned int> reorderedIndices;
+        reorderedIndices.reserve(indices.size());
+
+        std::vector<RecordedDrawCall> mergedDrawCalls;
+        mergedDrawCalls.reserve(batches.size());
+        for (auto& batch : batches)
+        {
+            batch.state.firstIndex = reorderedIndices.size();
+            for (const std::size_t drawCallIndex : batch.drawCallIndices)
+            {
+                const RecordedDrawCall& drawCall = drawCalls[drawCallIndex];
+                reorderedIndices.insert(reorderedIndices.end(),
+                                        indices.begin() + static_cast<std::ptrdiff_t>(drawCall.firstIndex),
+                                        indices.begin() + static_cast<std::ptrdiff_t>(drawCall.firstIndex + drawCall.indexCount));
+            }
+
+            mergedDrawCalls.push_back(std::move(batch.state));
+        }
+
+        indices = std::move(reorderedIndices);
+        m_stateChangesRemovedByReordering = originalStateChanges - mergedDrawCalls.size();
+        return mergedDrawCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,20 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the vertices of the glyphs that are stored in the font texture with the given index
+        TGUI_NODISCARD std::vector<Vertex>& getTextureVertices(std::vector<std::shared_ptr<std::vector<Vertex>>>& verticesPerTexture, unsigned int textureIndex)
+        {
+            if (textureIndex >= verticesPerTexture.size())
+                verticesPerTexture.resize(textureIndex + 1);
+            if (!verticesPerTexture[textureIndex])
+                verticesPerTexture[textureIndex] = std::make_shared<std::vector<Vertex>>();
+
+            return *verticesPerTexture[textureIndex];
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f BackendText::getSize()
@@ -92,10 +106,15 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        TGUI_ASSERT(m_vertices != nullptr, "m_vertices should have already been created if m_verticesNeedUpdate is false");
         const Vertex::Color vertexColor(color);
-        for (std::size_t i = 0; i < m_vertices->size(); ++i)
-            (*m_vertices)[i].color = vertexColor;
+        for (const auto& vertices : m_vertices)
+        {
+            if (!vertices)
+                continue;
+
+            for (auto& vertex : *vertices)
+                vertex.color = vertexColor;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,11 +138,14 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        if (m_outlineVertices)
+        const Vertex::Color vertexColor(color);
+        for (const auto& vertices : m_outlineVertices)
         {
-            const Vertex::Color vertexColor(color);
-            for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
-                (*m_outlineVertices)[i].color = vertexColor;
+            if (!vertices)
+                continue;
+
+            for (auto& vertex : *vertices)
+                vertex.color = vertexColor;
         }
     }
 
@@ -213,7 +235,7 @@ namespace tgui
                 continue;
 
             // Apply the kerning offset
-            position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            position.x += m_font->getCachedKerning(prevChar, curChar, m_characterSize, isBold);
             prevChar = curChar;
 
             // Handle special characters
@@ -225,7 +247,7 @@ namespace tgui
             }
 
             // For regular characters, add the advance offset of the glyph
-            position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            position.x += m_font->getAdvance(curChar, m_characterSize, isBold);
         }
 
         return position;
@@ -257,11 +279,26 @@ namespace tgui
             texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
         }
 
-        if (includeOutline && m_outlineVertices && !m_outlineVertices->empty())
-            data.emplace_back(texture, m_outlineVertices);
+        // Glyphs may be spread over multiple font textures, which each need their own draw call.
+        // All outlines are added first, so that they are drawn behind the text.
+        const auto addVertexData = [this,&data,&texture](const std::vector<std::shared_ptr<std::vector<Vertex>>>& verticesPerTexture){
+            for (unsigned int i = 0; i < verticesPerTexture.size(); ++i)
+            {
+                if (!verticesPerTexture[i] || verticesPerTexture[i]->empty())
+                    continue;
+
+                unsigned int version;
+                auto textureAtIndex = (i == 0) ? texture : m_font->getTextureAtIndex(m_characterSize, i, version);
+                if (textureAtIndex)
+                    data.emplace_back(std::move(textureAtIndex), verticesPerTexture[i]);
+            }
+        };
 
-        if (includeText && m_vertices && !m_vertices->empty())
-            data.emplace_back(texture, m_vertices);
+        if (includeOutline)
+            addVertexData(m_outlineVertices);
+
+        if (includeText)
+            addVertexData(m_vertices);
 
         return data;
     }
@@ -275,15 +312,21 @@ namespace tgui
 
         m_verticesNeedUpdate = false;
 
-        if (!m_vertices)
-            m_vertices = std::make_shared<std::vector<Vertex>>();
-        if (!m_outlineVertices && (m_outlineThickness != 0))
-            m_outlineVertices = std::make_shared<std::vector<Vertex>>();
-
+        // The vertex arrays are reused to avoid reallocating them. Lines are always added to the first array.
         m_size = {0, 0};
-        m_vertices->clear();
-        if (m_outlineVertices)
-            m_outlineVertices->clear();
+        for (const auto& vertices : m_vertices)
+        {
+            if (vertices)
+                vertices->clear();
+        }
+        for (const auto& vertices : m_outlineVertices)
+        {
+            if (vertices)
+                vertices->clear();
+        }
+
+        std::vector<Vertex>& lineVertices = getTextureVertices(m_vertices, 0);
+        std::vector<Vertex>* outlineLineVertices = (m_outlineThickness != 0) ? &getTextureVertices(m_outlineVertices, 0) : nullptr;
 
         if (m_characterSize == 0)
             return;
@@ -322,24 +365,24 @@ namespace tgui
                 continue;
 
             // Apply the kerning offset
-            x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            x += m_font->getCachedKerning(prevChar, curChar, m_characterSize, isBold);
 
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+                addLine(lineVertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(*outlineLineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             // If we're using the strike through style and there's a new line, draw a line across all characters
             if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+                addLine(lineVertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(*outlineLineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             prevChar = curChar;
@@ -373,7 +416,7 @@ namespace tgui
                 float right  = glyph.bounds.left + glyph.bounds.width;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(getTextureVertices(m_outlineVertices, glyph.textureIndex), {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -381,7 +424,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(getTextureVertices(m_vertices, glyph.textureIndex), {x, y}, vertexFillColor, glyph, fontScale, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -396,19 +439,19 @@ namespace tgui
         // If we're using the underlined style, add the last line
         if (isUnderlined && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+            addLine(lineVertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(*outlineLineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // If we're using the strike through style, add the last line across all characters
         if (isStrikeThrough && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+            addLine(lineVertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(*outlineLineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // The height of a line can sometimes be slightly larger than the line spacing returned by the font.
@@ -425,17 +468,19 @@ namespace tgui
             const float textureWidth = static_cast<float>(textureSize.x);
             const float textureHeight = static_cast<float>(textureSize.y);
 
-            for (auto& vertex : *m_vertices)
-            {
-                vertex.texCoords.x /= textureWidth;
-                vertex.texCoords.y /= textureHeight;
-            }
-            if (m_outlineVertices)
+            // All textures of a character size have the same size
+            for (const auto* verticesPerTexture : {&m_vertices, &m_outlineVertices})
             {
-                for (auto& vertex : *m_outlineVertices)
+                for (const auto& vertices : *verticesPerTexture)
                 {
-                    vertex.texCoords.x /= textureWidth;
-                    vertex.texCoords.y /= textureHeight;
+                    if (!vertices)
+                        continue;
+
+                    for (auto& vertex : *vertices)
+                    {
+                        vertex.texCoords.x /= textureWidth;
+                        vertex.texCoords.y /= textureHeight;
+                    }
                 }
             }
         }
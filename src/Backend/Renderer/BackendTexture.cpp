@@ -24,6 +24,10 @@
 
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -55,6 +59,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::updateTexturePart(UIntRect, const std::uint8_t*)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updatePixels(UIntRect area, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT(m_pixels, "BackendTexture::updatePixels can only be called on a texture that stores its pixels");
+        TGUI_ASSERT((area.left + area.width <= m_imageSize.x) && (area.top + area.height <= m_imageSize.y), "BackendTexture::updatePixels called with area outside texture");
+
+        for (unsigned int y = 0; y < area.height; ++y)
+            std::memcpy(&m_pixels[((area.top + y) * m_imageSize.x + area.left) * 4], &pixels[y * area.width * 4], area.width * 4);
+
+        if (updateTexturePart(area, pixels))
+            return true;
+
+        return load(m_imageSize, std::move(m_pixels), m_isSmooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -76,6 +103,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTexture::setPremultipliedAlpha(bool premultiplied)
+    {
+        m_premultipliedAlpha = premultiplied;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isPremultipliedAlpha() const
+    {
+        return m_premultipliedAlpha;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTexture::setDistanceField(bool distanceField)
+    {
+        m_distanceField = distanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isDistanceField() const
+    {
+        return m_distanceField;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
         if (!m_pixels)
@@ -32,6 +32,7 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <numeric>
 #endif
 
@@ -66,11 +67,17 @@ namespace tgui
                 "#version 310 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool distanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (distanceField) {\n"
+                "        float smoothing = fwidth(texColor.a) * 0.5;\n"
+                "        texColor.a = smoothstep(0.5 - smoothing, 0.5 + smoothing, texColor.a);\n"
+                "    }\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -92,11 +99,17 @@ namespace tgui
                 "#version 300 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool distanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (distanceField) {\n"
+                "        float smoothing = fwidth(texColor.a) * 0.5;\n"
+                "        texColor.a = smoothstep(0.5 - smoothing, 0.5 + smoothing, texColor.a);\n"
+                "    }\n"
+                "    outColor = texColor * color;\n"
                 "}";
         }
         else // No GLES 3 support
@@ -116,12 +129,25 @@ namespace tgui
                 "}";
             fragmentShaderSource =
                 "#version 100\n"
+                "#ifdef GL_OES_standard_derivatives\n"
+                "#extension GL_OES_standard_derivatives : enable\n"
+                "#endif\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform bool distanceField;\n"
                 "varying vec4 color;\n"
                 "varying vec2 texCoord;\n"
                 "void main() {\n"
-                "    gl_FragColor = texture2D(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture2D(uTexture, texCoord);\n"
+                "    if (distanceField) {\n"
+                "#ifdef GL_OES_standard_derivatives\n"
+                "        float smoothing = fwidth(texColor.a) * 0.5;\n"
+                "#else\n"
+                "        float smoothing = 0.1;\n"
+                "#endif\n"
+                "        texColor.a = smoothstep(0.5 - smoothing, 0.5 + smoothing, texColor.a);\n"
+                "    }\n"
+                "    gl_FragColor = texColor * color;\n"
                 "}";
         }
 
@@ -187,6 +213,8 @@ namespace tgui
                 throw Exception{U"Failed to initialize BackendRenderTargetGLES2: projectionMatrix uniform wasn't found in shader program"};
         }
 
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "distanceField");
+
         if (!TGUI_GLAD_GL_ES_VERSION_3_0)
         {
             const int positionShaderLocation = glGetAttribLocation(m_shaderProgram, "inPosition");
@@ -218,6 +246,9 @@ namespace tgui
 
     BackendRenderTargetGLES2::~BackendRenderTargetGLES2()
     {
+        if (!m_frameBuffers.empty())
+            TGUI_GL_CHECK(glDeleteFramebuffers(static_cast<GLsizei>(m_frameBuffers.size()), m_frameBuffers.data()));
+
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
 
@@ -307,12 +338,49 @@ namespace tgui
 
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
+        m_premultipliedBlending = false;
+        m_distanceFieldShaderEnabled = false;
+        TGUI_GL_CHECK(glUniform1i(m_distanceFieldShaderUniformLocation, 0));
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
 
+        m_drawCallCount = 0;
+        m_batchingActive = m_batchingEnabled || m_drawCallReorderingEnabled;
+        m_clipViewport = m_viewport;
+        m_clipRect = m_viewRect;
+        if (m_batchingActive)
+        {
+            // Orphan the buffers from the previous frame, so that we don't have to wait for the GPU to finish using them
+            m_vertexBufferOffset = 0;
+            m_indexBufferOffset = 0;
+            if (m_vertexBufferSize > 0)
+                TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vertexBufferSize * sizeof(Vertex)), nullptr, GL_DYNAMIC_DRAW));
+            if (m_indexBufferSize > 0)
+                TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_indexBufferSize * sizeof(GLuint)), nullptr, GL_DYNAMIC_DRAW));
+
+            // The vertices are already transformed on the CPU, so the shader only needs the projection matrix
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+        }
+        else // The buffers are reallocated on every draw call when not batching, so their size will no longer be known
+        {
+            m_vertexBufferSize = 0;
+            m_indexBufferSize = 0;
+        }
+
         // Draw the widgets
         root->draw(*this, {});
 
+        if (m_drawCallReorderingEnabled)
+            flushRecordedDrawCalls();
+        else
+            flushBatch();
+        m_drawCallCountLastFrame = m_drawCallCount;
+
         m_currentTexture = nullptr;
+        if (m_premultipliedBlending)
+        {
+            m_premultipliedBlending = false;
+            updateBlendFunc();
+        }
 
         // Restore the old state
         if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -346,26 +414,47 @@ namespace tgui
     void BackendRenderTargetGLES2::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
+        if (m_batchingActive && m_drawCallReorderingEnabled)
+        {
+            recordDrawCall(states, vertices, vertexCount, indices, indexCount, texture);
+            return;
+        }
+
+        if (m_batchingActive)
         {
-            if (texture)
+            // Vertices with a different texture can't be part of the same draw call
+            if (m_currentTexture != texture)
             {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
-                m_currentTexture = std::static_pointer_cast<BackendTextureGLES2>(texture);
+                flushBatch();
+                changeTexture(texture);
+            }
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+            // Transform the vertices on the CPU, so that vertices from different draw calls can share the same uniform
+            const std::size_t firstVertex = m_vertexBufferOffset + m_batchVertices.size();
+            for (std::size_t i = 0; i < vertexCount; ++i)
+            {
+                m_batchVertices.push_back(vertices[i]);
+                m_batchVertices.back().position = states.transform.transformPoint(vertices[i].position);
             }
-            else
+
+            if (indices)
+            {
+                for (std::size_t i = 0; i < indexCount; ++i)
+                    m_batchIndices.push_back(static_cast<unsigned int>(firstVertex + indices[i]));
+            }
+            else // No indices were given, all vertices need to be drawn in the order they were provided
             {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                    m_batchIndices.push_back(static_cast<unsigned int>(firstVertex + i));
             }
+            return;
         }
 
+        changeTexture(texture);
+
         // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
         // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        // Batch rendering (see setBatchingEnabled) is much faster though.
         TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
 
         const Transform finalTransform = m_projectionTransform * states.transform;
@@ -380,18 +469,84 @@ namespace tgui
         }
         else // No indices were given, all vertices need to be drawn in the order they were provided
             TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+
+        ++m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::setBatchingEnabled(bool enabled)
+    {
+        m_batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetGLES2::getDrawCallCount() const
+    {
+        return m_drawCallCountLastFrame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::flushBatch()
+    {
+        // While primitives are being recorded for reordering, the indices in the batch belong to the recorded draw calls
+        if (m_batchingActive && m_drawCallReorderingEnabled)
+        {
+            flushRecordedDrawCalls();
+            return;
+        }
+
+        if (m_batchIndices.empty())
+        {
+            m_batchVertices.clear();
+            return;
+        }
+
+        uploadBatch();
+
+        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_batchIndices.size()), GL_UNSIGNED_INT,
+                                     reinterpret_cast<GLvoid*>(m_indexBufferOffset * sizeof(GLuint))));
+        ++m_drawCallCount;
+
+        m_vertexBufferOffset += m_batchVertices.size();
+        m_indexBufferOffset += m_batchIndices.size();
+        m_batchVertices.clear();
+        m_batchIndices.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetGLES2::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        // When recording the draw calls for reordering, the clipping is stored with each primitive instead of being applied
+        if (m_batchingActive && m_drawCallReorderingEnabled)
+        {
+            m_clipRect = clipRect;
+            m_clipViewport = clipViewport;
+            if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
+                m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
+            else
+                m_pixelsPerPoint = {1, 1};
+            return;
+        }
+
+        // Vertices that were batched with the old clipping rectangle have to be drawn before changing the scissor rectangle
+        flushBatch();
+
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
 
-            TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
-                                    static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+            setScissor(clipViewport);
         }
         else // Clip the entire window
         {
@@ -446,6 +601,287 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::uploadBatch()
+    {
+        // If the batch doesn't fit in the remaining part of the buffers then we orphan them and allocate larger ones.
+        // The indices were calculated relative to the old offset in the vertex buffer, so they need to be corrected.
+        if ((m_vertexBufferOffset + m_batchVertices.size() > m_vertexBufferSize) || (m_indexBufferOffset + m_batchIndices.size() > m_indexBufferSize))
+        {
+            const auto oldVertexBufferOffset = static_cast<unsigned int>(m_vertexBufferOffset);
+            for (auto& index : m_batchIndices)
+                index -= oldVertexBufferOffset;
+
+            m_vertexBufferSize = std::max(m_batchVertices.size(), 2 * m_vertexBufferSize);
+            m_indexBufferSize = std::max(m_batchIndices.size(), 2 * m_indexBufferSize);
+            m_vertexBufferOffset = 0;
+            m_indexBufferOffset = 0;
+
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vertexBufferSize * sizeof(Vertex)), nullptr, GL_DYNAMIC_DRAW));
+            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_indexBufferSize * sizeof(GLuint)), nullptr, GL_DYNAMIC_DRAW));
+        }
+
+        // Write the batch behind the data of the previous batches in this frame, so that we never overwrite data that is still in use
+        TGUI_GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(m_vertexBufferOffset * sizeof(Vertex)),
+                                      static_cast<GLsizeiptr>(m_batchVertices.size() * sizeof(Vertex)), m_batchVertices.data()));
+        TGUI_GL_CHECK(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLintptr>(m_indexBufferOffset * sizeof(GLuint)),
+                                      static_cast<GLsizeiptr>(m_batchIndices.size() * sizeof(GLuint)), m_batchIndices.data()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::recordDrawCall(const RenderStates& states, const Vertex* vertices,
+        std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        // Nothing will be visible when everything is being clipped
+        if ((m_clipViewport.width <= 0) || (m_clipViewport.height <= 0) || (vertexCount == 0))
+            return;
+
+        const auto firstVertex = static_cast<unsigned int>(m_batchVertices.size());
+        const std::size_t firstIndex = m_batchIndices.size();
+
+        Vector2f minPos = states.transform.transformPoint(vertices[0].position);
+        Vector2f maxPos = minPos;
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            m_batchVertices.push_back(vertices[i]);
+
+            Vector2f& pos = m_batchVertices.back().position;
+            pos = states.transform.transformPoint(vertices[i].position);
+            minPos = {std::min(minPos.x, pos.x), std::min(minPos.y, pos.y)};
+            maxPos = {std::max(maxPos.x, pos.x), std::max(maxPos.y, pos.y)};
+        }
+
+        if (indices)
+        {
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_batchIndices.push_back(firstVertex + indices[i]);
+        }
+        else // No indices were given, all vertices need to be drawn in the order they were provided
+        {
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchIndices.push_back(firstVertex + static_cast<unsigned int>(i));
+        }
+
+        // Only the part of the primitive that lies inside the clipping rectangle can overlap with other primitives
+        const float left = std::max(minPos.x, m_clipRect.left);
+        const float top = std::max(minPos.y, m_clipRect.top);
+        const float right = std::min(maxPos.x, m_clipRect.left + m_clipRect.width);
+        const float bottom = std::min(maxPos.y, m_clipRect.top + m_clipRect.height);
+        const FloatRect bounds{left, top, std::max(0.f, right - left), std::max(0.f, bottom - top)};
+
+        m_recordedDrawCalls.push_back({texture, m_clipViewport, bounds, firstIndex, m_batchIndices.size() - firstIndex});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::flushRecordedDrawCalls()
+    {
+        if (m_recordedDrawCalls.empty())
+        {
+            m_batchVertices.clear();
+            m_batchIndices.clear();
+            return;
+        }
+
+        const std::vector<RecordedDrawCall> drawCalls = reorderDrawCalls(m_recordedDrawCalls, m_batchIndices);
+        uploadBatch();
+
+        FloatRect currentClipViewport;
+        for (std::size_t i = 0; i < drawCalls.size(); ++i)
+        {
+            const RecordedDrawCall& drawCall = drawCalls[i];
+            if ((i == 0) || (drawCall.clipViewport != currentClipViewport))
+            {
+                currentClipViewport = drawCall.clipViewport;
+                setScissor(currentClipViewport);
+            }
+
+            changeTexture(drawCall.texture);
+
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(drawCall.indexCount), GL_UNSIGNED_INT,
+                                         reinterpret_cast<GLvoid*>((m_indexBufferOffset + drawCall.firstIndex) * sizeof(GLuint))));
+            ++m_drawCallCount;
+        }
+
+        m_vertexBufferOffset += m_batchVertices.size();
+        m_indexBufferOffset += m_batchIndices.size();
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+        m_recordedDrawCalls.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::changeTexture(const std::shared_ptr<BackendTexture>& texture)
+    {
+        if (m_currentTexture == texture)
+            return;
+
+        // Textures that were drawn to by drawToTexture need a different blend function
+        const bool premultiplied = texture && texture->isPremultipliedAlpha();
+        if (premultiplied != m_premultipliedBlending)
+        {
+            m_premultipliedBlending = premultiplied;
+            updateBlendFunc();
+        }
+
+        // Font textures may store a distance field instead of the glyph coverage
+        const bool distanceField = texture && texture->isDistanceField();
+        if (distanceField != m_distanceFieldShaderEnabled)
+        {
+            m_distanceFieldShaderEnabled = distanceField;
+            TGUI_GL_CHECK(glUniform1i(m_distanceFieldShaderUniformLocation, distanceField ? 1 : 0));
+        }
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
+            m_currentTexture = std::static_pointer_cast<BackendTextureGLES2>(texture);
+
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+        }
+        else
+        {
+            m_currentTexture = nullptr;
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::drawToTexture(std::shared_ptr<BackendTexture>& texture, Vector2u textureSize, FloatRect area,
+                                                    const std::function<void(BackendRenderTarget&, const RenderStates&)>& drawFunc)
+    {
+        if ((textureSize.x == 0) || (textureSize.y == 0) || (area.width <= 0) || (area.height <= 0))
+            return false;
+
+        if (!texture || (texture->getSize() != textureSize))
+        {
+            auto newTexture = std::make_shared<BackendTextureGLES2>();
+            if (!newTexture->loadTextureOnly(textureSize, nullptr, false))
+                return false;
+
+            newTexture->setPremultipliedAlpha(true);
+            texture = newTexture;
+        }
+
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureGLES2>(texture), "BackendRenderTargetGLES2 requires textures of type BackendTextureGLES2");
+
+        // Everything that was drawn so far has to end up in the current framebuffer before switching to the texture
+        flushBatch();
+
+        if (m_frameBuffers.size() <= m_textureDrawDepth)
+        {
+            GLuint frameBuffer;
+            TGUI_GL_CHECK(glGenFramebuffers(1, &frameBuffer));
+            m_frameBuffers.push_back(frameBuffer);
+        }
+
+        // Store the state that is needed to continue drawing to the old framebuffer afterwards
+        GLint oldFrameBuffer = 0;
+        TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &oldFrameBuffer));
+        GLint oldViewportGL[4];
+        TGUI_GL_CHECK(glGetIntegerv(GL_VIEWPORT, static_cast<GLint*>(oldViewportGL)));
+        GLint oldScissorGL[4];
+        TGUI_GL_CHECK(glGetIntegerv(GL_SCISSOR_BOX, static_cast<GLint*>(oldScissorGL)));
+        GLfloat oldClearColor[4];
+        TGUI_GL_CHECK(glGetFloatv(GL_COLOR_CLEAR_VALUE, static_cast<GLfloat*>(oldClearColor)));
+
+        const FloatRect oldViewRect = m_viewRect;
+        const FloatRect oldViewport = m_viewport;
+        const Vector2f oldTargetSize = m_targetSize;
+        const Transform oldProjectionTransform = m_projectionTransform;
+        const Vector2f oldPixelsPerPoint = m_pixelsPerPoint;
+        const FloatRect oldClipRect = m_clipRect;
+        const FloatRect oldClipViewport = m_clipViewport;
+        std::vector<std::pair<FloatRect, FloatRect>> oldClipLayers;
+        oldClipLayers.swap(m_clipLayers);
+
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_frameBuffers[m_textureDrawDepth]));
+        TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                                             std::static_pointer_cast<BackendTextureGLES2>(texture)->getInternalTexture(), 0));
+        ++m_textureDrawDepth;
+
+        const Vector2f textureSizeF{static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)};
+        BackendRenderTarget::setView(area, {{0, 0}, textureSizeF}, textureSizeF);
+
+        // The first row of a framebuffer is at the bottom, so the projection is flipped vertically to store the image in the
+        // same order as a loaded texture. This allows drawing the texture like any other texture afterwards.
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({-1 - (2.f * (area.left / area.width)), -1 - (2.f * (area.top / area.height))});
+        m_projectionTransform.scale({2.f / area.width, 2.f / area.height});
+
+        m_pixelsPerPoint = {textureSizeF.x / area.width, textureSizeF.y / area.height};
+        m_clipRect = area;
+        m_clipViewport = {{0, 0}, textureSizeF};
+
+        TGUI_GL_CHECK(glViewport(0, 0, static_cast<GLsizei>(textureSize.x), static_cast<GLsizei>(textureSize.y)));
+        TGUI_GL_CHECK(glScissor(0, 0, static_cast<GLsizei>(textureSize.x), static_cast<GLsizei>(textureSize.y)));
+        TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        TGUI_GL_CHECK(glClearColor(oldClearColor[0], oldClearColor[1], oldClearColor[2], oldClearColor[3]));
+
+        updateBlendFunc();
+        if (m_batchingActive)
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+        drawFunc(*this, {});
+
+        flushBatch();
+        --m_textureDrawDepth;
+
+        // Continue drawing where we left off
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(oldFrameBuffer)));
+        TGUI_GL_CHECK(glViewport(oldViewportGL[0], oldViewportGL[1], static_cast<GLsizei>(oldViewportGL[2]), static_cast<GLsizei>(oldViewportGL[3])));
+        TGUI_GL_CHECK(glScissor(oldScissorGL[0], oldScissorGL[1], static_cast<GLsizei>(oldScissorGL[2]), static_cast<GLsizei>(oldScissorGL[3])));
+
+        m_viewRect = oldViewRect;
+        m_viewport = oldViewport;
+        m_targetSize = oldTargetSize;
+        m_projectionTransform = oldProjectionTransform;
+        m_pixelsPerPoint = oldPixelsPerPoint;
+        m_clipRect = oldClipRect;
+        m_clipViewport = oldClipViewport;
+        m_clipLayers.swap(oldClipLayers);
+
+        updateBlendFunc();
+        if (m_batchingActive)
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::setScissor(const FloatRect& clipViewport)
+    {
+        // The y coordinate of the scissor box starts at the bottom of the window, but textures are drawn upside down
+        const float bottom = (m_textureDrawDepth > 0) ? clipViewport.top : (m_targetSize.y - clipViewport.top - clipViewport.height);
+        TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(bottom),
+                                static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::updateBlendFunc()
+    {
+        if (m_premultipliedBlending)
+        {
+            // The color was already multiplied with the alpha channel when the texture was drawn
+            TGUI_GL_CHECK(glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        }
+        else if (m_textureDrawDepth > 0)
+        {
+            // The alpha channel of the texture has to stay correct when drawing on top of transparent pixels.
+            // This results in a texture with premultiplied alpha.
+            TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        }
+        else
+            TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
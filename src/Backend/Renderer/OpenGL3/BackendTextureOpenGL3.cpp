@@ -99,6 +99,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureOpenGL3::updateTexturePart(UIntRect area, const std::uint8_t* pixels)
+    {
+        if ((m_textureId == 0) || !pixels || (area.left + area.width > m_imageSize.x) || (area.top + area.height > m_imageSize.y))
+            return false;
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(area.left), static_cast<GLint>(area.top),
+                                      static_cast<GLsizei>(area.width), static_cast<GLsizei>(area.height), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        // Restore the texture that was bound when this function was called
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureOpenGL3::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -79,6 +79,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureRaylib::updateTexturePart(UIntRect area, const std::uint8_t* pixels)
+    {
+        if (!m_texture.id || !pixels || (area.left + area.width > m_imageSize.x) || (area.top + area.height > m_imageSize.y))
+            return false;
+
+        const Rectangle rect{static_cast<float>(area.left), static_cast<float>(area.top),
+                             static_cast<float>(area.width), static_cast<float>(area.height)};
+        UpdateTextureRec(m_texture, rect, pixels);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureRaylib::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
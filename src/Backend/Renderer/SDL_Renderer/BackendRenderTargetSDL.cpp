@@ -203,6 +203,78 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSDL::drawToTexture(std::shared_ptr<BackendTexture>& texture, Vector2u textureSize, FloatRect area,
+                                               const std::function<void(BackendRenderTarget&, const RenderStates&)>& drawFunc)
+    {
+        if (!m_renderer || (textureSize.x == 0) || (textureSize.y == 0) || (area.width <= 0) || (area.height <= 0))
+            return false;
+
+        if (!texture || (texture->getSize() != textureSize))
+        {
+            SDL_Texture* textureSDL = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET,
+                                                        static_cast<int>(textureSize.x), static_cast<int>(textureSize.y));
+            if (!textureSDL)
+                return false;
+
+            auto newTexture = std::make_shared<BackendTextureSDL>(m_renderer);
+            newTexture->replaceInternalTexture(textureSDL);
+            newTexture->setPremultipliedAlpha(true);
+            texture = newTexture;
+        }
+
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(texture), "BackendRenderTargetSDL requires textures of type BackendTextureSDL");
+
+        // Store the state that is needed to continue drawing to the old target afterwards
+        SDL_Texture* oldRenderTarget = SDL_GetRenderTarget(m_renderer);
+
+        SDL_Rect oldClipRect;
+        const bool oldClipEnabled = SDL_RenderClipEnabled(m_renderer);
+        if (oldClipEnabled)
+            SDL_GetRenderClipRect(m_renderer, &oldClipRect);
+
+        SDL_Rect oldViewportSDL;
+        SDL_GetRenderViewport(m_renderer, &oldViewportSDL);
+
+        Uint8 oldDrawColor[4];
+        SDL_GetRenderDrawColor(m_renderer, &oldDrawColor[0], &oldDrawColor[1], &oldDrawColor[2], &oldDrawColor[3]);
+
+        const FloatRect oldViewRect = m_viewRect;
+        const FloatRect oldViewport = m_viewport;
+        const Vector2f oldTargetSize = m_targetSize;
+        const Vector2f oldPixelsPerPoint = m_pixelsPerPoint;
+        std::vector<std::pair<FloatRect, FloatRect>> oldClipLayers;
+        oldClipLayers.swap(m_clipLayers);
+
+        // SDL_BLENDMODE_BLEND already results in premultiplied colors when drawing on a transparent texture
+        SDL_SetRenderTarget(m_renderer, std::static_pointer_cast<BackendTextureSDL>(texture)->getInternalTexture());
+        SDL_SetRenderViewport(m_renderer, nullptr);
+        SDL_SetRenderClipRect(m_renderer, nullptr);
+        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
+        SDL_RenderClear(m_renderer);
+
+        const Vector2f textureSizeF{static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)};
+        setView(area, {{0, 0}, textureSizeF}, textureSizeF);
+        m_pixelsPerPoint = {textureSizeF.x / area.width, textureSizeF.y / area.height};
+
+        drawFunc(*this, {});
+
+        // Continue drawing where we left off
+        SDL_SetRenderTarget(m_renderer, oldRenderTarget);
+        SDL_SetRenderViewport(m_renderer, &oldViewportSDL);
+        if (oldClipEnabled)
+            SDL_SetRenderClipRect(m_renderer, &oldClipRect);
+        else
+            SDL_SetRenderClipRect(m_renderer, nullptr);
+        SDL_SetRenderDrawColor(m_renderer, oldDrawColor[0], oldDrawColor[1], oldDrawColor[2], oldDrawColor[3]);
+
+        setView(oldViewRect, oldViewport, oldTargetSize);
+        m_pixelsPerPoint = oldPixelsPerPoint;
+        m_clipLayers.swap(oldClipLayers);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +138,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updateTexturePart(UIntRect area, const std::uint8_t* pixels)
+    {
+        if (!m_texture || !pixels || (area.left + area.width > m_imageSize.x) || (area.top + area.height > m_imageSize.y))
+            return false;
+
+        SDL_Rect rect;
+        rect.x = static_cast<int>(area.left);
+        rect.y = static_cast<int>(area.top);
+        rect.w = static_cast<int>(area.width);
+        rect.h = static_cast<int>(area.height);
+        SDL_UpdateTexture(m_texture, &rect, pixels, static_cast<int>(area.width * 4));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
@@ -151,6 +167,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTextureSDL::setPremultipliedAlpha(bool premultiplied)
+    {
+        BackendTexture::setPremultipliedAlpha(premultiplied);
+
+        if (!m_texture)
+            return;
+
+        if (premultiplied)
+        {
+#if SDL_MAJOR_VERSION >= 3
+            SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+#else
+            SDL_SetTextureBlendMode(m_texture, SDL_ComposeCustomBlendMode(
+                SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+                SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD));
+#endif
+        }
+        else
+            SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_BLEND);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     SDL_Texture* BackendTextureSDL::getInternalTexture() const
     {
         return m_texture;
@@ -66,6 +66,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updateTexturePart(UIntRect area, const std::uint8_t* pixels)
+    {
+        if (!m_texture || !pixels || (area.left + area.width > m_imageSize.x) || (area.top + area.height > m_imageSize.y))
+            return false;
+
+#if SFML_VERSION_MAJOR >= 3
+        m_texture->update(pixels, {area.width, area.height}, {area.left, area.top});
+#else
+        m_texture->update(pixels, area.width, area.height, area.left, area.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
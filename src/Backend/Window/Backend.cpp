@@ -245,6 +245,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Backend::frameDrawn()
+    {
+        for (auto* font : m_registeredFonts)
+            font->frameDrawn();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Backend::registerFont(BackendFont* font)
     {
         m_registeredFonts.insert(font);
@@ -272,6 +280,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Backend::updateSvgSprites()
+    {
+        for (auto* sprite : m_registeredSvgSprites)
+            sprite->updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
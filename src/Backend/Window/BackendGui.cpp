@@ -28,10 +28,44 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        TGUI_NODISCARD FloatRect combineRects(const FloatRect& rect1, const FloatRect& rect2)
+        {
+            const float left = std::min(rect1.left, rect2.left);
+            const float top = std::min(rect1.top, rect2.top);
+            const float right = std::max(rect1.left + rect1.width, rect2.left + rect2.width);
+            const float bottom = std::max(rect1.top + rect1.height, rect2.top + rect2.height);
+            return {left, top, right - left, bottom - top};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(NDEBUG) && !defined(TGUI_NO_RUNTIME_WARNINGS)
+        TGUI_NODISCARD String getWidgetNames(const std::vector<Widget*>& widgets)
+        {
+            String names;
+            for (const Widget* widget : widgets)
+            {
+                if (!names.empty())
+                    names += U", ";
+
+                const String name = widget->getWidgetName();
+                names += U"'" + (name.empty() ? widget->getWidgetType() : name) + U"'";
+            }
+
+            return names;
+        }
+#endif
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendGui::BackendGui()
@@ -106,6 +140,37 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendGui::handleEvent(Event event)
+    {
+        // Widgets have to be at their correct location before we can find out which widget is below the mouse
+        updateLayouts();
+
+        if (!m_partialRedrawEnabled)
+            return processEvent(event);
+
+        const bool keyboardEvent = (event.type == Event::Type::KeyPressed) || (event.type == Event::Type::TextEntered);
+        const bool mouseEvent = (event.type == Event::Type::MouseMoved) || (event.type == Event::Type::MouseButtonPressed)
+                             || (event.type == Event::Type::MouseButtonReleased) || (event.type == Event::Type::MouseWheelScrolled);
+
+        // The widgets that were interacted with before the event (e.g. the widget that was below the mouse) may change as well
+        if (keyboardEvent || mouseEvent)
+            m_container->invalidateInteractedWidgets(keyboardEvent);
+
+        const std::uint64_t oldEmitCount = Signal::getEmitCount();
+        const bool eventHandled = processEvent(event);
+
+        if (keyboardEvent || mouseEvent)
+            m_container->invalidateInteractedWidgets(keyboardEvent);
+
+        // We can't know what signal handlers changed, so the entire screen has to be redrawn when a signal was emitted
+        if (Signal::getEmitCount() != oldEmitCount)
+            invalidate();
+
+        return eventHandled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::processEvent(const Event& event)
     {
         switch (event.type)
         {
@@ -240,8 +305,27 @@ namespace tgui
         if (m_drawUpdatesTime)
             updateTime();
 
+        updateLayouts();
+
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
+        m_backendRenderTarget->setDrawCallReorderingEnabled(m_drawCallReorderingEnabled);
         m_backendRenderTarget->drawGui(m_container);
+        getBackend()->frameDrawn();
+
+        if (m_partialRedrawEnabled)
+        {
+            // If prepareRedraw wasn't called then the entire screen was drawn
+            if (!m_partialRedrawPrepared)
+                m_previousRedrawRegions.emplace_front();
+
+            if (m_previousRedrawRegions.size() >= m_backBufferAge)
+                m_previousRedrawRegions.resize(m_backBufferAge - 1);
+
+            m_container->resetRedrawRegion();
+            m_partialRedrawPrepared = false;
+            m_fullRedrawRequired = false;
+            m_damagedRegion.reset();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,9 +536,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendGui::saveWidgetsToFile(const String& filename)
+    void BackendGui::saveWidgetsToFile(const String& filename, bool binary)
     {
-        m_container->saveWidgetsToFile(filename);
+        m_container->saveWidgetsToFile(filename, binary);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,7 +620,12 @@ namespace tgui
 
     bool BackendGui::updateTime(Duration elapsedTime)
     {
+        const std::uint64_t oldEmitCount = Signal::getEmitCount();
+
+        // We can't know what the callback functions of the timers changed, so the entire screen has to be redrawn
         bool screenRefreshRequired = Timer::updateTime(elapsedTime);
+        if (screenRefreshRequired)
+            invalidate();
 
         if (!m_windowFocused)
             return screenRefreshRequired;
@@ -575,6 +664,10 @@ namespace tgui
             }
         }
 
+        // Signals that were emitted (e.g. when an animation finished) could have been used to change other widgets
+        if (Signal::getEmitCount() != oldEmitCount)
+            invalidate();
+
         return screenRefreshRequired;
     }
 
@@ -639,6 +732,7 @@ namespace tgui
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
 
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        invalidate();
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
@@ -692,6 +786,302 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendGui::setDrawCallReorderingEnabled(bool enabled)
+    {
+        m_drawCallReorderingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isDrawCallReorderingEnabled() const
+    {
+        return m_drawCallReorderingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendGui::getStateChangesRemovedByReordering() const
+    {
+        if (!m_backendRenderTarget)
+            return 0;
+
+        return m_backendRenderTarget->getStateChangesRemovedByReordering();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setPartialRedrawEnabled(bool enabled, unsigned int backBufferAge)
+    {
+        m_partialRedrawEnabled = enabled;
+        m_backBufferAge = std::max(1u, backBufferAge);
+        m_fullRedrawRequired = true;
+        m_partialRedrawPrepared = false;
+        m_damagedRegion.reset();
+        m_previousRedrawRegions.clear();
+        m_container->resetRedrawRegion();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidateRegion(const FloatRect& region)
+    {
+        if (!m_partialRedrawEnabled || m_fullRedrawRequired || (region.width <= 0) || (region.height <= 0))
+            return;
+
+        // Add a small margin around the area, as anti-aliased edges and outlines may extend slightly outside the widget
+        const FloatRect paddedRegion{region.left - 1, region.top - 1, region.width + 2, region.height + 2};
+        if (m_damagedRegion)
+            m_damagedRegion = combineRects(*m_damagedRegion, paddedRegion);
+        else
+            m_damagedRegion = paddedRegion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidate()
+    {
+        m_fullRedrawRequired = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isRedrawRequired() const
+    {
+        return !m_partialRedrawEnabled || m_fullRedrawRequired || m_damagedRegion;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setDeferredLayoutUpdatesEnabled(bool enabled)
+    {
+        // Layouts that were changed while updates were deferred have to be updated before returning to immediate updates
+        if (!enabled)
+            updateLayouts();
+
+        m_deferredLayoutUpdatesEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isDeferredLayoutUpdatesEnabled() const
+    {
+        return m_deferredLayoutUpdatesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::updateLayouts()
+    {
+        if (m_updatingLayouts || m_pendingLayoutWidgets.empty())
+            return;
+
+        m_updatingLayouts = true;
+
+        // Updating widgets can change widgets that weren't part of the dependency graph (e.g. siblings of widgets that use
+        // AutoLayout), so the changes that were requested during an update are handled in another round.
+        unsigned int round = 0;
+        while (!m_pendingLayoutWidgets.empty())
+        {
+            if (++round > 10)
+            {
+                TGUI_PRINT_WARNING("Dependency cycle detected in layouts, widgets keep changing: " << getWidgetNames(m_pendingLayoutWidgets))
+                m_pendingLayoutWidgets.clear();
+                m_pendingLayoutWidgetsSet.clear();
+                break;
+            }
+
+            // Find all widgets that depend on the changed widgets, directly or indirectly
+            std::vector<Widget*> widgets = std::move(m_pendingLayoutWidgets);
+            m_pendingLayoutWidgets.clear();
+            m_pendingLayoutWidgetsSet.clear();
+
+            std::unordered_map<Widget*, std::size_t> widgetIndices;
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+                widgetIndices[widgets[i]] = i;
+
+            std::vector<std::vector<std::size_t>> dependentIndices;
+            std::vector<Widget*> dependents;
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                dependents.clear();
+                widgets[i]->appendLayoutDependents(dependents);
+
+                dependentIndices.emplace_back();
+                for (Widget* dependent : dependents)
+                {
+                    // A widget that depends on itself recalculates its size before its position, so it needs no extra update
+                    if ((dependent == widgets[i]) || (dependent->getParentGui() != this))
+                        continue;
+
+                    auto it = widgetIndices.find(dependent);
+                    if (it == widgetIndices.end())
+                    {
+                        it = widgetIndices.emplace(dependent, widgets.size()).first;
+                        widgets.push_back(dependent);
+                    }
+
+                    dependentIndices[i].push_back(it->second);
+                }
+            }
+
+            // Sort the widgets topologically, so that each widget is updated after the widgets on which it depends
+            std::vector<std::size_t> dependencyCounts(widgets.size(), 0);
+            for (const auto& indices : dependentIndices)
+            {
+                for (const std::size_t index : indices)
+                    ++dependencyCounts[index];
+            }
+
+            std::vector<std::size_t> order;
+            order.reserve(widgets.size());
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                if (dependencyCounts[i] == 0)
+                    order.push_back(i);
+            }
+
+            for (std::size_t i = 0; i < order.size(); ++i)
+            {
+                for (const std::size_t index : dependentIndices[order[i]])
+                {
+                    if (--dependencyCounts[index] == 0)
+                        order.push_back(index);
+                }
+            }
+
+            // Widgets that remain are part of a dependency cycle. They are still updated once so that this function always ends.
+            if (order.size() < widgets.size())
+            {
+                std::vector<Widget*> cycleWidgets;
+                for (std::size_t i = 0; i < widgets.size(); ++i)
+                {
+                    if (dependencyCounts[i] > 0)
+                    {
+                        cycleWidgets.push_back(widgets[i]);
+                        order.push_back(i);
+                    }
+                }
+
+                TGUI_PRINT_WARNING("Dependency cycle detected in layouts of widgets " << getWidgetNames(cycleWidgets))
+            }
+
+            for (Widget* widget : widgets)
+                m_layoutUpdateStates[widget] = LayoutUpdateState::Waiting;
+
+            for (const std::size_t index : order)
+            {
+                Widget* widget = widgets[index];
+
+                // Signal handlers that were called while updating a previous widget may have removed this widget
+                if (m_layoutUpdateStates[widget] == LayoutUpdateState::Removed)
+                    continue;
+
+                m_layoutUpdateStates[widget] = LayoutUpdateState::Updating;
+                widget->recalculateLayouts();
+
+                auto it = m_layoutUpdateStates.find(widget);
+                if (it->second == LayoutUpdateState::Updating)
+                    it->second = LayoutUpdateState::Updated;
+            }
+
+            m_layoutUpdateStates.clear();
+        }
+
+        m_updatingLayouts = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::requestLayoutUpdate(Widget* widget)
+    {
+        if (m_updatingLayouts)
+        {
+            // Widgets that still have to be updated in the current round will already use the latest values
+            const auto it = m_layoutUpdateStates.find(widget);
+            if ((it != m_layoutUpdateStates.end())
+             && ((it->second == LayoutUpdateState::Waiting) || (it->second == LayoutUpdateState::Updating)))
+                return;
+        }
+
+        if (m_pendingLayoutWidgetsSet.insert(widget).second)
+            m_pendingLayoutWidgets.push_back(widget);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::cancelLayoutUpdate(Widget* widget)
+    {
+        if (m_pendingLayoutWidgetsSet.erase(widget) > 0)
+            m_pendingLayoutWidgets.erase(std::find(m_pendingLayoutWidgets.begin(), m_pendingLayoutWidgets.end(), widget));
+
+        const auto it = m_layoutUpdateStates.find(widget);
+        if (it != m_layoutUpdateStates.end())
+            it->second = LayoutUpdateState::Removed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::prepareRedraw(Color clearColor)
+    {
+        TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling prepareRedraw()");
+
+        // Moving or resizing widgets damages parts of the screen, so the layouts must be updated before the damage is known
+        updateLayouts();
+
+        if (!m_partialRedrawEnabled)
+        {
+            m_backendRenderTarget->clearScreen();
+            return true;
+        }
+
+        if (!isRedrawRequired())
+            return false;
+
+        // The back buffer may contain a frame that is older than the previous one, in which case the areas that changed in
+        // the frames since then need to be redrawn as well. A missing area means that the entire screen was redrawn.
+        bool fullRedraw = m_fullRedrawRequired || (clearColor.getAlpha() < 255)
+                       || (m_previousRedrawRegions.size() + 1 < m_backBufferAge);
+        FloatRect redrawRegion;
+        if (!fullRedraw)
+        {
+            redrawRegion = *m_damagedRegion;
+            for (const auto& previousRegion : m_previousRedrawRegions)
+            {
+                if (!previousRegion)
+                {
+                    fullRedraw = true;
+                    break;
+                }
+
+                redrawRegion = combineRects(redrawRegion, *previousRegion);
+            }
+        }
+
+        if (fullRedraw)
+        {
+            m_backendRenderTarget->clearScreen();
+            m_container->resetRedrawRegion();
+            m_previousRedrawRegions.emplace_front();
+        }
+        else
+        {
+            m_container->setRedrawRegion(redrawRegion, clearColor);
+            m_previousRedrawRegions.push_front(*m_damagedRegion);
+        }
+
+        m_partialRedrawPrepared = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Event::KeyboardKey BackendGui::translateKeypadKey(Event::KeyboardKey key)
     {
         switch (key)
@@ -447,9 +447,8 @@ namespace tgui
             // Don't try to render too often, even when the screen is changing (e.g. during animation)
             const auto timePointNow = std::chrono::steady_clock::now();
             const auto timePointNextAllowed = lastRenderTime + std::chrono::milliseconds(15);
-            if (timePointNextAllowed <= timePointNow)
+            if ((timePointNextAllowed <= timePointNow) && prepareRedraw(clearColor))
             {
-                m_backendRenderTarget->clearScreen();
                 draw();
                 glfwSwapBuffers(m_window);
                 lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
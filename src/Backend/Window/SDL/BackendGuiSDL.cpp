@@ -581,6 +581,8 @@ namespace tgui
                            || (event.window.event == SDL_WINDOWEVENT_FOCUS_GAINED) || (event.window.event == SDL_WINDOWEVENT_FOCUS_LOST)))
 #endif
                     {
+                        // The contents of the window may have been lost, so it has to be redrawn entirely
+                        invalidate();
                         eventProcessed = true;
                     }
                 }
@@ -600,9 +602,11 @@ namespace tgui
             if (timePointNextAllowed > timePointNow)
                 continue;
 
-            m_backendRenderTarget->clearScreen();
-            draw();
-            presentScreen(); // Call SDL_GL_SwapWindow or SDL_RenderPresent depending on the backend renderer
+            if (prepareRedraw(clearColor))
+            {
+                draw();
+                presentScreen(); // Call SDL_GL_SwapWindow or SDL_RenderPresent depending on the backend renderer
+            }
 
             refreshRequired = false;
             lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
@@ -340,9 +340,11 @@ namespace tgui
             if (timePointNextAllowed > timePointNow)
                 continue;
 
-            m_backendRenderTarget->clearScreen();
-            draw();
-            m_window->display();
+            if (prepareRedraw(clearColor))
+            {
+                draw();
+                m_window->display();
+            }
 
             refreshRequired = false;
             lastRenderTime = std::chrono::steady_clock::now(); // Don't use timePointNow to provide enough rest on low-end hardware
@@ -29,9 +29,12 @@
 #include <TGUI/SubwidgetContainer.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Filesystem.hpp>
+#include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <fstream>
+    #include <cmath>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +45,87 @@ namespace tgui
 
     namespace
     {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Render target that doesn't draw anything, but instead calculates a hash of everything that is drawn to it.
+        // Containers that are cached as texture use it to find out whether their child widgets would draw anything different.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class DrawHashRenderTarget : public BackendRenderTarget
+        {
+        public:
+            void reset(Vector2u textureSize, FloatRect area)
+            {
+                // Use the same view and scaling as the render targets use in drawToTexture, so that widgets are clipped and rounded identically
+                const Vector2f targetSize{static_cast<float>(textureSize.x), static_cast<float>(textureSize.y)};
+                setView(area, {{0, 0}, targetSize}, targetSize);
+                m_pixelsPerPoint = {targetSize.x / area.width, targetSize.y / area.height};
+                m_hash = 14695981039346656037ULL;
+            }
+
+            TGUI_NODISCARD std::uint64_t getHash() const
+            {
+                return m_hash;
+            }
+
+            void setClearColor(const Color&) override
+            {
+            }
+
+            void clearScreen() override
+            {
+            }
+
+            void drawGui(const std::shared_ptr<RootContainer>&) override
+            {
+            }
+
+            void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                                 const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override
+            {
+                addToHash(states.transform.getMatrix().data(), sizeof(float) * 16);
+
+                const BackendTexture* texturePtr = texture.get();
+                addToHash(&texturePtr, sizeof(texturePtr));
+                if (texture)
+                {
+                    const Vector2u textureSize = texture->getSize();
+                    const std::array<bool, 3> textureFlags{{texture->isSmooth(), texture->isPremultipliedAlpha(), texture->isDistanceField()}};
+                    addToHash(&textureSize, sizeof(textureSize));
+                    addToHash(textureFlags.data(), sizeof(textureFlags));
+                }
+
+                addToHash(&vertexCount, sizeof(vertexCount));
+                addToHash(vertices, vertexCount * sizeof(Vertex));
+                addToHash(&indexCount, sizeof(indexCount));
+                if (indices)
+                    addToHash(indices, indexCount * sizeof(unsigned int));
+            }
+
+        protected:
+
+            void updateClipping(FloatRect clipRect, FloatRect clipViewport) override
+            {
+                addToHash(&clipRect, sizeof(clipRect));
+                addToHash(&clipViewport, sizeof(clipViewport));
+            }
+
+        private:
+
+            // FNV-1a hash
+            void addToHash(const void* data, std::size_t size)
+            {
+                const auto* bytes = static_cast<const std::uint8_t*>(data);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    m_hash ^= bytes[i];
+                    m_hash *= 1099511628211ULL;
+                }
+            }
+
+        private:
+
+            std::uint64_t m_hash = 14695981039346656037ULL;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         void getAllRenderers(std::vector<RendererData*>& orderedRenderers, std::map<RendererData*, std::vector<const Widget*>>& rendererToWidgetsMap, const Container* container)
@@ -156,6 +240,26 @@ namespace tgui
             for (const auto& childNode : node->children)
                 makePathsRelativeToForm(childNode, formPath);
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Transform getChildWidgetTransform(Transform transform, const Widget& widget)
+        {
+            const Vector2f origin{widget.getOrigin().x * widget.getSize().x, widget.getOrigin().y * widget.getSize().y};
+            transform.translate(widget.getPosition() - origin);
+            if (widget.getRotation() != 0)
+            {
+                const Vector2f rotOrigin{widget.getRotationOrigin().x * widget.getSize().x, widget.getRotationOrigin().y * widget.getSize().y};
+                transform.rotate(widget.getRotation(), rotOrigin);
+            }
+            if ((widget.getScale().x != 1) || (widget.getScale().y != 1))
+            {
+                const Vector2f scaleOrigin{widget.getScaleOrigin().x * widget.getSize().x, widget.getScaleOrigin().y * widget.getSize().y};
+                transform.scale(widget.getScale(), scaleOrigin);
+            }
+
+            return transform;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,7 +273,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget           {other},
+        m_cachedAsTexture{other.m_cachedAsTexture}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -193,7 +298,11 @@ namespace tgui
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
         m_focusedWidget           {std::move(other.m_focusedWidget)},
-        m_draggingWidget          {std::move(other.m_draggingWidget)}
+        m_draggingWidget          {std::move(other.m_draggingWidget)},
+        m_cachedAsTexture         {std::move(other.m_cachedAsTexture)},
+        m_cacheTexture            {std::move(other.m_cacheTexture)},
+        m_cacheArea               {std::move(other.m_cacheArea)},
+        m_cacheValid              {std::move(other.m_cacheValid)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -230,6 +339,9 @@ namespace tgui
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
             m_draggingWidget = false;
+            m_cachedAsTexture = right.m_cachedAsTexture;
+            m_cacheTexture = nullptr;
+            m_cacheValid = false;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -263,6 +375,10 @@ namespace tgui
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
             m_draggingWidget           = std::move(right.m_draggingWidget);
+            m_cachedAsTexture          = std::move(right.m_cachedAsTexture);
+            m_cacheTexture             = std::move(right.m_cacheTexture);
+            m_cacheArea                = std::move(right.m_cacheArea);
+            m_cacheValid               = std::move(right.m_cacheValid);
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -464,9 +580,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open '" + filenameInResources + U"' to load the widgets from it."};
 
-        /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-        std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        const auto rootNode = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -483,7 +597,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToFile(const String& filename)
+    void Container::saveWidgetsToFile(const String& filename, bool binary)
     {
         // If a resource path is set then place it in front of the filename (unless the filename is an absolute path)
         String filenameInResources = filename;
@@ -493,9 +607,12 @@ namespace tgui
         const String formFileDir = Filesystem::Path(filename).getParentPath().asString();
 
         std::stringstream stream;
-        saveWidgetsToStream(stream, formFileDir);
+        if (binary)
+            DataIO::emitBinary(saveWidgetsToNodeTree(formFileDir), stream);
+        else
+            saveWidgetsToStream(stream, formFileDir);
 
-        if (!writeFile(filenameInResources, stream))
+        if (!writeFile(filenameInResources, stream, binary))
             throw Exception{U"Failed to write '" + filenameInResources + U"' while trying to save widgets in it."};
     }
 
@@ -716,6 +833,7 @@ namespace tgui
         if (widgetToMove->getAutoLayout() != AutoLayout::Manual)
             updateChildrenWithAutoLayout();
 
+        invalidate();
         return true;
     }
 
@@ -1066,20 +1184,25 @@ namespace tgui
 
     void Container::rendererChanged(const String& property)
     {
+        const RendererPropertyId propertyId{property};
+
         Widget::rendererChanged(property);
 
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            for (const auto& widget : m_widgets)
-                widget->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
+        switch (propertyId.getValue())
         {
-            for (const auto& widget : m_widgets)
-            {
-                if (m_fontCached != Font::getGlobalFont())
-                    widget->setInheritedFont(m_fontCached);
-            }
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                for (const auto& widget : m_widgets)
+                    widget->setInheritedOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                for (const auto& widget : m_widgets)
+                {
+                    if (m_fontCached != Font::getGlobalFont())
+                        widget->setInheritedFont(m_fontCached);
+                }
+                break;
         }
     }
 
@@ -1315,6 +1438,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setCachedAsTexture(bool cached)
+    {
+        m_cachedAsTexture = cached;
+        m_cacheTexture = nullptr;
+        m_cacheValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isCachedAsTexture() const
+    {
+        return m_cachedAsTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateTextureCache()
+    {
+        m_cacheValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::updateTime(Duration elapsedTime)
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
@@ -1322,9 +1468,15 @@ namespace tgui
         // Loop through all widgets
         for (auto& widget : m_widgets)
         {
-            // Update the elapsed time in widgets that need it
-            if (widget->isVisible())
-                screenRefreshRequired |= widget->updateTime(elapsedTime);
+            // Update the elapsed time in widgets that need it.
+            // Child containers report the area of their own children that changed, so only the other widgets are invalidated here.
+            if (widget->isVisible() && widget->updateTime(elapsedTime))
+            {
+                if (!widget->isContainer())
+                    widget->invalidate();
+
+                screenRefreshRequired = true;
+            }
         }
 
         return screenRefreshRequired;
@@ -1332,6 +1484,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::invalidateInteractedWidgets(bool keyboardEvent)
+    {
+        if (!invalidateInteractedChildWidgets(keyboardEvent))
+        {
+            // The container is being interacted with directly (e.g. the title bar of a child window), so redraw it entirely
+            invalidate();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::invalidateInteractedChildWidgets(bool keyboardEvent)
+    {
+        bool childInvalidated = false;
+        const auto invalidateChild = [keyboardEvent,&childInvalidated](const Widget::Ptr& widget){
+            if (!widget)
+                return;
+
+            if (widget->isContainer())
+                std::static_pointer_cast<Container>(widget)->invalidateInteractedWidgets(keyboardEvent);
+            else
+                widget->invalidate();
+
+            childInvalidated = true;
+        };
+
+        if (keyboardEvent)
+            invalidateChild(m_focusedWidget);
+        else
+        {
+            invalidateChild(m_widgetBelowMouse);
+            invalidateChild(m_widgetWithLeftMouseDown);
+            invalidateChild(m_widgetWithRightMouseDown);
+        }
+
+        return childInvalidated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setParent(Container* parent)
     {
         const BackendGui* oldParentGui = m_parentGui;
@@ -1491,29 +1683,142 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::draw(BackendRenderTarget& target, RenderStates states) const
+    {
+        if (m_cachedAsTexture && drawFromTextureCache(target, states))
+            return;
+
+        drawWidgets(target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawWidgets(BackendRenderTarget& target, const RenderStates& states) const
     {
         for (const auto& widget : m_widgets)
         {
             if (!widget->isVisible())
                 continue;
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
-
             RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
+            widgetStates.transform = getChildWidgetTransform(states.transform, *widget);
+            target.drawWidget(widgetStates, widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::drawFromTextureCache(BackendRenderTarget& target, const RenderStates& states) const
+    {
+        // Cached containers inside a cached container are drawn directly while the hash of the outer container is calculated
+        if (dynamic_cast<DrawHashRenderTarget*>(&target))
+            return false;
+
+        // The resolution of the texture would be wrong if the container itself is rotated or scaled
+        const auto& matrix = states.transform.getMatrix();
+        if ((matrix[0] != 1) || (matrix[1] != 0) || (matrix[4] != 0) || (matrix[5] != 1))
+            return false;
+
+        // Find the area that is covered by the child widgets
+        bool widgetFound = false;
+        float left = 0;
+        float top = 0;
+        float right = 0;
+        float bottom = 0;
+        for (const auto& widget : m_widgets)
+        {
+            if (!widget->isVisible())
+                continue;
+
+            const FloatRect rect = getChildWidgetTransform({}, *widget).transformRect({widget->getWidgetOffset(), widget->getFullSize()});
+            if (!widgetFound)
             {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
+                left = rect.left;
+                top = rect.top;
+                right = rect.left + rect.width;
+                bottom = rect.top + rect.height;
+                widgetFound = true;
             }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
+            else
             {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
+                left = std::min(left, rect.left);
+                top = std::min(top, rect.top);
+                right = std::max(right, rect.left + rect.width);
+                bottom = std::max(bottom, rect.top + rect.height);
             }
+        }
 
-            target.drawWidget(widgetStates, widget);
+        if (!widgetFound || (right <= left) || (bottom <= top))
+            return false;
+
+        // Make the texture cover a whole amount of pixels, so that the texture pixels match the pixels on the screen
+        const Vector2f pixelsPerPoint = target.getPixelsPerPoint();
+        if ((pixelsPerPoint.x <= 0) || (pixelsPerPoint.y <= 0))
+            return false;
+
+        left = std::floor(left);
+        top = std::floor(top);
+        const Vector2u textureSize{static_cast<unsigned int>(std::ceil((right - left) * pixelsPerPoint.x)),
+                                   static_cast<unsigned int>(std::ceil((bottom - top) * pixelsPerPoint.y))};
+        const FloatRect area{left, top, textureSize.x / pixelsPerPoint.x, textureSize.y / pixelsPerPoint.y};
+
+        const unsigned int maxTextureSize = getBackend()->getRenderer()->getMaximumTextureSize();
+        if ((textureSize.x > maxTextureSize) || (textureSize.y > maxTextureSize))
+            return false;
+
+        const auto calculateContentsHash = [this,textureSize,area]{
+            if (!m_cacheHashTarget)
+                m_cacheHashTarget = std::make_unique<DrawHashRenderTarget>();
+
+            auto& hashTarget = static_cast<DrawHashRenderTarget&>(*m_cacheHashTarget);
+            hashTarget.reset(textureSize, area);
+            drawWidgets(hashTarget, {});
+            return hashTarget.getHash();
+        };
+
+        // The texture only has to be redrawn when the child widgets would draw something different than what it contains
+        bool contentsHashCalculated = false;
+        std::uint64_t contentsHash = 0;
+        bool textureOutdated = true;
+        if (m_cacheValid && m_cacheTexture && (m_cacheTexture->getSize() == textureSize) && (m_cacheArea == area))
+        {
+            contentsHash = calculateContentsHash();
+            contentsHashCalculated = true;
+            textureOutdated = (contentsHash != m_cacheContentsHash);
+        }
+
+        if (textureOutdated)
+        {
+            const bool textureDrawn = target.drawToTexture(m_cacheTexture, textureSize, area,
+                [this](BackendRenderTarget& textureTarget, const RenderStates& textureStates){ drawWidgets(textureTarget, textureStates); });
+            if (!textureDrawn)
+            {
+                m_cacheTexture = nullptr;
+                m_cacheValid = false;
+                return false;
+            }
+
+            // The hash is only calculated after the first successful draw, as not all render targets support drawing to a texture
+            if (!contentsHashCalculated)
+                contentsHash = calculateContentsHash();
+
+            m_cacheContentsHash = contentsHash;
+            m_cacheArea = area;
+            m_cacheValid = true;
         }
+
+        const Vertex::Color vertexColor{255, 255, 255, 255};
+        const std::array<Vertex, 4> vertices = {{
+            {{area.left, area.top}, vertexColor, {0, 0}},
+            {{area.left, area.top + area.height}, vertexColor, {0, 1}},
+            {{area.left + area.width, area.top}, vertexColor, {1, 0}},
+            {{area.left + area.width, area.top + area.height}, vertexColor, {1, 1}}
+        }};
+        const std::array<unsigned int, 2*3> indices = {{
+            0, 1, 2,
+            2, 1, 3
+        }};
+        target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), m_cacheTexture);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1729,10 +2034,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void RootContainer::setRedrawRegion(const FloatRect& region, Color backgroundColor)
+    {
+        m_redrawRegion = region;
+        m_redrawBackgroundColor = backgroundColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RootContainer::resetRedrawRegion()
+    {
+        m_redrawRegion.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RootContainer::invalidateInteractedWidgets(bool keyboardEvent)
+    {
+        // The root container itself isn't drawn, so only its children have to be invalidated
+        invalidateInteractedChildWidgets(keyboardEvent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RootContainer::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        // The only reason to override this function was to change the access specifier, so just call the code from the base class
+        if (!m_redrawRegion)
+        {
+            Container::draw(target, states);
+            return;
+        }
+
+        // Only the damaged part of the screen is redrawn, the rest of the previous frame is kept.
+        // The background is erased by drawing the clear color over it, after which the widgets are drawn on top.
+        target.addClippingLayer(states, *m_redrawRegion);
+
+        RenderStates backgroundStates = states;
+        backgroundStates.transform.translate(m_redrawRegion->getPosition());
+        target.drawFilledRect(backgroundStates, m_redrawRegion->getSize(), m_redrawBackgroundColor);
+
         Container::draw(target, states);
+
+        target.removeClippingLayer();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
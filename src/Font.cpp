@@ -146,10 +146,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Font::getAdvance(char32_t codePoint, unsigned int characterSize, bool bold) const
+    {
+        if (m_backendFont)
+            return m_backendFont->getAdvance(codePoint, characterSize, bold);
+        else
+            return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) const
     {
         if (m_backendFont)
-            return m_backendFont->getKerning(first, second, characterSize, bold);
+            return m_backendFont->getCachedKerning(first, second, characterSize, bold);
         else
             return 0;
     }
@@ -194,6 +204,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FontGlyphCacheStatistics Font::getGlyphCacheStatistics() const
+    {
+        if (m_backendFont)
+            return m_backendFont->getGlyphCacheStatistics();
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphs(char32_t firstCodePoint, char32_t lastCodePoint, const std::vector<unsigned int>& characterSizes, bool bold)
+    {
+        if (m_backendFont)
+            m_backendFont->preloadGlyphs(firstCodePoint, lastCodePoint, characterSizes, bold);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isPreloadingGlyphs() const
+    {
+        if (m_backendFont)
+            return m_backendFont->isPreloadingGlyphs();
+        else
+            return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<BackendFont> Font::getBackendFont() const
     {
         return m_backendFont;
@@ -203,33 +203,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool writeFile(const String& filename, const std::stringstream& stream)
+    bool writeFile(const String& filename, const std::stringstream& stream, bool binary)
     {
 #if TGUI_COMPILED_WITH_CPP_VER > 20
-        return writeFile(filename, stream.view());
+        return writeFile(filename, stream.view(), binary);
 #elif TGUI_COMPILED_WITH_CPP_VER == 20
         const auto& stringOrView = StreamToStringViewConverter<std::stringstream>::convert(stream);
-        return writeFile(filename, stringOrView);
+        return writeFile(filename, stringOrView, binary);
 #else
-        return writeFile(filename, stream.str());
+        return writeFile(filename, stream.str(), binary);
 #endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool writeFile(const String& filename, CharStringView stringView)
+    bool writeFile(const String& filename, CharStringView stringView, bool binary)
     {
         // On Windows, we use _wfopen_s with MSVC, MinGW-w64 and Clang (both LLVM Clang and Clang-CL).
         // With MinGW.org based TDM-GCC, we can't use _wfopen_s so we call _wfopen if the function is defined (i.e. if __STRICT_ANSI__ is undefined).
         // If _wfopen is unavailable, we simply use fopen (and hope that the system uses UTF-8 or that filename only contains ASCII characters).
 #if defined(TGUI_SYSTEM_WINDOWS) && (defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__clang__))
         FILE* file = nullptr;
-        if (_wfopen_s(&file, filename.toWideString().c_str(), L"w") != 0)
+        if (_wfopen_s(&file, filename.toWideString().c_str(), binary ? L"wb" : L"w") != 0)
             return false;
 #elif defined(TGUI_SYSTEM_WINDOWS) && !defined(__STRICT_ANSI__)
-        FILE* file = _wfopen(filename.toWideString().c_str(), L"w");
+        FILE* file = _wfopen(filename.toWideString().c_str(), binary ? L"wb" : L"w");
 #else
-        FILE* file = fopen(filename.toStdString().c_str(), "w");
+        FILE* file = fopen(filename.toStdString().c_str(), binary ? "wb" : "w");
 #endif
         if (!file)
             return false;
@@ -26,6 +26,14 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Backend/Window/BackendGui.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <array>
+    #include <list>
+    #include <map>
+    #include <mutex>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -60,10 +68,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TGUI_NODISCARD static bool isPositionBinding(Layout::Operation operation)
+    {
+        return (operation == Layout::Operation::BindingPosX) || (operation == Layout::Operation::BindingPosY)
+            || (operation == Layout::Operation::BindingLeft) || (operation == Layout::Operation::BindingTop);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Layouts that were recently created from a string, so that the same expression doesn't need to be parsed again
+    struct LayoutExpressionCache
+    {
+        static constexpr std::size_t MaxSize = 256;
+
+        std::mutex mutex; // Layouts can be created from multiple threads, e.g. while loading a form in the background
+        std::map<String, Layout> layouts;
+    };
+
+    TGUI_NODISCARD static LayoutExpressionCache& getLayoutExpressionCache()
+    {
+        static LayoutExpressionCache cache;
+        return cache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout::Layout(RelativeValue ratio) :
-        Layout{Layout::Operation::Multiplies,
-               std::make_unique<Layout>(ratio.getRatio()),
-               std::make_unique<Layout>(U"&.innersize")}
+        Layout{Layout::Operation::Multiplies, Layout{ratio.getRatio()}, Layout{String{U"&.innersize"}}}
     {
     }
 
@@ -71,6 +102,499 @@ namespace tgui
 
     Layout::Layout(String expression)
     {
+        auto& cache = getLayoutExpressionCache();
+        {
+            const std::lock_guard<std::mutex> lock(cache.mutex);
+            const auto it = cache.layouts.find(expression);
+            if (it != cache.layouts.end())
+            {
+                *this = it->second;
+                return;
+            }
+        }
+
+        parseExpression(expression);
+
+        const std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.layouts.size() >= LayoutExpressionCache::MaxSize)
+            cache.layouts.clear();
+
+        cache.layouts.emplace(std::move(expression), *this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, Widget* boundWidget) :
+        m_instructions{Instruction{operation, 0, boundWidget, -1}},
+        m_stackSize   {1}
+    {
+        TGUI_ASSERT(boundWidget != nullptr, "Bound widget passed to Layout constructor can't be a nullptr");
+        TGUI_ASSERT((operation == Operation::BindingPosX) || (operation == Operation::BindingPosY)
+               || (operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight),
+            "Layout constructor with bound widget must be called with an operation that involves the widget"
+        );
+
+        bindLayout();
+        calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand)
+    {
+        TGUI_ASSERT(leftOperand != nullptr, "Left operand in layout constructor can't be a nullptr");
+        TGUI_ASSERT(rightOperand != nullptr, "Right operand in layout constructor can't be a nullptr");
+
+        *this = Layout{operation, std::move(*leftOperand), std::move(*rightOperand)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Operation operation, Layout leftOperand, Layout rightOperand)
+    {
+        TGUI_ASSERT((operation == Operation::Plus) || (operation == Operation::Minus)
+               || (operation == Operation::Multiplies) || (operation == Operation::Divides)
+               || (operation == Operation::Minimum) || (operation == Operation::Maximum),
+            "Layout constructor with two operands must be called with a mathematical operation"
+        );
+
+        const unsigned int leftStackSize = std::max(1u, leftOperand.m_stackSize);
+        const unsigned int rightStackSize = std::max(1u, rightOperand.m_stackSize);
+        m_stackSize = std::max(leftStackSize, rightStackSize + 1);
+
+        // Take over the instructions of the left operand, the instructions of the right operand are placed behind them
+        if (!leftOperand.m_instructions.empty())
+        {
+            leftOperand.unbindLayout();
+            m_instructions = std::move(leftOperand.m_instructions);
+            m_boundStrings = std::move(leftOperand.m_boundStrings);
+            leftOperand.m_instructions.clear();
+        }
+        else
+            m_instructions.push_back({Operation::Value, leftOperand.m_value, nullptr, -1});
+
+        appendInstructions(rightOperand);
+        m_instructions.push_back({operation, 0, nullptr, -1});
+
+        bindLayout();
+        calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(const Layout& other) :
+        m_value          {other.m_value},
+        m_instructions   {other.m_instructions},
+        m_boundStrings   {other.m_boundStrings},
+        m_stackSize      {other.m_stackSize},
+        m_connectedWidgetCallback{nullptr},
+        m_connectedWidget{nullptr},
+        m_callingCallbackCount{0}
+    {
+        resetBindingStrings();
+        bindLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(Layout&& other) noexcept :
+        m_value          {other.m_value},
+        m_stackSize      {other.m_stackSize},
+        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)},
+        m_connectedWidget{other.m_connectedWidget},
+        m_callingCallbackCount{0}
+    {
+        other.unbindLayout();
+        m_instructions = std::move(other.m_instructions);
+        m_boundStrings = std::move(other.m_boundStrings);
+        other.m_instructions.clear();
+
+        bindLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout& Layout::operator=(const Layout& other)
+    {
+        if (this != &other)
+        {
+            unbindLayout();
+
+            m_value           = other.m_value;
+            m_instructions    = other.m_instructions;
+            m_boundStrings    = other.m_boundStrings;
+            m_stackSize       = other.m_stackSize;
+            m_connectedWidgetCallback = nullptr;
+            m_connectedWidget = nullptr;
+            m_callingCallbackCount = 0;
+
+            resetBindingStrings();
+            bindLayout();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout& Layout::operator=(Layout&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unbindLayout();
+            other.unbindLayout();
+
+            m_value           = other.m_value;
+            m_instructions    = std::move(other.m_instructions);
+            m_boundStrings    = std::move(other.m_boundStrings);
+            m_stackSize       = other.m_stackSize;
+            m_connectedWidgetCallback = std::move(other.m_connectedWidgetCallback);
+            m_connectedWidget = other.m_connectedWidget;
+            m_callingCallbackCount = 0;
+
+            other.m_instructions.clear();
+
+            bindLayout();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::~Layout()
+    {
+        unbindLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::replaceValue(const Layout& value)
+    {
+        *this = value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String Layout::toString() const
+    {
+        if (m_instructions.empty())
+            return String::fromNumber(m_value);
+
+        // Rebuild the expression from the postfix instructions. Apart from the text, we need to know whether each
+        // sub-expression should be placed between brackets when it is used as an operand.
+        struct SubExpression
+        {
+            String text;
+            bool needsBrackets;
+            bool isValue;
+            float value;
+        };
+
+        std::vector<SubExpression> subExpressions;
+        subExpressions.reserve(m_stackSize);
+        for (const auto& instruction : m_instructions)
+        {
+            const Operation operation = instruction.operation;
+            if (operation == Operation::Value)
+            {
+                subExpressions.push_back({String::fromNumber(instruction.value), false, true, instruction.value});
+            }
+            else if ((operation == Operation::Minimum) || (operation == Operation::Maximum))
+            {
+                const SubExpression right = std::move(subExpressions.back());
+                subExpressions.pop_back();
+                SubExpression& left = subExpressions.back();
+
+                const String functionName = (operation == Operation::Minimum) ? U"min(" : U"max(";
+                left = {functionName + left.text + U", " + right.text + U")", false, false, 0};
+            }
+            else if ((operation == Operation::Plus) || (operation == Operation::Minus) || (operation == Operation::Multiplies) || (operation == Operation::Divides))
+            {
+                const SubExpression right = std::move(subExpressions.back());
+                subExpressions.pop_back();
+                SubExpression& left = subExpressions.back();
+
+                char operatorChar;
+                if (operation == Operation::Plus)
+                    operatorChar = '+';
+                else if (operation == Operation::Minus)
+                    operatorChar = '-';
+                else if (operation == Operation::Multiplies)
+                    operatorChar = '*';
+                else // if (operation == Operation::Divides)
+                    operatorChar = '/';
+
+                const bool isPercentage = (operation == Operation::Multiplies) && left.isValue && (right.text == U"100%");
+
+                String text;
+                if (left.needsBrackets && right.needsBrackets)
+                    text = U"(" + left.text + U") " + operatorChar + U" (" + right.text + U")";
+                else if (left.needsBrackets)
+                    text = U"(" + left.text + U") " + operatorChar + U" " + right.text;
+                else if (right.needsBrackets)
+                    text = left.text + U" " + operatorChar + U" (" + right.text + U")";
+                else if (isPercentage)
+                    text = String::fromNumber(left.value * 100) + '%';
+                else
+                    text = left.text + U" " + operatorChar + U" " + right.text;
+
+                left = {std::move(text), !isPercentage, false, 0};
+            }
+            else // Binding
+            {
+                subExpressions.push_back({bindingToString(instruction), false, false, 0});
+            }
+        }
+
+        TGUI_ASSERT(subExpressions.size() == 1, "Layout instructions should reduce to a single expression");
+        return subExpressions.back().text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    {
+        const float oldValue = m_value;
+
+        // Parse the string bindings even when the referred widgets were already found. The widget may be added to a different parent.
+        // Only the bindings that were created from strings are touched, the bound widgets may be iterating over their layouts.
+        if (m_boundStrings)
+        {
+            bool bindingsParsed = false;
+            for (auto& instruction : m_instructions)
+            {
+                if (instruction.boundStringIndex < 0)
+                    continue;
+
+                Widget* const oldWidget = instruction.boundWidget;
+                const bool oldPositionBinding = isPositionBinding(instruction.operation);
+                if (!parseBindingString(instruction, (*m_boundStrings)[static_cast<std::size_t>(instruction.boundStringIndex)], widget, xAxis))
+                    continue;
+
+                bindingsParsed = true;
+
+                const bool positionBinding = isPositionBinding(instruction.operation);
+                if ((instruction.boundWidget == oldWidget) && (positionBinding == oldPositionBinding))
+                    continue;
+
+                // The layout remains registered in the old widget as long as another instruction still binds it
+                if (oldWidget && std::none_of(m_instructions.begin(), m_instructions.end(), [=](const Instruction& other){
+                        return (other.boundWidget == oldWidget) && (isPositionBinding(other.operation) == oldPositionBinding);
+                    }))
+                {
+                    if (oldPositionBinding)
+                        oldWidget->unbindPositionLayout(this);
+                    else
+                        oldWidget->unbindSizeLayout(this);
+                }
+
+                if (instruction.boundWidget)
+                {
+                    if (positionBinding)
+                        instruction.boundWidget->bindPositionLayout(this);
+                    else
+                        instruction.boundWidget->bindSizeLayout(this);
+                }
+            }
+
+            if (bindingsParsed)
+                calculateValue();
+        }
+
+        m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
+        m_connectedWidget = widget;
+
+        if (m_value != oldValue)
+        {
+            if (m_connectedWidgetCallback)
+            {
+                if (m_callingCallbackCount > 10)
+                {
+                    printDependencyCycleWarning();
+                    return;
+                }
+
+                ++m_callingCallbackCount;
+                m_connectedWidgetCallback();
+                --m_callingCallbackCount;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::unbindWidget(Widget* widget)
+    {
+        // The widget is being destroyed, so we don't have to tell it that we no longer bind it
+        for (auto& instruction : m_instructions)
+        {
+            if (instruction.boundWidget != widget)
+                continue;
+
+            instruction.boundWidget = nullptr;
+            if (instruction.boundStringIndex >= 0)
+                instruction.operation = Operation::BindingString;
+            else
+            {
+                instruction.value = 0;
+                instruction.operation = Operation::Value;
+            }
+        }
+
+        // If the layout only consisted of the binding then it now becomes a constant
+        if ((m_instructions.size() == 1) && (m_instructions[0].operation == Operation::Value))
+        {
+            m_value = m_instructions[0].value;
+            m_instructions.clear();
+            m_stackSize = 0;
+        }
+
+        // The connected widget isn't informed about the new value, it might be the widget that is being destroyed
+        calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::recalculateValue()
+    {
+        const float oldValue = m_value;
+        calculateValue();
+
+        if (m_value != oldValue)
+        {
+            // Tell the connected widget about the new value
+            if (m_connectedWidgetCallback)
+            {
+                if (m_callingCallbackCount > 10)
+                {
+                    printDependencyCycleWarning();
+                    m_value = 0;
+                }
+
+                ++m_callingCallbackCount;
+                m_connectedWidgetCallback();
+                --m_callingCallbackCount;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::calculateValue()
+    {
+        if (m_instructions.empty())
+            return;
+
+        // Evaluate the postfix instructions with a stack, which only needs to be allocated for extremely long expressions
+        std::array<float, 16> fixedStack;
+        std::vector<float> dynamicStack;
+        float* stack = fixedStack.data();
+        if (m_stackSize > fixedStack.size())
+        {
+            dynamicStack.resize(m_stackSize);
+            stack = dynamicStack.data();
+        }
+
+        std::size_t stackSize = 0;
+        for (auto& instruction : m_instructions)
+        {
+            switch (instruction.operation)
+            {
+                case Operation::Value:
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::Plus:
+                    --stackSize;
+                    stack[stackSize - 1] = stack[stackSize - 1] + stack[stackSize];
+                    break;
+                case Operation::Minus:
+                    --stackSize;
+                    stack[stackSize - 1] = stack[stackSize - 1] - stack[stackSize];
+                    break;
+                case Operation::Multiplies:
+                    --stackSize;
+                    stack[stackSize - 1] = stack[stackSize - 1] * stack[stackSize];
+                    break;
+                case Operation::Divides:
+                    --stackSize;
+                    if (stack[stackSize] != 0)
+                        stack[stackSize - 1] = stack[stackSize - 1] / stack[stackSize];
+                    else
+                        stack[stackSize - 1] = 0;
+                    break;
+                case Operation::Minimum:
+                    --stackSize;
+                    stack[stackSize - 1] = std::min(stack[stackSize - 1], stack[stackSize]);
+                    break;
+                case Operation::Maximum:
+                    --stackSize;
+                    stack[stackSize - 1] = std::max(stack[stackSize - 1], stack[stackSize]);
+                    break;
+                case Operation::BindingPosX:
+                    instruction.value = instruction.boundWidget->getPosition().x;
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingPosY:
+                    instruction.value = instruction.boundWidget->getPosition().y;
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingLeft:
+                    instruction.value = instruction.boundWidget->getPosition().x - (instruction.boundWidget->getOrigin().x * instruction.boundWidget->getSize().x);
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingTop:
+                    instruction.value = instruction.boundWidget->getPosition().y - (instruction.boundWidget->getOrigin().y * instruction.boundWidget->getSize().y);
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingWidth:
+                    instruction.value = instruction.boundWidget->getSize().x;
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingHeight:
+                    instruction.value = instruction.boundWidget->getSize().y;
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingInnerWidth:
+                    if (instruction.boundWidget->isContainer())
+                        instruction.value = static_cast<const Container*>(instruction.boundWidget)->getInnerSize().x;
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingInnerHeight:
+                    if (instruction.boundWidget->isContainer())
+                        instruction.value = static_cast<const Container*>(instruction.boundWidget)->getInnerSize().y;
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingString:
+                    // The string wasn't parsed yet, either because something is wrong with the string or because the layout
+                    // was not connected to a widget with a parent yet. The last known value is used until the string is parsed.
+                    stack[stackSize++] = instruction.value;
+                    break;
+            };
+        }
+
+        TGUI_ASSERT(stackSize == 1, "Layout instructions should reduce to a single value");
+        m_value = stack[0];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::parseExpression(String expression)
+    {
+        const auto createLayout = [](String subExpression) {
+                Layout layout;
+                layout.parseExpression(std::move(subExpression));
+                return layout;
+            };
+
+        const auto createBindingString = [](String bindingString) {
+                Layout layout;
+                layout.initBindingString(std::move(bindingString));
+                return layout;
+            };
+
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus,
         // where "-x" is parsed as "" - "x").
         expression = expression.trim();
@@ -88,14 +612,13 @@ namespace tgui
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == U"100%")
                 {
-                    m_boundString = U"&.innersize";
-                    m_operation = Operation::BindingString;
+                    initBindingString(U"&.innersize");
                 }
                 else // value is a fraction of parent size
                 {
                     *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(expression.substr(0, expression.length()-1).toFloat() / 100.f),
-                                   std::make_unique<Layout>(U"&.innersize")};
+                                   Layout{expression.substr(0, expression.length()-1).toFloat() / 100.f},
+                                   createBindingString(U"&.innersize")};
                 }
             }
             else
@@ -119,20 +642,19 @@ namespace tgui
                  || (partAfterDot == U"size") || (partAfterDot == U"innersize"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    initBindingString(expression);
                 }
                 else if (partAfterDot == U"right")
                 {
                     *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + U"left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + U"width")};
+                                   createBindingString(expression.substr(0, expression.size()-5) + U"left"),
+                                   createBindingString(expression.substr(0, expression.size()-5) + U"width")};
                 }
                 else if (partAfterDot == U"bottom")
                 {
                     *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + U"top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + U"height")};
+                                   createBindingString(expression.substr(0, expression.size()-6) + U"top"),
+                                   createBindingString(expression.substr(0, expression.size()-6) + U"height")};
                 }
                 else // Constant value
                 {
@@ -156,19 +678,19 @@ namespace tgui
             {
             case '+':
                 operators.push_back(Operation::Plus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(createLayout(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '-':
                 operators.push_back(Operation::Minus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(createLayout(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '*':
                 operators.push_back(Operation::Multiplies);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(createLayout(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '/':
                 operators.push_back(Operation::Divides);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(createLayout(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '(':
             {
@@ -186,19 +708,19 @@ namespace tgui
                         // If the entire layout was in brackets then remove these brackets
                         if ((searchPos == 0) && (bracketPos == expression.size()-1))
                         {
-                            *this = Layout{expression.substr(1, expression.size()-2)};
+                            *this = createLayout(expression.substr(1, expression.size()-2));
                             return;
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == U"min"))
                         {
                             const auto& minSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Minimum, std::make_unique<Layout>(minSubExpressions.first), std::make_unique<Layout>(minSubExpressions.second)};
+                            *this = Layout{Operation::Minimum, createLayout(minSubExpressions.first), createLayout(minSubExpressions.second)};
                             return;
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == U"max"))
                         {
                             const auto& maxSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Maximum, std::make_unique<Layout>(maxSubExpressions.first), std::make_unique<Layout>(maxSubExpressions.second)};
+                            *this = Layout{Operation::Maximum, createLayout(maxSubExpressions.first), createLayout(maxSubExpressions.second)};
                             return;
                         }
                         else // The brackets form a sub-expression
@@ -238,7 +760,7 @@ namespace tgui
             return;
         }
 
-        operands.emplace_back(expression.substr(prevSearchPos));
+        operands.push_back(createLayout(expression.substr(prevSearchPos)));
 
         // First perform all * and / operations
         auto operandIt = operands.begin();
@@ -253,9 +775,7 @@ namespace tgui
             auto nextOperandIt = operandIt;
             std::advance(nextOperandIt, 1);
 
-            (*operandIt) = Layout{operatorToApply,
-                                  std::make_unique<Layout>(*operandIt),
-                                  std::make_unique<Layout>(*nextOperandIt)};
+            (*operandIt) = Layout{operatorToApply, std::move(*operandIt), std::move(*nextOperandIt)};
 
             operands.erase(nextOperandIt);
         }
@@ -275,297 +795,106 @@ namespace tgui
             TGUI_ASSERT(nextOperandIt != operands.end(), "Second operand not found in plus or minus operation");
 
             // Handle unary plus or minus
-            if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+            if (operandIt->isConstant() && nextOperandIt->isConstant() && (operandIt->m_value == 0))
             {
                 if (operatorToApply == Operation::Minus)
                     nextOperandIt->m_value = -nextOperandIt->m_value;
 
-                *operandIt = *nextOperandIt;
+                *operandIt = std::move(*nextOperandIt);
             }
             else // Normal addition or subtraction
             {
-                *operandIt = Layout{operatorToApply,
-                                    std::make_unique<Layout>(*operandIt),
-                                    std::make_unique<Layout>(*nextOperandIt)};
+                *operandIt = Layout{operatorToApply, std::move(*operandIt), std::move(*nextOperandIt)};
             }
 
             operands.erase(nextOperandIt);
         }
 
         TGUI_ASSERT(operands.size() == 1, "Layout constructor should reduce expression to single result");
-        *this = operands.front();
+        *this = std::move(operands.front());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    void Layout::initBindingString(String expression)
     {
-        TGUI_ASSERT(m_boundWidget != nullptr, "Bound widget passed to Layout constructor can't be a nullptr");
-        TGUI_ASSERT((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-               || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight),
-            "Layout constructor with bound widget must be called with an operation that involves the widget"
-        );
-
-        // TODO: Try to resolve the code duplicate with recalculateValue()
-        if (m_operation == Operation::BindingPosX)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingPosY)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
-
-        resetPointers();
-        recalculateValue();
+        m_instructions = {Instruction{Operation::BindingString, 0, nullptr, 0}};
+        m_boundStrings = std::make_shared<std::vector<String>>(1, std::move(expression));
+        m_stackSize = 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
-    {
-        TGUI_ASSERT(m_leftOperand != nullptr, "Left operand in layout constructor can't be a nullptr");
-        TGUI_ASSERT(m_rightOperand != nullptr, "Right operand in layout constructor can't be a nullptr");
-
-        resetPointers();
-        recalculateValue();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {nullptr},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString},
-        m_connectedWidgetCallback{nullptr},
-        m_callingCallbackCount{0}
-    {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
-        resetPointers();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout::Layout(Layout&& other) noexcept :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)},
-        m_connectedWidgetCallback{std::move(other.m_connectedWidgetCallback)},
-        m_callingCallbackCount{0}
+    void Layout::appendInstructions(const Layout& other)
     {
-        resetPointers();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout& Layout::operator=(const Layout& other)
-    {
-        if (this != &other)
+        if (other.m_instructions.empty())
         {
-            unbindLayout();
-
-            m_value           = other.m_value;
-            m_parent          = nullptr;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
-            m_connectedWidgetCallback = nullptr;
-            m_callingCallbackCount = 0;
-
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
-
-            resetPointers();
+            m_instructions.push_back({Operation::Value, other.m_value, nullptr, -1});
+            return;
         }
 
-        return *this;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout& Layout::operator=(Layout&& other) noexcept
-    {
-        if (this != &other)
+        int boundStringOffset = 0;
+        if (other.m_boundStrings)
         {
-            unbindLayout();
-
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
-            m_connectedWidgetCallback = std::move(other.m_connectedWidgetCallback);
-            m_callingCallbackCount = 0;
-
-            resetPointers();
+            if (m_boundStrings)
+            {
+                auto boundStrings = std::make_shared<std::vector<String>>(*m_boundStrings);
+                boundStrings->insert(boundStrings->end(), other.m_boundStrings->begin(), other.m_boundStrings->end());
+                boundStringOffset = static_cast<int>(m_boundStrings->size());
+                m_boundStrings = std::move(boundStrings);
+            }
+            else // The strings don't need to be copied, they are never changed after creation
+                m_boundStrings = other.m_boundStrings;
         }
 
-        return *this;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout::~Layout()
-    {
-        unbindLayout();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Layout::replaceValue(const Layout& value)
-    {
-        // Copy the layout, but keep the original parent
-        const auto oldParent = m_parent;
-        *this = value;
-        m_parent = oldParent;
-
-        // Inform the parent that the value of the layout has changed
-        if (m_parent)
-            m_parent->recalculateValue();
+        m_instructions.reserve(m_instructions.size() + other.m_instructions.size() + 1);
+        for (const auto& instruction : other.m_instructions)
+        {
+            m_instructions.push_back(instruction);
+            if (instruction.boundStringIndex >= 0)
+                m_instructions.back().boundStringIndex += boundStringOffset;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    String Layout::toString() const
+    String Layout::bindingToString(const Instruction& instruction) const
     {
-        if (m_operation == Operation::Value)
-        {
-            return String::fromNumber(m_value);
-        }
-        else if (m_operation == Operation::Minimum)
+        // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+        if (instruction.boundStringIndex >= 0)
         {
-            return U"min(" + m_leftOperand->toString() + U", " + m_rightOperand->toString() + U")";
+            const String& boundString = (*m_boundStrings)[static_cast<std::size_t>(instruction.boundStringIndex)];
+            if (boundString == U"&.innersize")
+                return U"100%";
+            else
+                return boundString;
         }
-        else if (m_operation == Operation::Maximum)
+
+        TGUI_ASSERT(instruction.boundWidget != nullptr, "There has to be a bound widget with this operation type");
+        const String boundWidgetName = instruction.boundWidget->getWidgetName();
+        if (boundWidgetName.empty())
         {
-            return U"max(" + m_leftOperand->toString() + U", " + m_rightOperand->toString() + U")";
+            TGUI_PRINT_WARNING("layout can't be correctly converted to string because the bound widget has no name");
         }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
-        {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
-
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
-                {
-                    if (!operand->m_leftOperand)
-                        return false;
 
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
-                        return false;
-
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == U"100%"))
-                        return false;
-
-                    return true;
-                };
-
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return U"(" + m_leftOperand->toString() + U") " + operatorChar + U" (" + m_rightOperand->toString() + U")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return U"(" + m_leftOperand->toString() + U") " + operatorChar + U" " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + U" " + operatorChar + U" (" + m_rightOperand->toString() + U")";
-            else
-            {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == U"100%"))
-                    return String::fromNumber(m_leftOperand->getValue() * 100) + '%';
-                else
-                    return m_leftOperand->toString() + U" " + operatorChar + U" " + m_rightOperand->toString();
-            }
-        }
+        if (instruction.operation == Operation::BindingPosX)
+            return boundWidgetName + U".x";
+        else if (instruction.operation == Operation::BindingPosY)
+            return boundWidgetName + U".y";
+        else if (instruction.operation == Operation::BindingLeft)
+            return boundWidgetName + U".left";
+        else if (instruction.operation == Operation::BindingTop)
+            return boundWidgetName + U".top";
+        else if (instruction.operation == Operation::BindingWidth)
+            return boundWidgetName + U".width";
+        else if (instruction.operation == Operation::BindingHeight)
+            return boundWidgetName + U".height";
+        else if (instruction.operation == Operation::BindingInnerWidth)
+            return boundWidgetName + U".innerwidth";
         else
         {
-            if (m_boundString == U"&.innersize")
-                return U"100%";
-
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            if (!m_boundString.empty())
-                return m_boundString;
-            else
-            {
-                if ((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-                 || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                 || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                 || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight))
-                {
-                    TGUI_ASSERT(m_boundWidget != nullptr, "There has to be a bound widget with this operation type");
-                    const String boundWidgetName = m_boundWidget->getWidgetName();
-                    if (boundWidgetName.empty())
-                    {
-                        TGUI_PRINT_WARNING("layout can't be correctly converted to string because the bound widget has no name");
-                    }
-
-                    if (m_operation == Operation::BindingPosX)
-                        return boundWidgetName + U".x";
-                    else if (m_operation == Operation::BindingPosY)
-                        return boundWidgetName + U".y";
-                    else if (m_operation == Operation::BindingLeft)
-                        return boundWidgetName + U".left";
-                    else if (m_operation == Operation::BindingTop)
-                        return boundWidgetName + U".top";
-                    else if (m_operation == Operation::BindingWidth)
-                        return boundWidgetName + U".width";
-                    else if (m_operation == Operation::BindingHeight)
-                        return boundWidgetName + U".height";
-                    else if (m_operation == Operation::BindingInnerWidth)
-                        return boundWidgetName + U".innerwidth";
-                    else
-                    {
-                        TGUI_ASSERT(m_operation == Operation::BindingInnerHeight, "Operation can't be anything other than BindingInnerHeight here");
-                        return boundWidgetName + U".innerheight";
-                    }
-                }
-
-                // The layout contains an empty string
-                TGUI_ASSERT(m_operation == Operation::BindingString, "All operation types should have been covered already");
-                return m_boundString;
-            }
+            TGUI_ASSERT(instruction.operation == Operation::BindingInnerHeight, "Operation can't be anything other than BindingInnerHeight here");
+            return boundWidgetName + U".innerheight";
         }
     }
 
@@ -573,285 +902,130 @@ namespace tgui
 
     void Layout::unbindLayout()
     {
-        if (m_boundWidget)
+        for (const auto& instruction : m_instructions)
         {
-            TGUI_ASSERT((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-                   || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight),
-                "Layout with bound widget should have an operation that involves the widget"
-            );
-
-            if ((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY) || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
+            if (!instruction.boundWidget)
+                continue;
+
+            if (isPositionBinding(instruction.operation))
+                instruction.boundWidget->unbindPositionLayout(this);
             else
-                m_boundWidget->unbindSizeLayout(this);
+                instruction.boundWidget->unbindSizeLayout(this);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::bindLayout()
     {
-        if (m_leftOperand != nullptr)
+        for (const auto& instruction : m_instructions)
         {
-            TGUI_ASSERT(m_rightOperand != nullptr, "If a left operand exists then there should also be a right operand");
-
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
-        }
+            if (!instruction.boundWidget)
+                continue;
 
-        if (m_boundWidget)
-        {
-            TGUI_ASSERT((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY)
-                   || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight),
-                "Layout with bound widget should have an operation that involves the widget"
-            );
-
-            if ((m_operation == Operation::BindingPosX) || (m_operation == Operation::BindingPosY) || (m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
+            if (isPositionBinding(instruction.operation))
+                instruction.boundWidget->bindPositionLayout(this);
             else
-                m_boundWidget->bindSizeLayout(this);
+                instruction.boundWidget->bindSizeLayout(this);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    void Layout::resetBindingStrings()
     {
-        const float oldValue = m_value;
-
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
-
-        parseBindingStringRecursive(widget, xAxis);
-
-        // Restore the callback function
-        m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
+        if (!m_boundStrings)
+            return;
 
-        if (m_value != oldValue)
+        for (auto& instruction : m_instructions)
         {
-            if (m_connectedWidgetCallback)
-            {
-                if (m_callingCallbackCount > 10)
-                {
-                    TGUI_PRINT_WARNING("Dependency cycle detected in layout!")
-                    return;
-                }
+            if (instruction.boundStringIndex < 0)
+                continue;
 
-                ++m_callingCallbackCount;
-                m_connectedWidgetCallback();
-                --m_callingCallbackCount;
-            }
+            instruction.operation = Operation::BindingString;
+            instruction.boundWidget = nullptr;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::printDependencyCycleWarning() const
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        if (m_connectedWidget)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            TGUI_PRINT_WARNING("Dependency cycle detected in layout of widget '" << (m_connectedWidget->getWidgetName().empty()
+                ? m_connectedWidget->getWidgetType() : m_connectedWidget->getWidgetName()) << "'!")
         }
-
-        recalculateValue();
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Layout::recalculateValue()
-    {
-        const float oldValue = m_value;
-
-        switch (m_operation)
-        {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::BindingPosX:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingPosY:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x - (m_boundWidget->getOrigin().x * m_boundWidget->getSize().x);
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y - (m_boundWidget->getOrigin().y * m_boundWidget->getSize().y);
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
-            }
-            case Operation::BindingInnerHeight:
-            {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
-            }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
-        };
-
-        if (m_value != oldValue)
-        {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
-            {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                {
-                    if (m_callingCallbackCount > 10)
-                    {
-                        TGUI_PRINT_WARNING("Dependency cycle detected in layout!")
-                        m_value = 0;
-                    }
-
-                    ++m_callingCallbackCount;
-                    m_connectedWidgetCallback();
-                    --m_callingCallbackCount;
-                }
-            }
-        }
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout* Layout::getLeftOperand() const
-    {
-        return m_leftOperand ? m_leftOperand.get() : nullptr;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    Layout* Layout::getRightOperand() const
-    {
-        return m_rightOperand ? m_rightOperand.get() : nullptr;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
-    {
-        if (m_leftOperand)
+        else
         {
-            TGUI_ASSERT(m_rightOperand != nullptr, "If a left operand exists then there should also be a right operand");
-
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+            TGUI_PRINT_WARNING("Dependency cycle detected in layout!")
         }
-
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const String& expression, Widget* widget, bool xAxis)
+    bool Layout::parseBindingString(Instruction& instruction, const String& expression, Widget* widget, bool xAxis)
     {
         if (expression == U"x")
         {
-            m_operation = Operation::BindingPosX;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingPosX;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"y")
         {
-            m_operation = Operation::BindingPosY;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingPosY;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"left")
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingLeft;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"top")
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingTop;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"w" || expression == U"width")
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingWidth;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"h" || expression == U"height")
         {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingHeight;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"iw" || expression == U"innerwidth")
         {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingInnerWidth;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"ih" || expression == U"innerheight")
         {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
+            instruction.operation = Operation::BindingInnerHeight;
+            instruction.boundWidget = widget;
         }
         else if (expression == U"size")
         {
             if (xAxis)
-                return parseBindingString(U"width", widget, xAxis);
+                return parseBindingString(instruction, U"width", widget, xAxis);
             else
-                return parseBindingString(U"height", widget, xAxis);
+                return parseBindingString(instruction, U"height", widget, xAxis);
         }
         else if (expression == U"innersize")
         {
             if (xAxis)
-                return parseBindingString(U"innerwidth", widget, xAxis);
+                return parseBindingString(instruction, U"innerwidth", widget, xAxis);
             else
-                return parseBindingString(U"innerheight", widget, xAxis);
+                return parseBindingString(instruction, U"innerheight", widget, xAxis);
         }
         else if ((expression == U"pos") || (expression == U"position"))
         {
             if (xAxis)
-                return parseBindingString(U"x", widget, xAxis);
+                return parseBindingString(instruction, U"x", widget, xAxis);
             else
-                return parseBindingString(U"y", widget, xAxis);
+                return parseBindingString(instruction, U"y", widget, xAxis);
         }
         else
         {
@@ -862,10 +1036,10 @@ namespace tgui
                 if (widgetName == U"parent" || widgetName == U"&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(instruction, expression.substr(dotPos+1), widget->getParent(), xAxis);
 
                     // If there is no parent yet then patiently wait until the widget is added to its parent
-                    return;
+                    return false;
                 }
                 else if (!widgetName.empty())
                 {
@@ -877,7 +1051,7 @@ namespace tgui
                         for (const auto& childWidget : widgets)
                         {
                             if (childWidget->getWidgetName().equalIgnoreCase(widgetName))
-                                return parseBindingString(expression.substr(dotPos+1), childWidget.get(), xAxis);
+                                return parseBindingString(instruction, expression.substr(dotPos+1), childWidget.get(), xAxis);
                         }
                     }
 
@@ -888,21 +1062,20 @@ namespace tgui
                         for (const auto& siblingWidget : widgets)
                         {
                             if (siblingWidget->getWidgetName().equalIgnoreCase(widgetName))
-                                return parseBindingString(expression.substr(dotPos+1), siblingWidget.get(), xAxis);
+                                return parseBindingString(instruction, expression.substr(dotPos+1), siblingWidget.get(), xAxis);
                         }
                     }
                     else // If there is no parent yet then patiently wait until the widget is added to its parent
-                        return;
+                        return false;
                 }
             }
 
             // The referred widget was not found or there was something wrong with the string
             TGUI_PRINT_WARNING("failed to find bound widget in expression '" << expression << "'.");
-            return;
+            return false;
         }
 
-        resetPointers();
-        recalculateValue();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -910,35 +1083,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1049,8 +1222,8 @@ namespace tgui
         Layout bindRight(const Widget::Ptr& widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+                          Layout{Layout::Operation::BindingLeft, widget.get()},
+                          Layout{Layout::Operation::BindingWidth, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1058,8 +1231,8 @@ namespace tgui
         Layout bindBottom(const Widget::Ptr& widget)
         {
             return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+                          Layout{Layout::Operation::BindingTop, widget.get()},
+                          Layout{Layout::Operation::BindingHeight, widget.get()}};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1108,14 +1281,14 @@ namespace tgui
 
         Layout bindMin(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Minimum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Minimum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindMax(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Maximum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Maximum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
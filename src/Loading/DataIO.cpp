@@ -31,56 +31,17 @@
 #else
     #include <cctype> // isspace
     #include <algorithm>
+    #include <cstdint>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
-    for (;;) \
-    { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
-            break; \
-        \
-        if (stream.peek() == '/') \
-        { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
-            } \
-            else if (stream.peek() == '*') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
-                continue; \
-            } \
-            else \
-                return "Unexpected '/' found."; \
-            \
-            continue; \
-        } \
-        break; \
-    } \
+    if (!input.skipWhitespaceAndComments()) \
+        return "Unexpected '/' found."; \
     \
-    if (stream.peek() == EOF) \
+    if (input.peek() == EOF) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -94,209 +55,341 @@ namespace tgui
 {
     namespace
     {
+        // Reads the UTF-8 encoded input directly from memory. Names and values are returned as views into the input (or into
+        // a buffer if comments or whitespace had to be removed from them) and only converted to String when they are stored.
+        class InputBuffer
+        {
+        public:
+            explicit InputBuffer(CharStringView data) :
+                m_begin{data.data()},
+                m_pos{data.data()},
+                m_end{data.data() + data.size()}
+            {
+            }
+
+            TGUI_NODISCARD int peek() const
+            {
+                return (m_pos != m_end) ? static_cast<unsigned char>(*m_pos) : EOF;
+            }
+
+            char read()
+            {
+                return (m_pos != m_end) ? *m_pos++ : '\0';
+            }
+
+            TGUI_NODISCARD const char* getPosition() const
+            {
+                return m_pos;
+            }
+
+            TGUI_NODISCARD std::size_t getLineNumber() const
+            {
+                return static_cast<std::size_t>(std::count(m_begin, m_pos, '\n')) + 1;
+            }
+
+            // Skips everything up to and including the next newline
+            void skipLineComment()
+            {
+                while (m_pos != m_end)
+                {
+                    if (*m_pos++ == '\n')
+                        break;
+                }
+            }
+
+            // Skips the contents of the comment, the '/' must already have been read and the '*' must be the next character
+            void skipBlockComment()
+            {
+                while (m_pos != m_end)
+                {
+                    ++m_pos;
+                    if ((m_pos != m_end) && (*m_pos == '*'))
+                    {
+                        ++m_pos;
+                        if ((m_pos != m_end) && (*m_pos == '/'))
+                        {
+                            ++m_pos;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            // Skips the contents of a string, the opening quote must already have been read
+            void skipQuotedString()
+            {
+                bool backslash = false;
+                while (m_pos != m_end)
+                {
+                    const char c = *m_pos++;
+                    if (c == '"' && !backslash)
+                        break;
+
+                    if (c == '\\' && !backslash)
+                        backslash = true;
+                    else
+                        backslash = false;
+                }
+            }
+
+            // Returns false if a slash was found that wasn't part of a comment
+            TGUI_NODISCARD bool skipWhitespaceAndComments()
+            {
+                for (;;)
+                {
+                    while ((m_pos != m_end) && std::isspace(static_cast<unsigned char>(*m_pos)))
+                        ++m_pos;
+
+                    if ((m_pos == m_end) || (*m_pos != '/'))
+                        return true;
+
+                    ++m_pos;
+                    if (peek() == '/')
+                        skipLineComment();
+                    else if (peek() == '*')
+                        skipBlockComment();
+                    else
+                        return false;
+                }
+            }
+
+        private:
+            const char* m_begin;
+            const char* m_pos;
+            const char* m_end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Builds a token from parts of the input. As long as nothing had to be left out, no characters are copied.
+        class TokenBuilder
+        {
+        public:
+            explicit TokenBuilder(const char* start) :
+                m_start{start},
+                m_segmentStart{start}
+            {
+            }
+
+            // Leaves out the characters between the end of the current segment and the start of the next one
+            void skip(const char* segmentEnd, const char* nextSegmentStart)
+            {
+                m_buffer.append(m_segmentStart, segmentEnd);
+                m_segmentStart = nextSegmentStart;
+                m_buffered = true;
+            }
+
+            // Adds a character that doesn't occur at this location in the input
+            void insert(const char* segmentEnd, char c, const char* nextSegmentStart)
+            {
+                skip(segmentEnd, nextSegmentStart);
+                m_buffer.push_back(c);
+            }
+
+            TGUI_NODISCARD CharStringView finish(const char* end)
+            {
+                if (!m_buffered)
+                    return {m_start, static_cast<std::size_t>(end - m_start)};
+
+                m_buffer.append(m_segmentStart, end);
+                return {m_buffer.data(), m_buffer.size()};
+            }
+
+        private:
+            const char* m_start;
+            const char* m_segmentStart;
+            std::string m_buffer;
+            bool m_buffered = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD bool isWhitespaceChar(char c)
+        {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD CharStringView trimView(CharStringView view)
+        {
+            std::size_t first = 0;
+            while ((first < view.size()) && isWhitespaceChar(view[first]))
+                ++first;
+
+            std::size_t last = view.size();
+            while ((last > first) && isWhitespaceChar(view[last - 1]))
+                --last;
+
+            return view.substr(first, last - first);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD String toString(CharStringView view)
+        {
+            return String(view.data(), view.size());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
+        String parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, String sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readWord(std::stringstream& stream)
+        // Returns an empty view when no word was found. The returned view remains valid as long as the token builder exists.
+        CharStringView readWord(InputBuffer& input, TokenBuilder& word)
         {
-            String word = "";
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
-                char c = static_cast<char>(stream.peek());
+                const char c = static_cast<char>(input.peek());
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
-                    return word;
+                    const CharStringView result = word.finish(input.getPosition());
+                    input.read();
+                    return result;
                 }
-                else if (!std::isspace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}'))
+                else if (!isWhitespaceChar(c) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}'))
                 {
-                    stream.read(&c, 1);
+                    const char* const charPos = input.getPosition();
+                    input.read();
 
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (input.peek() == '/'))
                     {
-                        while (stream.peek() != EOF)
+                        input.skipLineComment();
+                        if (input.getPosition()[-1] == '\n')
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
-                                                           "(comment would have been skipped earlier)");
-                                return word;
-                            }
+                            const CharStringView result = word.finish(charPos);
+                            TGUI_ASSERT(!result.empty(), "There is no known case in which you can pass here with an empty word "
+                                                         "(comment would have been skipped earlier)");
+                            return result;
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (input.peek() == '*'))
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (c == '*')
+                            if ((input.read() == '*') && (input.peek() == '/'))
                             {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
+                                input.read();
+                                break;
                             }
                         }
-                    }
-                    else if (c == '"')
-                    {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
 
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
+                        word.skip(charPos, input.getPosition());
                     }
-                    else
-                        word.push_back(c);
+                    else if (c == '"')
+                        input.skipQuotedString();
                 }
                 else
-                    return word;
+                    return word.finish(input.getPosition());
             }
 
-            return "";
+            return {};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readLine(std::stringstream& stream)
+        // Returns an empty view when no value was found. The returned view remains valid as long as the token builder exists.
+        CharStringView readLine(InputBuffer& input, TokenBuilder& line)
         {
-            std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
-                char c = static_cast<char>(stream.peek());
+                char c = static_cast<char>(input.peek());
+                const char* charPos = input.getPosition();
 
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    input.read();
+                    if (input.peek() == '/')
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
+                        input.skipLineComment();
+                        line.skip(charPos, input.getPosition());
                     }
-                    else if (stream.peek() == '*')
+                    else if (input.peek() == '*')
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
+                        input.skipBlockComment();
+                        line.skip(charPos, input.getPosition());
                     }
                     else // The slash is part of the value
-                    {
                         whitespaceFound = false;
-                        line.push_back(c);
-                    }
 
                     continue;
                 }
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
+                    input.read();
+                    input.skipQuotedString();
 
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
+                    if (input.peek() == EOF)
+                        return {};
 
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
-                        return "";
-
-                    c = static_cast<char>(stream.peek());
+                    c = static_cast<char>(input.peek());
+                    charPos = input.getPosition();
                 }
 
                 if ((c == '=') || (c == '{'))
-                    return "";
+                    return {};
                 else if ((c == ';') || (c == '}'))
                 {
                     // Remove trailing whitespace before returning the line
-                    line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
+                    CharStringView result = line.finish(charPos);
+                    while (!result.empty() && ((result.back() == ' ') || (result.back() == '\n') || (result.back() == '\r') || (result.back() == '\t')))
+                        result = result.substr(0, result.size() - 1);
+
+                    return result;
                 }
-                else if (::isspace(c))
+                else if (isWhitespaceChar(c))
                 {
-                    stream.read(&c, 1);
+                    input.read();
                     if (!whitespaceFound)
                     {
+                        // Consecutive whitespace is replaced by a single space
                         whitespaceFound = true;
-                        line.push_back(' ');
+                        if (c != ' ')
+                            line.insert(charPos, ' ', input.getPosition());
                     }
+                    else
+                        line.skip(charPos, input.getPosition());
                 }
                 else
                 {
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    input.read();
                 }
             }
 
-            return "";
+            return {};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
+        String parseKeyValue(InputBuffer& input, std::unique_ptr<DataIO::Node>& node, String key)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            // Read the assignment symbol from the input and remove the whitespace behind it
+            input.read();
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
             // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+            if (input.peek() == '{')
+                return parseSection(input, node, std::move(key));
 
             // Read the value
-            String line = readLine(stream).trim();
-            if (!line.empty())
+            TokenBuilder lineBuilder{input.getPosition()};
+            const CharStringView line = trimView(readLine(input, lineBuilder));
+            String value = toString(line);
+            if (!value.empty())
             {
                 // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                if (input.peek() == ';')
+                    input.read();
 
                 // Create a value node to store the value
-                auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
+                auto valueNode = std::make_unique<DataIO::ValueNode>(std::move(value));
 
                 // It might be a list node
                 if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
@@ -304,27 +397,23 @@ namespace tgui
                     valueNode->listNode = true;
                     if (line.size() >= 3)
                     {
-                        valueNode->valueList.emplace_back("");
-
+                        std::size_t elementStart = 1;
                         std::size_t i = 1;
                         while (i < line.size()-1)
                         {
                             if (line[i] == ',')
                             {
+                                valueNode->valueList.push_back(toString(trimView(line.substr(elementStart, i - elementStart))));
                                 i++;
-                                valueNode->valueList.back() = valueNode->valueList.back().trim();
-                                valueNode->valueList.emplace_back("");
+                                elementStart = i;
                             }
                             else if (line[i] == '"')
                             {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
                                 i++;
 
                                 bool backslash = false;
                                 while (i < line.size()-1)
                                 {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-
                                     if (line[i] == '"' && !backslash)
                                     {
                                         i++;
@@ -340,26 +429,23 @@ namespace tgui
                                 }
                             }
                             else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
                                 i++;
-                            }
                         }
 
-                        valueNode->valueList.back() = valueNode->valueList.back().trim();
+                        valueNode->valueList.push_back(toString(trimView(line.substr(elementStart, i - elementStart))));
                     }
                 }
 
-                node->propertyValuePairs[key] = std::move(valueNode);
+                node->propertyValuePairs[std::move(key)] = std::move(valueNode);
                 return "";
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.peek() == EOF)
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = static_cast<char>(stream.peek());
+                    const char chr = static_cast<char>(input.peek());
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -372,17 +458,19 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseInheritance(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseInheritance(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, String sectionName)
         {
-            // Read the colon from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Read the colon from the input
+            input.read();
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-            String baseSectionName = readWord(stream);
-            if (baseSectionName.empty())
+            TokenBuilder wordBuilder{input.getPosition()};
+            const CharStringView word = readWord(input, wordBuilder);
+            if (word.empty())
                 return "Expected name of base section to inherit from after ':'.";
 
+            const String baseSectionName = toString(word);
+
             const DataIO::Node* parentNode = node.get();
             const DataIO::Node* baseSectionNode = nullptr;
             while (!baseSectionNode && parentNode)
@@ -403,10 +491,10 @@ namespace tgui
                 return "Failed to find base section '" + baseSectionName + "' to inherit from.";
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() != '{')
+            if (input.peek() != '{')
                 return "Expected '{' after specifying base section to inherit from.";
 
-            const auto& error = parseSection(stream, node, sectionName);
+            const auto& error = parseSection(input, node, std::move(sectionName));
             if (!error.empty())
                 return error;
 
@@ -434,65 +522,66 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        String parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, String sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
+            sectionNode->name = std::move(sectionName);
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Read the brace from the input
+            input.read();
 
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                String word = readWord(stream);
-                if (word == U"")
+                TokenBuilder wordBuilder{input.getPosition()};
+                const CharStringView word = readWord(input, wordBuilder);
+                if (word.empty())
                 {
-                    if (stream.peek() == EOF)
+                    if (input.peek() == EOF)
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (input.peek() == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        input.read();
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (input.peek() == ';')
+                            input.read();
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (input.peek() != '{')
+                        return "Expected property or nested section name, found '" + String(1, static_cast<char>(input.peek())) + "' instead.";
                 }
 
+                String name = toString(word);
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (input.peek() == '{')
                 {
-                    String error = parseSection(stream, sectionNode, word);
+                    String error = parseSection(input, sectionNode, std::move(name));
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (input.peek() == '=')
                 {
-                    String error = parseKeyValue(stream, sectionNode, word);
+                    String error = parseKeyValue(input, sectionNode, std::move(name));
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == ':')
+                else if (input.peek() == ':')
                 {
-                    String error = parseInheritance(stream, sectionNode, word);
+                    String error = parseInheritance(input, sectionNode, std::move(name));
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(input.peek())) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -500,27 +589,29 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        String parseRootSection(InputBuffer& input, std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            String word = readWord(stream);
-            if (word == U"")
+            TokenBuilder wordBuilder{input.getPosition()};
+            const CharStringView word = readWord(input, wordBuilder);
+            if (word.empty())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (input.peek() != '{')
+                    return "Expected section name, found '" + String(1, static_cast<char>(input.peek())) + "' instead.";
             }
 
+            String name = toString(word);
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
-            else if (stream.peek() == ':')
-                return parseInheritance(stream, root, word);
+            if (input.peek() == '{')
+                return parseSection(input, root, std::move(name));
+            else if (input.peek() == '=')
+                return parseKeyValue(input, root, std::move(name));
+            else if (input.peek() == ':')
+                return parseInheritance(input, root, std::move(name));
             else
-                return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(input.peek())) + "' instead.";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -564,30 +655,205 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The first byte of the header can't occur in a text file, so binary files can't be mistaken for text files
+        const char binaryHeader[] = {'\0', 'T', 'G', 'U', 'I', 'B', 'I', 'N'};
+        const std::uint32_t binaryFormatVersion = 1;
+
+        // Limits the recursion while reading binary data, so that corrupt or malicious input can't overflow the stack
+        const unsigned int maxBinaryNodeDepth = 256;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUInt32(std::stringstream& stream, std::uint32_t value)
+        {
+            const char bytes[4] = {static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF),
+                                   static_cast<char>((value >> 16) & 0xFF), static_cast<char>((value >> 24) & 0xFF)};
+            stream.write(bytes, 4);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Assigns an index to every distinct string in the tree, in the order in which they are first encountered
+        void collectStrings(const DataIO::Node& node, std::map<String, std::uint32_t>& indices, std::vector<const String*>& strings)
+        {
+            const auto addString = [&indices,&strings](const String& str){
+                const auto it = indices.emplace(str, static_cast<std::uint32_t>(strings.size()));
+                if (it.second)
+                    strings.push_back(&it.first->first);
+            };
+
+            addString(node.name);
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                addString(pair.first);
+                addString(pair.second->value);
+                for (const auto& listValue : pair.second->valueList)
+                    addString(listValue);
+            }
+
+            for (const auto& child : node.children)
+                collectStrings(*child, indices, strings);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeBinaryNode(std::stringstream& stream, const DataIO::Node& node, const std::map<String, std::uint32_t>& indices)
+        {
+            writeUInt32(stream, indices.at(node.name));
+
+            writeUInt32(stream, static_cast<std::uint32_t>(node.propertyValuePairs.size()));
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                writeUInt32(stream, indices.at(pair.first));
+                writeUInt32(stream, indices.at(pair.second->value));
+                if (pair.second->listNode)
+                {
+                    writeUInt32(stream, static_cast<std::uint32_t>(pair.second->valueList.size()) + 1);
+                    for (const auto& listValue : pair.second->valueList)
+                        writeUInt32(stream, indices.at(listValue));
+                }
+                else
+                    writeUInt32(stream, 0);
+            }
+
+            writeUInt32(stream, static_cast<std::uint32_t>(node.children.size()));
+            for (const auto& child : node.children)
+                writeBinaryNode(stream, *child, indices);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the binary format directly from memory, all numbers are stored as 32-bit little endian values
+        class BinaryReader
+        {
+        public:
+            explicit BinaryReader(CharStringView data) :
+                m_pos{data.data()},
+                m_end{data.data() + data.size()}
+            {
+            }
+
+            TGUI_NODISCARD std::uint32_t readUInt32()
+            {
+                if (m_end - m_pos < 4)
+                    throw Exception{U"Error while parsing binary input. Unexpected end of data."};
+
+                const auto* bytes = reinterpret_cast<const unsigned char*>(m_pos);
+                m_pos += 4;
+                return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                     | (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+            }
+
+            // Reads a count and verifies that the data is large enough to contain that many elements of the given size
+            TGUI_NODISCARD std::uint32_t readCount(std::size_t minElementSize)
+            {
+                const std::uint32_t count = readUInt32();
+                if (static_cast<std::size_t>(count) > static_cast<std::size_t>(m_end - m_pos) / minElementSize)
+                    throw Exception{U"Error while parsing binary input. Unexpected end of data."};
+
+                return count;
+            }
+
+            TGUI_NODISCARD CharStringView readBytes(std::size_t count)
+            {
+                if (static_cast<std::size_t>(m_end - m_pos) < count)
+                    throw Exception{U"Error while parsing binary input. Unexpected end of data."};
+
+                const CharStringView bytes{m_pos, count};
+                m_pos += count;
+                return bytes;
+            }
+
+        private:
+            const char* m_pos;
+            const char* m_end;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TGUI_NODISCARD const String& readBinaryString(BinaryReader& reader, const std::vector<String>& strings)
+        {
+            const std::uint32_t index = reader.readUInt32();
+            if (index >= strings.size())
+                throw Exception{U"Error while parsing binary input. Invalid string index."};
+
+            return strings[index];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void readBinaryNode(BinaryReader& reader, DataIO::Node& node, const std::vector<String>& strings, unsigned int depth)
+        {
+            if (depth > maxBinaryNodeDepth)
+                throw Exception{U"Error while parsing binary input. Sections are nested more than " + String::fromNumber(maxBinaryNodeDepth) + U" levels deep."};
+
+            node.name = readBinaryString(reader, strings);
+
+            // Properties were written in sorted order, so they can always be inserted at the end of the map
+            const std::uint32_t propertyCount = reader.readCount(12);
+            for (std::uint32_t i = 0; i < propertyCount; ++i)
+            {
+                const String& key = readBinaryString(reader, strings);
+                auto valueNode = std::make_unique<DataIO::ValueNode>(readBinaryString(reader, strings));
+
+                const std::uint32_t listSize = reader.readCount(4);
+                if (listSize > 0)
+                {
+                    valueNode->listNode = true;
+                    valueNode->valueList.reserve(listSize - 1);
+                    for (std::uint32_t j = 0; j < listSize - 1; ++j)
+                        valueNode->valueList.push_back(readBinaryString(reader, strings));
+                }
+
+                node.propertyValuePairs.emplace_hint(node.propertyValuePairs.end(), key, std::move(valueNode));
+            }
+
+            const std::uint32_t childCount = reader.readCount(12);
+            node.children.reserve(childCount);
+            for (std::uint32_t i = 0; i < childCount; ++i)
+            {
+                auto child = std::make_unique<DataIO::Node>();
+                child->parent = &node;
+                readBinaryNode(reader, *child, strings, depth + 1);
+                node.children.push_back(std::move(child));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
     {
+        // Parse the remaining contents of the stream
+        const auto position = stream.tellg();
+        if (position == std::stringstream::pos_type(-1))
+            return std::make_unique<Node>();
+
+        const std::string str = stream.str();
+        stream.seekg(0, std::ios::end);
+
+        const auto offset = std::min(static_cast<std::size_t>(position), str.size());
+        return parse(CharStringView{str.data() + offset, str.size() - offset});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(CharStringView data)
+    {
+        if (isBinary(data))
+            return parseBinary(data);
+
         auto root = std::make_unique<Node>();
 
-        String error;
-        while (stream.peek() != EOF)
+        InputBuffer input{data};
+        while (input.peek() != EOF)
         {
-            error = parseRootSection(stream, root);
+            const String error = parseRootSection(input, root);
             if (!error.empty())
-            {
-                const auto position = stream.tellg();
-                if (position != std::stringstream::pos_type(-1))
-                {
-                    String str = stream.str();
-                    auto lineNumber = std::count(str.begin(), str.begin() + static_cast<std::ptrdiff_t>(position), U'\n') + 1;
-                    throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
-                }
-                else
-                    throw Exception{U"Error while parsing input. " + error};
-            }
+                throw Exception{U"Error while parsing input at line " + String::fromNumber(input.getLineNumber()) + U". " + error};
         }
 
         return root;
@@ -595,6 +861,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool DataIO::isBinary(CharStringView data)
+    {
+        return (data.size() >= sizeof(binaryHeader)) && (std::memcmp(data.data(), binaryHeader, sizeof(binaryHeader)) == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parseBinary(CharStringView data)
+    {
+        if (!isBinary(data))
+            throw Exception{U"Error while parsing binary input. The data doesn't start with the expected header."};
+
+        BinaryReader reader{data.substr(sizeof(binaryHeader))};
+        const std::uint32_t version = reader.readUInt32();
+        if (version != binaryFormatVersion)
+            throw Exception{U"Error while parsing binary input. Unsupported format version " + String::fromNumber(version) + U"."};
+
+        // Every distinct string is only converted from UTF-8 once, nodes copy the converted strings
+        std::vector<String> strings;
+        const std::uint32_t stringCount = reader.readCount(4);
+        strings.reserve(stringCount);
+        for (std::uint32_t i = 0; i < stringCount; ++i)
+        {
+            const CharStringView str = reader.readBytes(reader.readUInt32());
+            strings.emplace_back(str.data(), str.size());
+        }
+
+        auto root = std::make_unique<Node>();
+        readBinaryNode(reader, *root, strings, 0);
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
@@ -618,6 +918,28 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    {
+        std::map<String, std::uint32_t> indices;
+        std::vector<const String*> strings;
+        collectStrings(*rootNode, indices, strings);
+
+        stream.write(binaryHeader, sizeof(binaryHeader));
+        writeUInt32(stream, binaryFormatVersion);
+
+        writeUInt32(stream, static_cast<std::uint32_t>(strings.size()));
+        for (const String* str : strings)
+        {
+            const std::string utf8 = str->toStdString();
+            writeUInt32(stream, static_cast<std::uint32_t>(utf8.size()));
+            stream.write(utf8.data(), static_cast<std::streamsize>(utf8.size()));
+        }
+
+        writeBinaryNode(stream, *rootNode, indices);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
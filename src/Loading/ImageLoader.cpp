@@ -29,7 +29,16 @@
     #include <TGUI/extlibs/IncludeStbImage.hpp>
 #endif
 
-#include <cstring> // memcpy
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstring> // memcpy
+#endif
+
+#if !defined(TGUI_SYSTEM_WINDOWS)
+    #include <sys/mman.h> // mmap, munmap
+    #include <sys/stat.h> // fstat
+    #include <fcntl.h> // open
+    #include <unistd.h> // close
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +48,38 @@ namespace tgui
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
     {
+#if !defined(TGUI_SYSTEM_WINDOWS)
+    #if defined(TGUI_SYSTEM_ANDROID)
+        // Relative filenames are loaded from the assets, which can't be mapped into memory here
+        if (!filename.empty() && (filename[0] == '/'))
+    #endif
+        {
+            // Map the file into memory instead of copying its contents into a buffer first.
+            // Files that can't be mapped (e.g. because they aren't regular files) are read normally below.
+            const int fd = open(filename.toStdString().c_str(), O_RDONLY);
+            if (fd >= 0)
+            {
+                void* mappedFile = MAP_FAILED;
+                std::size_t mappedFileSize = 0;
+
+                struct stat fileInfo;
+                if ((fstat(fd, &fileInfo) == 0) && S_ISREG(fileInfo.st_mode) && (fileInfo.st_size > 0))
+                {
+                    mappedFileSize = static_cast<std::size_t>(fileInfo.st_size);
+                    mappedFile = mmap(nullptr, mappedFileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                }
+
+                close(fd);
+                if (mappedFile != MAP_FAILED)
+                {
+                    auto pixels = loadFromMemory(static_cast<const std::uint8_t*>(mappedFile), mappedFileSize, imageSize);
+                    munmap(mappedFile, mappedFileSize);
+                    return pixels;
+                }
+            }
+        }
+#endif
+
         std::size_t fileSize;
         auto fileContents = readFileToMemory(filename, fileSize);
         if (!fileContents)
@@ -60,17 +101,25 @@ namespace tgui
         if (!buffer)
             return pixelData;
 
-        if ((imgWidth > 0) && (imgHeight > 0))
+        if ((imgWidth <= 0) || (imgHeight <= 0))
         {
-            const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(imgWidth) * static_cast<std::size_t>(imgHeight);
-            pixelData = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
-            std::memcpy(pixelData.get(), buffer, pixelDataSize);
-
-            imageSize.x = static_cast<unsigned int>(imgWidth);
-            imageSize.y = static_cast<unsigned int>(imgHeight);
+            stbi_image_free(buffer);
+            return pixelData;
         }
 
+#if TGUI_USE_SYSTEM_STB
+        // We don't control how the external stb_image allocates its memory, so the pixels have to be copied
+        const std::size_t pixelDataSize = 4 * static_cast<std::size_t>(imgWidth) * static_cast<std::size_t>(imgHeight);
+        pixelData = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
+        std::memcpy(pixelData.get(), buffer, pixelDataSize);
         stbi_image_free(buffer);
+#else
+        // The buffer was allocated with new[] (see IncludeStbImage.hpp), so we can take ownership of it without a copy
+        pixelData.reset(static_cast<std::uint8_t*>(buffer));
+#endif
+
+        imageSize.x = static_cast<unsigned int>(imgWidth);
+        imageSize.y = static_cast<unsigned int>(imgHeight);
         return pixelData;
     }
 
@@ -209,7 +209,8 @@ namespace tgui
             if (texture.getData()->backendTexture)
             {
                 const UIntRect& partRect = texture.getPartRect();
-                if ((partRect != UIntRect{}) && (partRect != UIntRect{{0, 0}, texture.getData()->backendTexture->getSize()}))
+                const Vector2u imageSize = texture.getData()->atlasRect ? texture.getData()->atlasRect->getSize() : texture.getData()->backendTexture->getSize();
+                if ((partRect != UIntRect{}) && (partRect != UIntRect{{0, 0}, imageSize}))
                 {
                     result += " Part(" + String::fromNumber(partRect.left) + ", " + String::fromNumber(partRect.top)
                                 + ", " + String::fromNumber(partRect.width) + ", " + String::fromNumber(partRect.height) + ")";
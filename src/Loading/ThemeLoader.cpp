@@ -268,10 +268,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
 
-        std::stringstream stream;
-        stream.write(reinterpret_cast<char*>(fileContents.get()), static_cast<std::streamsize>(fileSize));
-
-        std::unique_ptr<DataIO::Node> root = DataIO::parse(stream);
+        std::unique_ptr<DataIO::Node> root = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         String resourcePath;
         auto slashPos = filename.find_last_of("/\\");
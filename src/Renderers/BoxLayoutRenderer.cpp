@@ -40,12 +40,12 @@ namespace tgui
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("SpaceBetweenWidgets");
+        auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID("SpaceBetweenWidgets"));
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("Padding");
+            it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID("Padding"));
             if (it != m_data->propertyValuePairs.end())
             {
                 const Padding padding = it->second.getOutline();
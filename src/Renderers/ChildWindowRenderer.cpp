@@ -55,12 +55,12 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("TitleBarHeight");
+        auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID("TitleBarHeight"));
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("TextureTitleBar");
+            it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID("TextureTitleBar"));
             if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
                 return static_cast<float>(it->second.getTexture().getImageSize().y);
             else
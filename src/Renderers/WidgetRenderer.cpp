@@ -26,12 +26,221 @@
 #include <TGUI/RendererDefines.hpp>
 #include <TGUI/Widget.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <stdexcept>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RendererPropertyMap::RendererPropertyMap(const RendererPropertyMap& other) :
+        m_pairs{other.m_pairs}
+    {
+        rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(RendererPropertyMap&& other) noexcept
+    {
+        // Swapping maps keeps the iterators in the index valid
+        m_pairs.swap(other.m_pairs);
+        m_index.swap(other.m_index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap& RendererPropertyMap::operator=(const RendererPropertyMap& other)
+    {
+        if (this != &other)
+        {
+            m_pairs = other.m_pairs;
+            rebuildIndex();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap& RendererPropertyMap::operator=(RendererPropertyMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            m_pairs.swap(other.m_pairs);
+            m_index.swap(other.m_index);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::RendererPropertyMap(const std::map<String, ObjectConverter>& pairs) :
+        m_pairs{pairs}
+    {
+        rebuildIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](const String& property)
+    {
+        const auto it = find(property);
+        if (it != m_pairs.end())
+            return it->second;
+
+        const auto newIt = m_pairs.emplace(property, ObjectConverter{}).first;
+        addToIndex(newIt);
+        return newIt->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::at(const String& property)
+    {
+        const auto it = find(property);
+        if (it == m_pairs.end())
+            throw std::out_of_range("RendererPropertyMap::at called with nonexistent property '" + property.toStdString() + "'");
+
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ObjectConverter& RendererPropertyMap::at(const String& property) const
+    {
+        return const_cast<RendererPropertyMap*>(this)->at(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<RendererPropertyMap::iterator, bool> RendererPropertyMap::insert(const value_type& pair)
+    {
+        const auto it = find(pair.first);
+        if (it != m_pairs.end())
+            return {it, false};
+
+        const auto newIt = m_pairs.insert(pair).first;
+        addToIndex(newIt);
+        return {newIt, true};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::count(const String& property) const
+    {
+        return (find(property) != m_pairs.end()) ? 1 : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(const String& property)
+    {
+        const auto it = find(RendererPropertyId{property});
+        if ((it == m_pairs.end()) || (it->first == property))
+            return it;
+        else // A different name has the same id
+            return m_pairs.find(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(const String& property) const
+    {
+        return const_cast<RendererPropertyMap*>(this)->find(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(RendererPropertyId id)
+    {
+        const auto indexIt = std::lower_bound(m_index.begin(), m_index.end(), id,
+            [](const std::pair<RendererPropertyId, iterator>& entry, RendererPropertyId value){ return entry.first < value; });
+        if ((indexIt != m_index.end()) && (indexIt->first == id))
+            return indexIt->second;
+        else
+            return m_pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(RendererPropertyId id) const
+    {
+        return const_cast<RendererPropertyMap*>(this)->find(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::erase(const_iterator it)
+    {
+        const RendererPropertyId id{it->first};
+        const auto indexIt = std::lower_bound(m_index.begin(), m_index.end(), id,
+            [](const std::pair<RendererPropertyId, iterator>& entry, RendererPropertyId value){ return entry.first < value; });
+        if ((indexIt != m_index.end()) && (indexIt->first == id) && (indexIt->second == it))
+            m_index.erase(indexIt);
+
+        return m_pairs.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::erase(const String& property)
+    {
+        const auto it = find(property);
+        if (it == m_pairs.end())
+            return 0;
+
+        erase(it);
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::clear()
+    {
+        m_pairs.clear();
+        m_index.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::addToIndex(iterator it)
+    {
+        const RendererPropertyId id{it->first};
+        const auto indexIt = std::lower_bound(m_index.begin(), m_index.end(), id,
+            [](const std::pair<RendererPropertyId, iterator>& entry, RendererPropertyId value){ return entry.first < value; });
+
+        // If two different names would have the same id then only the first one can be found by id
+        TGUI_ASSERT((indexIt == m_index.end()) || (indexIt->first != id), "Renderer property names must have a unique hash");
+        if ((indexIt == m_index.end()) || (indexIt->first != id))
+            m_index.emplace(indexIt, id, it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererPropertyMap::rebuildIndex()
+    {
+        m_index.clear();
+        m_index.reserve(m_pairs.size());
+        for (auto it = m_pairs.begin(); it != m_pairs.end(); ++it)
+            m_index.emplace_back(RendererPropertyId{it->first}, it);
+
+        // Keep the first entry when different names have the same id, like operator[] does
+        std::stable_sort(m_index.begin(), m_index.end(),
+            [](const std::pair<RendererPropertyId, iterator>& left, const std::pair<RendererPropertyId, iterator>& right){ return left.first < right.first; });
+        m_index.erase(std::unique(m_index.begin(), m_index.end(),
+            [](const std::pair<RendererPropertyId, iterator>& left, const std::pair<RendererPropertyId, iterator>& right){ return left.first == right.first; }),
+            m_index.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     RendererData::RendererData(const RendererData& other) :
         propertyValuePairs{other.propertyValuePairs},
         observers{other.observers},
@@ -151,7 +360,7 @@ namespace tgui
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("Font");
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID("Font"));
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -169,7 +378,7 @@ namespace tgui
 
     unsigned int WidgetRenderer::getTextSize() const
     {
-        auto it = m_data->propertyValuePairs.find("TextSize");
+        const auto it = m_data->propertyValuePairs.find(TGUI_RENDERER_PROPERTY_ID("TextSize"));
         if (it != m_data->propertyValuePairs.end())
             return static_cast<unsigned int>(it->second.getNumber());
         else
@@ -211,9 +420,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ObjectConverter WidgetRenderer::getProperty(RendererPropertyId property) const
+    {
+        const auto it = m_data->propertyValuePairs.find(property);
+        if (it != m_data->propertyValuePairs.end())
+            return it->second;
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     const std::map<String, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
     {
-        return m_data->propertyValuePairs;
+        return m_data->propertyValuePairs.asMap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
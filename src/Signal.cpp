@@ -40,6 +40,7 @@ namespace tgui
 
     unsigned int Signal::m_lastSignalId = 0;
     std::deque<const void*> Signal::m_parameters;
+    std::uint64_t Signal::m_emitCount = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -86,6 +87,7 @@ namespace tgui
             return false;
 
         m_parameters[0] = static_cast<const void*>(&widget);
+        ++m_emitCount;
 
         // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
         auto handlers = m_handlers;
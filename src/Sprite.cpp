@@ -156,6 +156,13 @@ namespace tgui
 
     void Sprite::setTexture(const Texture& texture)
     {
+        // The rasterized svg can't remain visible while a different image is being rasterized
+        if (m_svgTexture && (texture.getData() != m_texture.getData()))
+        {
+            getBackend()->unregisterSvgSprite(this);
+            m_svgTexture = nullptr;
+        }
+
         m_texture = texture;
         m_vertexColor = m_texture.getColor();
 
@@ -391,19 +398,16 @@ namespace tgui
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
+            TGUI_ASSERT(isBackendSet(), "Backend must still exist when SVG texture is loaded in Sprite");
             if (!m_svgTexture)
-            {
-                m_svgTexture = getBackend()->createTexture();
-
-                TGUI_ASSERT(isBackendSet(), "Backend must still exist when SVG texture is loaded in Sprite");
                 getBackend()->registerSvgSprite(this);
-            }
 
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            // While the new size is being rasterized in the background, the previous texture is stretched to the new size
+            m_svgTexture = m_texture.getData()->svgImage->getTexture(svgTextureSize, m_svgTexture);
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
@@ -411,6 +415,9 @@ namespace tgui
         else
         {
             texCoordOffset = m_texture.getPartRect().getPosition();
+            if (m_texture.getData()->atlasRect)
+                texCoordOffset += m_texture.getData()->atlasRect->getPosition();
+
             textureSize = Vector2f{m_texture.getPartRect().getSize()};
             middleRect = FloatRect{m_texture.getMiddleRect()};
             if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
@@ -584,8 +591,8 @@ namespace tgui
         {
             for (auto& vertex : m_vertices)
             {
-                vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
-                vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
+                vertex.texCoords.x += static_cast<float>(texCoordOffset.x);
+                vertex.texCoords.y += static_cast<float>(texCoordOffset.y);
             }
         }
 
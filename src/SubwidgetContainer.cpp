@@ -190,6 +190,8 @@ namespace tgui
 
     void SubwidgetContainer::rendererChanged(const String& property)
     {
+        const RendererPropertyId propertyId{property};
+
         // If the property matches the name of a child widget then the value should be a renderer object to be passed to that widget
         for (const auto& widget : m_container->getWidgets())
         {
@@ -226,13 +228,16 @@ namespace tgui
         Widget::rendererChanged(property);
 
         // Make sure to pass on the SubwidgetContainer's font and opacity to the internal container
-        if (property == U"Font")
-        {
-            m_container->setInheritedFont(m_fontCached);
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        switch (propertyId.getValue())
         {
-            m_container->setInheritedOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                m_container->setInheritedFont(m_fontCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                m_container->setInheritedOpacity(m_opacityCached);
+                break;
         }
     }
 
@@ -22,8 +22,10 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+
 #include <TGUI/Global.hpp>
 #include <TGUI/SvgImage.hpp>
+#include <TGUI/Timer.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendTexture.hpp>
 
@@ -31,6 +33,14 @@
     #include <TGUI/extlibs/IncludeNanoSVG.hpp>
 #endif
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <condition_variable>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -39,22 +49,267 @@ namespace tgui
     {
         struct SvgImageData
         {
+            struct CachedTexture
+            {
+                Vector2u size;
+                std::shared_ptr<BackendTexture> texture;
+                std::uint64_t lastUsed = 0;
+            };
+
+            SvgImageData() = default;
+            SvgImageData(const SvgImageData&) = delete;
+            SvgImageData& operator=(const SvgImageData&) = delete;
+
+            ~SvgImageData()
+            {
+                if (rasterizer)
+                    nsvgDeleteRasterizer(rasterizer);
+                if (svg)
+                    nsvgDelete(svg);
+            }
+
+            // Draws the svg with the given size, the rasterizer is passed as each thread needs its own rasterizer
+            TGUI_NODISCARD std::unique_ptr<std::uint8_t[]> rasterizePixels(NSVGrasterizer* rasterizerToUse, Vector2u size) const
+            {
+                const float scaleX = size.x / static_cast<float>(svg->width);
+                const float scaleY = size.y / static_cast<float>(svg->height);
+
+                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(size.x * size.y * 4);
+                nsvgRasterizeXY(rasterizerToUse, svg, 0, 0, scaleX, scaleY,
+                                pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+                return pixels;
+            }
+
+            // Adds a texture to the cache and removes the textures that were least recently used if too many are unused
+            void addCachedTexture(Vector2u size, std::shared_ptr<BackendTexture> texture)
+            {
+                cachedTextures.push_back({size, std::move(texture), ++usageCounter});
+
+                const std::size_t maxUnusedTextures = 4;
+                std::size_t unusedTextures = 0;
+                for (const auto& cachedTexture : cachedTextures)
+                {
+                    if (cachedTexture.texture.use_count() == 1)
+                        ++unusedTextures;
+                }
+
+                while (unusedTextures > maxUnusedTextures)
+                {
+                    auto oldestIt = cachedTextures.end();
+                    for (auto it = cachedTextures.begin(); it != cachedTextures.end() - 1; ++it)
+                    {
+                        if ((it->texture.use_count() == 1) && ((oldestIt == cachedTextures.end()) || (it->lastUsed < oldestIt->lastUsed)))
+                            oldestIt = it;
+                    }
+
+                    if (oldestIt == cachedTextures.end())
+                        break;
+
+                    cachedTextures.erase(oldestIt);
+                    --unusedTextures;
+                }
+            }
+
             NSVGimage* svg = nullptr;
             NSVGrasterizer* rasterizer = nullptr;
+            std::vector<CachedTexture> cachedTextures;
+            std::uint64_t usageCounter = 0;
+        };
+    }
+
+    namespace
+    {
+        struct RasterizedImage
+        {
+            std::shared_ptr<priv::SvgImageData> data; // Only released on the gui thread, as it owns backend textures
+            Vector2u size;
+            std::unique_ptr<std::uint8_t[]> pixels;
+        };
+
+        // Rasterizes svg images on background threads, which are started when the first image is requested
+        class SvgRasterizer
+        {
+        public:
+            SvgRasterizer() = default;
+            SvgRasterizer(const SvgRasterizer&) = delete;
+            SvgRasterizer& operator=(const SvgRasterizer&) = delete;
+
+            ~SvgRasterizer()
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopping = true;
+                }
+
+                m_condition.notify_all();
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            void requestRasterization(const std::shared_ptr<priv::SvgImageData>& data, Vector2u size, const BackendTexture* currentTexture)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    for (const auto& request : m_activeRequests)
+                    {
+                        if ((request.dataPtr == data.get()) && (request.size == size))
+                            return;
+                    }
+
+                    for (auto& request : m_queuedRequests)
+                    {
+                        if (request.dataPtr != data.get())
+                            continue;
+
+                        if (request.size == size)
+                            return;
+
+                        // If the sprite was resized again before its previous request was handled, then only the
+                        // latest size has to be rasterized. Other sprites will request their size again afterwards.
+                        if (request.currentTexture == currentTexture)
+                        {
+                            request.size = size;
+                            return;
+                        }
+                    }
+
+                    m_queuedRequests.push_back({data, data.get(), size, currentTexture});
+                }
+
+                if (m_threads.empty())
+                {
+                    const unsigned int threadCount = std::max(1u, std::min(2u, std::thread::hardware_concurrency()));
+                    for (unsigned int i = 0; i < threadCount; ++i)
+                        m_threads.emplace_back(&SvgRasterizer::rasterizeImages, this);
+                }
+
+                m_condition.notify_one();
+            }
+
+            TGUI_NODISCARD std::vector<RasterizedImage> takeRasterizedImages()
+            {
+                std::vector<RasterizedImage> rasterizedImages;
+                const std::lock_guard<std::mutex> lock(m_mutex);
+                rasterizedImages.swap(m_rasterizedImages);
+                return rasterizedImages;
+            }
+
+            TGUI_NODISCARD std::size_t getPendingCount()
+            {
+                const std::lock_guard<std::mutex> lock(m_mutex);
+                return m_queuedRequests.size() + m_activeRequests.size() + m_rasterizedImages.size();
+            }
+
+        private:
+
+            struct Request
+            {
+                std::weak_ptr<priv::SvgImageData> data;
+                const priv::SvgImageData* dataPtr; // Only used for comparing, data may no longer exist
+                Vector2u size;
+                const BackendTexture* currentTexture; // Only used for comparing, texture may no longer exist
+            };
+
+            // Function executed in separate thread
+            void rasterizeImages()
+            {
+                // Each thread needs its own rasterizer, the svg itself is only read from
+                auto* rasterizer = nsvgCreateRasterizer();
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+                while (true)
+                {
+                    m_condition.wait(lock, [this]{ return m_stopping || !m_queuedRequests.empty(); });
+                    if (m_stopping)
+                        break;
+
+                    const Request request = m_queuedRequests.front();
+                    m_queuedRequests.pop_front();
+
+                    RasterizedImage image;
+                    image.data = request.data.lock();
+                    image.size = request.size;
+                    if (!image.data)
+                        continue;
+
+                    m_activeRequests.push_back(request);
+
+                    lock.unlock();
+                    image.pixels = image.data->rasterizePixels(rasterizer, image.size);
+                    lock.lock();
+
+                    m_activeRequests.erase(std::find_if(m_activeRequests.begin(), m_activeRequests.end(),
+                        [&request](const Request& activeRequest){ return (activeRequest.dataPtr == request.dataPtr) && (activeRequest.size == request.size); }));
+                    m_rasterizedImages.push_back(std::move(image));
+                }
+
+                nsvgDeleteRasterizer(rasterizer);
+            }
+
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex; // Protects all members below
+            std::condition_variable m_condition;
+            std::deque<Request> m_queuedRequests;
+            std::vector<Request> m_activeRequests;
+            std::vector<RasterizedImage> m_rasterizedImages;
+            bool m_stopping = false;
         };
+
+        SvgRasterizer& getSvgRasterizer()
+        {
+            static SvgRasterizer svgRasterizer;
+            return svgRasterizer;
+        }
+
+        std::shared_ptr<Timer> rasterizationTimer;
+
+        // Called on the gui thread to turn the images that were rasterized in the background into textures
+        void finishRasterizations()
+        {
+            auto rasterizedImages = getSvgRasterizer().takeRasterizedImages();
+            if (!rasterizedImages.empty())
+            {
+                for (auto& image : rasterizedImages)
+                {
+                    // Don't create a texture if the svg image was destroyed in the meantime or if the size got rasterized
+                    // on the gui thread while this image was being rasterized in the background
+                    if (image.data.use_count() == 1)
+                        continue;
+                    if (std::any_of(image.data->cachedTextures.begin(), image.data->cachedTextures.end(),
+                                    [&image](const priv::SvgImageData::CachedTexture& cachedTexture){ return cachedTexture.size == image.size; }))
+                        continue;
+
+                    auto texture = getBackend()->createTexture();
+                    texture->load(image.size, std::move(image.pixels), true);
+                    image.data->addCachedTexture(image.size, std::move(texture));
+                }
+
+                // Let the sprites pick up their new texture
+                rasterizedImages.clear();
+                getBackend()->updateSvgSprites();
+            }
+
+            if (getSvgRasterizer().getPendingCount() == 0)
+            {
+                rasterizationTimer->setEnabled(false);
+                rasterizationTimer = nullptr;
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage() :
-        m_data{std::make_unique<priv::SvgImageData>()}
+        m_data{std::make_shared<priv::SvgImageData>()}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage(const String& filename) :
-        m_data{std::make_unique<priv::SvgImageData>()}
+        m_data{std::make_shared<priv::SvgImageData>()}
     {
         m_data->svg = nsvgParseFromFile(filename.toStdString().c_str(), "px", 96);
         if (!m_data->svg)
@@ -65,13 +320,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    SvgImage::~SvgImage()
-    {
-        if (m_data->rasterizer)
-            nsvgDeleteRasterizer(m_data->rasterizer);
-        if (m_data->svg)
-            nsvgDelete(m_data->svg);
-    }
+    SvgImage::~SvgImage() = default;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,14 +353,57 @@ namespace tgui
         size.x = static_cast<unsigned int>(size.x * fontScale);
         size.y = static_cast<unsigned int>(size.y * fontScale);
 
-        const float scaleX = size.x / static_cast<float>(m_data->svg->width);
-        const float scaleY = size.y / static_cast<float>(m_data->svg->height);
+        texture.load(size, m_data->rasterizePixels(m_data->rasterizer, size), true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        auto pixels = MakeUniqueForOverwrite<unsigned char[]>(size.x * size.y * 4);
-        nsvgRasterizeXY(m_data->rasterizer, m_data->svg, 0, 0, scaleX, scaleY,
-                        pixels.get(), static_cast<int>(size.x), static_cast<int>(size.y), static_cast<int>(size.x * 4));
+    std::shared_ptr<BackendTexture> SvgImage::getTexture(Vector2u size, const std::shared_ptr<BackendTexture>& currentTexture)
+    {
+        if (!m_data->svg)
+            return currentTexture ? currentTexture : getBackend()->createTexture();
 
-        texture.load(size, std::move(pixels), true);
+        // The cache is keyed on the size in pixels, which already takes the font scale into account
+        const float fontScale = getBackend()->getFontScale();
+        size.x = static_cast<unsigned int>(size.x * fontScale);
+        size.y = static_cast<unsigned int>(size.y * fontScale);
+
+        for (auto& cachedTexture : m_data->cachedTextures)
+        {
+            if (cachedTexture.size == size)
+            {
+                cachedTexture.lastUsed = ++m_data->usageCounter;
+                return cachedTexture.texture;
+            }
+        }
+
+        // Keep showing the current texture while the image is rasterized in the background
+        if (currentTexture)
+        {
+            getSvgRasterizer().requestRasterization(m_data, size, currentTexture.get());
+
+            // The timer also ensures that the main loop doesn't sleep while waiting for the result.
+            // The timer is no longer enabled when all timers were cleared (e.g. because the backend was reset).
+            if (!rasterizationTimer || !rasterizationTimer->isEnabled())
+                rasterizationTimer = Timer::create(&finishRasterizations, std::chrono::milliseconds(10));
+
+            return currentTexture;
+        }
+
+        if (!m_data->rasterizer)
+            m_data->rasterizer = nsvgCreateRasterizer();
+
+        auto texture = getBackend()->createTexture();
+        texture->load(size, m_data->rasterizePixels(m_data->rasterizer, size), true);
+        m_data->addCachedTexture(size, texture);
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getPendingRasterizationCount()
+    {
+        return getSvgRasterizer().getPendingCount();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
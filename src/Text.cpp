@@ -25,6 +25,7 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <algorithm>
@@ -36,6 +37,36 @@
 
 namespace tgui
 {
+    namespace
+    {
+        float measureLineWidth(BackendFont& font, const String& text, unsigned int characterSize, bool bold)
+        {
+            float width = 0.0f;
+            char32_t prevChar = 0;
+            for (const char32_t curChar : text)
+            {
+                float charWidth;
+                if (curChar == '\n')
+                    break;
+                else if (curChar == U'\r')
+                    continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
+                else if (curChar == '\t')
+                    charWidth = font.getAdvance(' ', characterSize, bold) * 4.0f;
+                else
+                    charWidth = font.getAdvance(curChar, characterSize, bold);
+
+                const float kerning = font.getCachedKerning(prevChar, curChar, characterSize, bold);
+
+                width += charWidth + kerning;
+                prevChar = curChar;
+            }
+
+            return width;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Text::Text() :
         m_backendText(getBackend()->createText())
     {
@@ -284,29 +315,25 @@ namespace tgui
         if (font == nullptr)
             return 0.0f;
 
-        const bool bold = (textStyle & TextStyle::Bold) != 0;
+        return measureLineWidth(*font.getBackendFont(), text, characterSize, (textStyle & TextStyle::Bold) != 0);
+    }
 
-        float width = 0.0f;
-        char32_t prevChar = 0;
-        for (const char32_t curChar : text)
-        {
-            float charWidth;
-            if (curChar == '\n')
-                break;
-            else if (curChar == U'\r')
-                continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
+    std::vector<float> Text::getLineWidths(const std::vector<String>& texts, const Font& font, unsigned int characterSize, TextStyles textStyle)
+    {
+        if (font == nullptr)
+            return std::vector<float>(texts.size(), 0.0f);
 
-            width += charWidth + kerning;
-            prevChar = curChar;
-        }
+        BackendFont& backendFont = *font.getBackendFont();
+        const bool bold = (textStyle & TextStyle::Bold) != 0;
+
+        std::vector<float> widths;
+        widths.reserve(texts.size());
+        for (const auto& text : texts)
+            widths.push_back(measureLineWidth(backendFont, text, characterSize, bold));
 
-        return width;
+        return widths;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -352,10 +379,20 @@ namespace tgui
 
     String Text::wordWrap(float maxWidth, const String& text, const Font& font, unsigned int textSize, bool bold)
     {
-        String result;
         if (font == nullptr)
-            return result;
+            return {};
 
+        return wordWrap(maxWidth, text, measureCharacters(text, font, textSize, bold));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String Text::wordWrap(float maxWidth, const String& text, const CharacterWidths& characterWidths)
+    {
+        TGUI_ASSERT((characterWidths.advances.size() == text.length()) && (characterWidths.kernings.size() == text.length()),
+                    "Text::wordWrap requires character widths that were measured for the same text");
+
+        String result;
         std::size_t index = 0;
         while (index < text.length())
         {
@@ -363,10 +400,9 @@ namespace tgui
 
             // Find out how many characters we can get on this line
             float width = 0;
-            char32_t prevChar = 0;
+            bool isFirstCharOnLine = true;
             for (std::size_t i = index; i < text.length(); ++i)
             {
-                float charWidth;
                 const char32_t curChar = text[i];
                 if (curChar == U'\n')
                 {
@@ -379,12 +415,10 @@ namespace tgui
                     index++;
                     continue;
                 }
-                else if (curChar == U'\t')
-                    charWidth = font.getGlyph(U' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
-                const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
+                // There is no kerning with the character before the start of the line
+                const float charWidth = characterWidths.advances[i];
+                const float kerning = isFirstCharOnLine ? 0 : characterWidths.kernings[i];
                 const bool charIsWhitespace = (curChar == U' ') || (curChar == U'\t');
 
                 // We add the character to the line, unless a non-whitespace character exceeds the line length.
@@ -397,7 +431,7 @@ namespace tgui
                 else
                     break;
 
-                prevChar = curChar;
+                isFirstCharOnLine = false;
             }
 
             // We must always add at least one character to the line
@@ -429,6 +463,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Text::CharacterWidths Text::measureCharacters(const String& text, const Font& font, unsigned int textSize, bool bold)
+    {
+        CharacterWidths characterWidths;
+        characterWidths.advances.resize(text.length(), 0);
+        characterWidths.kernings.resize(text.length(), 0);
+        if (font == nullptr)
+            return characterWidths;
+
+        char32_t prevChar = 0;
+        for (std::size_t i = 0; i < text.length(); ++i)
+        {
+            const char32_t curChar = text[i];
+            if (curChar == U'\r')
+                continue;
+
+            if (curChar == U'\n')
+            {
+                prevChar = 0;
+                continue;
+            }
+
+            if (curChar == U'\t')
+                characterWidths.advances[i] = font.getAdvance(U' ', textSize, bold) * 4;
+            else
+                characterWidths.advances[i] = font.getAdvance(curChar, textSize, bold);
+
+            characterWidths.kernings[i] = font.getKerning(prevChar, curChar, textSize, bold);
+            prevChar = curChar;
+        }
+
+        return characterWidths;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::vector<std::vector<Text::Blueprint>> Text::wordWrap(float maxWidth, const std::vector<std::vector<Blueprint>>& lines, const Font& font)
     {
         std::vector<std::vector<Blueprint>> result;
@@ -495,9 +564,9 @@ namespace tgui
                         const bool boldStyle = ((inputPiece.style & TextStyle::Bold) != 0);
                         TGUI_ASSERT(curChar != U'\n' && curChar != U'\r', "Newline characters must be removed before calling Text::wordWrap with blueprints")
                         if (curChar == U'\t')
-                            charWidth = font.getGlyph(U' ', inputPiece.characterSize, boldStyle).advance * 4;
+                            charWidth = font.getAdvance(U' ', inputPiece.characterSize, boldStyle) * 4;
                         else
-                            charWidth = font.getGlyph(curChar, inputPiece.characterSize, boldStyle).advance;
+                            charWidth = font.getAdvance(curChar, inputPiece.characterSize, boldStyle);
 
                         if (pieceCharIndex > 0)
                             kerning = font.getKerning(prevChar, curChar, inputPiece.characterSize, boldStyle);
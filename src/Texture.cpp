@@ -48,8 +48,9 @@ namespace tgui
 {
     bool Texture::m_defaultSmooth = true;
 
-    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
-    Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = [](BackendTexture& backendTexture, const String& filename, bool smooth)
+    namespace
+    {
+        bool loadBackendTextureFromFile(BackendTexture& backendTexture, const String& filename, bool smooth)
         {
             Vector2u imageSize;
             auto pixelPtr = ImageLoader::loadFromFile(filename, imageSize);
@@ -57,7 +58,24 @@ namespace tgui
                 return false;
 
             return backendTexture.load(imageSize, std::move(pixelPtr), smooth);
-        };
+        }
+
+        // Returns the filename to pass to the texture loader, which is relative to the resource path unless it is absolute
+        TGUI_NODISCARD String getFilenameFromId(const String& id)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            if ((id[0] != '/') && (id[0] != '\\') && ((id.length() <= 1) || (id[1] != ':')))
+#else
+            if (id[0] != '/')
+#endif
+                return (getResourcePath() / id).asString();
+            else
+                return id;
+        }
+    }
+
+    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
+    Texture::BackendTextureLoaderFunc Texture::m_backendTextureLoader = &loadBackendTextureFromFile;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -186,23 +204,10 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
 
         m_data = nullptr;
 
-        std::shared_ptr<TextureData> data;
-#ifdef TGUI_SYSTEM_WINDOWS
-        if ((id[0] != '/') && (id[0] != '\\') && ((id.length() <= 1) || (id[1] != ':')))
-#else
-        if (id[0] != '/')
-#endif
-        {
-            data = m_textureLoader(*this, (getResourcePath() / id).asString(), smooth);
-            if (!data)
-                throw Exception{U"Failed to load '" + (getResourcePath() / id).asString() + U"'"};
-        }
-        else
-        {
-            data = m_textureLoader(*this, id, smooth);
-            if (!data)
-                throw Exception{U"Failed to load '" + id + U"'"};
-        }
+        const String filename = getFilenameFromId(id);
+        std::shared_ptr<TextureData> data = m_textureLoader(*this, filename, smooth);
+        if (!data)
+            throw Exception{U"Failed to load '" + filename + U"'"};
 
         TGUI_ASSERT(data->svgImage || data->backendTexture, "TextureLoaderFunc returned non-nullptr but didn't initialized backendTexture or svgImage");
 
@@ -245,6 +250,56 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Texture::loadAsync(const String& id, const AsyncLoadedFunc& onLoaded, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
+    {
+        if (id.empty())
+        {
+            onLoaded(Texture{});
+            return;
+        }
+
+        // Custom loaders might not be able to run on a different thread, so the texture is loaded directly when they are used
+        using TextureLoaderPtr = std::shared_ptr<TextureData>(*)(Texture&, const String&, bool);
+        using BackendTextureLoaderPtr = bool(*)(BackendTexture&, const String&, bool);
+        const auto* textureLoader = m_textureLoader.target<TextureLoaderPtr>();
+        const auto* backendTextureLoader = m_backendTextureLoader.target<BackendTextureLoaderPtr>();
+        const String filename = getFilenameFromId(id);
+        if (!textureLoader || (*textureLoader != &TextureManager::getTexture)
+         || !backendTextureLoader || (*backendTextureLoader != &loadBackendTextureFromFile)
+         || ((filename.length() > 4) && viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg")))
+        {
+            Texture texture;
+            try
+            {
+                texture.load(id, partRect, middleRect, smooth);
+            }
+            catch (const Exception&)
+            {
+                texture = Texture{};
+            }
+
+            onLoaded(texture);
+            return;
+        }
+
+        TextureManager::getTextureAsync(filename, smooth, [id,partRect,middleRect,onLoaded](std::shared_ptr<TextureData> data){
+            Texture texture;
+            if (data)
+            {
+                // Let the texture alert the texture manager when it is being copied or destroyed
+                texture.setCopyCallback(&TextureManager::copyTexture);
+                texture.setDestructCallback(&TextureManager::removeTexture);
+
+                texture.m_id = id;
+                texture.setTextureData(std::move(data), partRect, middleRect);
+            }
+
+            onLoaded(texture);
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::loadFromPixelData(Vector2u size, const std::uint8_t* pixels, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
     {
         auto data = std::make_shared<TextureData>();
@@ -379,7 +434,10 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         const UIntRect& partRect = getPartRect();
         TGUI_ASSERT(pixel.x < partRect.width && pixel.y < partRect.height, "Texture::isTransparentPixel called with pixel outside texture rectangle");
 
-        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
+        if (m_data->atlasRect)
+            return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left + m_data->atlasRect->left, pixel.y + partRect.top + m_data->atlasRect->top});
+        else
+            return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -477,6 +535,8 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
         {
             if (m_data->svgImage)
                 m_partRect = {0, 0, static_cast<unsigned int>(m_data->svgImage->getSize().x), static_cast<unsigned int>(m_data->svgImage->getSize().y)};
+            else if (m_data->atlasRect)
+                m_partRect = {0, 0, m_data->atlasRect->width, m_data->atlasRect->height};
             else
             {
                 const Vector2u textureSize = m_data->backendTexture->getSize();
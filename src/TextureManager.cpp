@@ -26,12 +26,127 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/Timer.hpp>
+#include <TGUI/Loading/ImageLoader.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <condition_variable>
+    #include <cstring>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+#endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::list<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
+    unsigned int TextureManager::m_atlasMaximumImageSize = 128;
+
+    std::map<String, std::vector<TextureManager::AsyncRequest>> TextureManager::m_asyncRequests;
+    std::shared_ptr<Timer> TextureManager::m_asyncLoadingTimer;
+
+    static const unsigned int atlasPageSize = 1024;
+    static const unsigned int atlasPadding = 1; // The edges of each image are repeated around it, so that filtering doesn't sample neighbors
+
+    namespace
+    {
+        struct DecodedImage
+        {
+            String filename;
+            Vector2u size;
+            std::unique_ptr<std::uint8_t[]> pixels; // nullptr if the image couldn't be loaded
+        };
+
+        // Decodes image files on a few background threads, which are started when the first file is requested
+        class ImageDecoder
+        {
+        public:
+            ImageDecoder() = default;
+            ImageDecoder(const ImageDecoder&) = delete;
+            ImageDecoder& operator=(const ImageDecoder&) = delete;
+
+            ~ImageDecoder()
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopping = true;
+                }
+
+                m_condition.notify_all();
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            void requestFile(const String& filename)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock(m_mutex);
+                    m_requestedFiles.push_back(filename);
+                }
+
+                if (m_threads.empty())
+                {
+                    const unsigned int threadCount = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+                    for (unsigned int i = 0; i < threadCount; ++i)
+                        m_threads.emplace_back(&ImageDecoder::decodeFiles, this);
+                }
+
+                m_condition.notify_one();
+            }
+
+            TGUI_NODISCARD std::vector<DecodedImage> takeDecodedImages()
+            {
+                std::vector<DecodedImage> decodedImages;
+                const std::lock_guard<std::mutex> lock(m_mutex);
+                decodedImages.swap(m_decodedImages);
+                return decodedImages;
+            }
+
+        private:
+
+            // Function executed in separate thread
+            void decodeFiles()
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                while (true)
+                {
+                    m_condition.wait(lock, [this]{ return m_stopping || !m_requestedFiles.empty(); });
+                    if (m_stopping)
+                        return;
+
+                    DecodedImage image;
+                    image.filename = std::move(m_requestedFiles.front());
+                    m_requestedFiles.pop_front();
+
+                    lock.unlock();
+                    image.pixels = ImageLoader::loadFromFile(image.filename, image.size);
+                    lock.lock();
+
+                    m_decodedImages.push_back(std::move(image));
+                }
+            }
+
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex; // Protects all members below
+            std::condition_variable m_condition;
+            std::deque<String> m_requestedFiles;
+            std::vector<DecodedImage> m_decodedImages;
+            bool m_stopping = false;
+        };
+
+        ImageDecoder& getImageDecoder()
+        {
+            static ImageDecoder imageDecoder;
+            return imageDecoder;
+        }
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,26 +159,10 @@ namespace tgui
         const bool isSvg = ((filename.length() > 4) && (viewEqualIgnoreCase(StringView(filename.c_str() + (filename.length() - 4), 4), U".svg")));
 
         // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
-        {
-            // Loop all our textures to find the one containing the image
-            for (auto& dataHolder : imageIt->second)
-            {
-                // We can reuse everything only if the image is loaded with the same settings
-                if (dataHolder.smooth == smooth)
-                {
-                    // The exact same texture is now used at multiple places
-                    ++dataHolder.users;
-                    return dataHolder.data;
-                }
-            }
-        }
-        else // The image doesn't exist yet
-        {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
-        }
+        if (auto loadedData = findLoadedTexture(filename, smooth))
+            return loadedData;
+
+        auto imageIt = m_imageMap.insert({filename, {}}).first;
 
         // Add new data to the list
         TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
@@ -80,7 +179,35 @@ namespace tgui
             if (data->svgImage->isSet())
                 return data;
         }
-        else // Not an svg
+        else if (m_atlasEnabled)
+        {
+            // The image is first loaded in a texture that only stores the pixels, to find out whether it is small enough
+            // to be copied into the atlas. Only larger images need a texture of their own.
+            BackendTexture image;
+            if (texture.getBackendTextureLoader()(image, filename, smooth))
+            {
+                if (image.getPixels())
+                {
+                    if (addToAtlas(*data, image, smooth))
+                        return data;
+
+                    const Vector2u imageSize = image.getSize();
+                    auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(imageSize.x) * imageSize.y * 4);
+                    std::memcpy(pixels.get(), image.getPixels(), static_cast<std::size_t>(imageSize.x) * imageSize.y * 4);
+
+                    data->backendTexture = getBackend()->createTexture();
+                    if (data->backendTexture->load(imageSize, std::move(pixels), smooth))
+                        return data;
+                }
+                else // The loader didn't keep the pixels, so the image has to be loaded directly in a backend texture
+                {
+                    data->backendTexture = getBackend()->createTexture();
+                    if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
+                        return data;
+                }
+            }
+        }
+        else // Not an svg and no atlas
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename, smooth))
@@ -98,6 +225,38 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextureManager::getTextureAsync(const String& filename, bool smooth, const AsyncLoadedFunc& callback)
+    {
+        if (auto loadedData = findLoadedTexture(filename, smooth))
+        {
+            callback(loadedData);
+            return;
+        }
+
+        // If the file is already being decoded then we just wait for the result
+        auto requestIt = m_asyncRequests.find(filename);
+        if (requestIt == m_asyncRequests.end())
+        {
+            requestIt = m_asyncRequests.insert({filename, {}}).first;
+            getImageDecoder().requestFile(filename);
+        }
+
+        requestIt->second.push_back({smooth, callback});
+
+        // The decoded images are picked up by a timer, which also ensures that the main loop doesn't sleep while waiting
+        if (!m_asyncLoadingTimer || !m_asyncLoadingTimer->isEnabled())
+            m_asyncLoadingTimer = Timer::create(&TextureManager::finishAsyncLoading, std::chrono::milliseconds(10));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAsyncLoadingCount()
+    {
+        return m_asyncRequests.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextureManager::copyTexture(const std::shared_ptr<TextureData>& textureDataToCopy)
     {
         // Loop all our textures to check if we already have this one
@@ -133,6 +292,9 @@ namespace tgui
                     // If this was the only place where the texture is used then delete it
                     if (--(dataIt->users) == 0)
                     {
+                        if (dataIt->data->atlasRect)
+                            removeFromAtlas(*dataIt->data);
+
                         imageIt->second.erase(dataIt);
                         if (imageIt->second.empty())
                             m_imageMap.erase(imageIt);
@@ -154,6 +316,249 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasMaximumImageSize(unsigned int size)
+    {
+        m_atlasMaximumImageSize = std::min(size, atlasPageSize - (2 * atlasPadding));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasMaximumImageSize()
+    {
+        return m_atlasMaximumImageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return m_atlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::findLoadedTexture(const String& filename, bool smooth)
+    {
+        const auto imageIt = m_imageMap.find(filename);
+        if (imageIt == m_imageMap.end())
+            return nullptr;
+
+        // Loop all our textures to find the one containing the image
+        for (auto& dataHolder : imageIt->second)
+        {
+            // We can reuse everything only if the image is loaded with the same settings
+            if (dataHolder.smooth == smooth)
+            {
+                // The exact same texture is now used at multiple places
+                ++dataHolder.users;
+                return dataHolder.data;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::addLoadedImage(const String& filename, bool smooth, Vector2u imageSize, std::unique_ptr<std::uint8_t[]> pixels)
+    {
+        auto imageIt = m_imageMap.insert({filename, {}}).first;
+
+        TGUI_EMPLACE_BACK(dataHolder, imageIt->second)
+        dataHolder.filename = filename;
+        dataHolder.users = 1;
+        dataHolder.smooth = smooth;
+        dataHolder.data = std::make_shared<TextureData>();
+
+        auto data = dataHolder.data;
+        if (m_atlasEnabled && (imageSize.x <= m_atlasMaximumImageSize) && (imageSize.y <= m_atlasMaximumImageSize))
+        {
+            BackendTexture image;
+            if (image.load(imageSize, std::move(pixels), smooth) && addToAtlas(*data, image, smooth))
+                return data;
+        }
+        else
+        {
+            data->backendTexture = getBackend()->createTexture();
+            if (data->backendTexture->load(imageSize, std::move(pixels), smooth))
+                return data;
+        }
+
+        // The texture could not be created
+        if (imageIt->second.size() > 1)
+            imageIt->second.pop_back();
+        else
+            m_imageMap.erase(imageIt);
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::finishAsyncLoading()
+    {
+        for (auto& decodedImage : getImageDecoder().takeDecodedImages())
+        {
+            const auto requestIt = m_asyncRequests.find(decodedImage.filename);
+            if (requestIt == m_asyncRequests.end())
+                continue;
+
+            // The requests are removed before calling the callbacks, as the callbacks could request new textures
+            const std::vector<AsyncRequest> requests = std::move(requestIt->second);
+            m_asyncRequests.erase(requestIt);
+
+            for (std::size_t i = 0; i < requests.size(); ++i)
+            {
+                // Requests with the same smooth setting share the texture that was created for the first one of them
+                std::shared_ptr<TextureData> data = findLoadedTexture(decodedImage.filename, requests[i].smooth);
+                if (!data && decodedImage.pixels)
+                {
+                    // The pixels can only be moved into the texture if no other texture still needs to be created from them
+                    const bool pixelsNeededLater = std::any_of(requests.begin() + static_cast<std::ptrdiff_t>(i) + 1, requests.end(),
+                        [&](const AsyncRequest& request){ return request.smooth != requests[i].smooth; });
+
+                    std::unique_ptr<std::uint8_t[]> pixels;
+                    if (pixelsNeededLater)
+                    {
+                        const std::size_t pixelDataSize = static_cast<std::size_t>(decodedImage.size.x) * decodedImage.size.y * 4;
+                        pixels = MakeUniqueForOverwrite<std::uint8_t[]>(pixelDataSize);
+                        std::memcpy(pixels.get(), decodedImage.pixels.get(), pixelDataSize);
+                    }
+                    else
+                        pixels = std::move(decodedImage.pixels);
+
+                    data = addLoadedImage(decodedImage.filename, requests[i].smooth, decodedImage.size, std::move(pixels));
+                }
+
+                requests[i].callback(data);
+            }
+        }
+
+        if (m_asyncRequests.empty() && m_asyncLoadingTimer)
+        {
+            m_asyncLoadingTimer->setEnabled(false);
+            m_asyncLoadingTimer = nullptr;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data, const BackendTexture& image, bool smooth)
+    {
+        const Vector2u imageSize = image.getSize();
+        if ((imageSize.x > m_atlasMaximumImageSize) || (imageSize.y > m_atlasMaximumImageSize))
+            return false;
+
+        const unsigned int width = imageSize.x + (2 * atlasPadding);
+        const unsigned int height = imageSize.y + (2 * atlasPadding);
+
+        // Find a row in an existing page in which the image fits and that isn't too high for the image.
+        // If there is none then a new row is started in the first page that still has room for it.
+        AtlasPage* page = nullptr;
+        AtlasRow* row = nullptr;
+        for (auto& existingPage : m_atlasPages)
+        {
+            if (existingPage.smooth != smooth)
+                continue;
+
+            for (auto& existingRow : existingPage.rows)
+            {
+                if ((existingRow.width + width <= atlasPageSize) && (height <= existingRow.height) && (4 * height >= 3 * existingRow.height))
+                {
+                    page = &existingPage;
+                    row = &existingRow;
+                    break;
+                }
+            }
+
+            if (row)
+                break;
+
+            if (existingPage.nextRowTop + height <= atlasPageSize)
+            {
+                existingPage.rows.push_back({existingPage.nextRowTop, height, 0});
+                existingPage.nextRowTop += height;
+                page = &existingPage;
+                row = &existingPage.rows.back();
+                break;
+            }
+        }
+
+        if (!page)
+        {
+            AtlasPage newPage;
+            newPage.smooth = smooth;
+            newPage.texture = getBackend()->createTexture();
+
+            auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>(atlasPageSize * atlasPageSize * 4);
+            std::memset(pixels.get(), 0, atlasPageSize * atlasPageSize * 4);
+            if (!newPage.texture->load({atlasPageSize, atlasPageSize}, std::move(pixels), smooth))
+                return false;
+
+            newPage.rows.push_back({0, height, 0});
+            newPage.nextRowTop = height;
+            m_atlasPages.push_back(std::move(newPage));
+            page = &m_atlasPages.back();
+            row = &page->rows.back();
+        }
+
+        // Copy the image with its edge pixels repeated on every side
+        const std::uint8_t* imagePixels = image.getPixels();
+        auto paddedPixels = MakeUniqueForOverwrite<std::uint8_t[]>(static_cast<std::size_t>(width) * height * 4);
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            const unsigned int imageY = std::min(std::max(y, atlasPadding) - atlasPadding, imageSize.y - 1);
+            for (unsigned int x = 0; x < width; ++x)
+            {
+                const unsigned int imageX = std::min(std::max(x, atlasPadding) - atlasPadding, imageSize.x - 1);
+                std::memcpy(&paddedPixels[(y * width + x) * 4], &imagePixels[(imageY * imageSize.x + imageX) * 4], 4);
+            }
+        }
+
+        const UIntRect area{row->width, row->top, width, height};
+        if (!page->texture->updatePixels(area, paddedPixels.get()))
+            return false;
+
+        row->width += width;
+        ++page->imageCount;
+
+        data.backendTexture = page->texture;
+        data.atlasRect = UIntRect{area.left + atlasPadding, area.top + atlasPadding, imageSize.x, imageSize.y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(const TextureData& data)
+    {
+        for (auto it = m_atlasPages.begin(); it != m_atlasPages.end(); ++it)
+        {
+            if (it->texture != data.backendTexture)
+                continue;
+
+            if (--it->imageCount == 0)
+                m_atlasPages.erase(it);
+
+            return;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
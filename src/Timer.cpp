@@ -200,6 +200,10 @@ namespace tgui
 
     void Timer::clearTimers()
     {
+        // Disable the timers, so that code which still holds one of them can see that it will no longer be triggered
+        for (auto& timer : m_activeTimers)
+            timer->m_enabled = false;
+
         m_activeTimers.clear();
     }
 
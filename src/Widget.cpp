@@ -108,6 +108,29 @@ namespace tgui
 
             return {x, y};
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void requestLayoutUpdates(BackendGui& gui, const std::unordered_set<Layout*>& boundLayouts)
+        {
+            // Layouts that don't determine the position or size of a widget in the same gui are updated immediately.
+            // They are collected first, as updating such a layout could result in layouts being copied or destroyed.
+            std::vector<Layout*> immediateLayouts;
+            for (Layout* layout : boundLayouts)
+            {
+                Widget* dependent = layout->getConnectedWidget();
+                if (dependent && (dependent->getParentGui() == &gui))
+                    gui.requestLayoutUpdate(dependent);
+                else
+                    immediateLayouts.push_back(layout);
+            }
+
+            for (Layout* layout : immediateLayouts)
+            {
+                if (boundLayouts.find(layout) != boundLayouts.end())
+                    layout->recalculateValue();
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,10 +172,13 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
+
+        if (m_parentGui)
+            m_parentGui->cancelLayoutUpdate(this);
 
         SignalManager::getSignalManager()->remove(this);
     }
@@ -538,6 +564,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -579,6 +607,9 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            invalidateArea(m_prevPosition - getPosition(), getFullSize());
+            invalidate();
+
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
@@ -599,6 +630,9 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            invalidateArea({0, 0}, getFullSize() - getSize() + m_prevSize);
+            invalidate();
+
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
@@ -665,6 +699,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        // Don't query the size of widgets that aren't part of a gui, they may still be incomplete (e.g. while being loaded)
+        if (!m_parentGui || !m_parentGui->isPartialRedrawEnabled())
+            return;
+
+        invalidateArea({0, 0}, getFullSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setAutoLayout(AutoLayout layout)
     {
         m_autoLayout = layout;
@@ -683,23 +728,29 @@ namespace tgui
 
     void Widget::setOrigin(Vector2f origin)
     {
+        invalidate();
         m_origin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -716,16 +767,20 @@ namespace tgui
 
     void Widget::setRotation(float angle)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setRotation(float angle, Vector2f origin)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1002,6 +1057,9 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
+        if (m_visible != visible)
+            invalidate();
+
         m_visible = visible;
 
         // If the widget is hiden while still focused then it must be unfocused
@@ -1024,6 +1082,9 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
+        if (m_enabled != enabled)
+            invalidate();
+
         m_enabled = enabled;
 
         if (!enabled)
@@ -1045,6 +1106,8 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        invalidate();
+
         if (focused)
         {
             if (canGainFocus())
@@ -1085,6 +1148,8 @@ namespace tgui
     {
         if (m_parent)
             m_parent->moveWidgetToFront(shared_from_this());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1093,6 +1158,8 @@ namespace tgui
     {
         if (m_parent)
             m_parent->moveWidgetToBack(shared_from_this());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1101,6 +1168,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("Font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1116,6 +1184,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1137,6 +1206,7 @@ namespace tgui
             m_textSizeCached = m_textSize;
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1318,7 +1388,16 @@ namespace tgui
 
     void Widget::setParent(Container* parent)
     {
-        m_parentGui = parent ? parent->getParentGui() : nullptr;
+        // The area where the widget was drawn has to be redrawn when it gets removed from the gui
+        if (m_parent && (m_parent != parent))
+            invalidate();
+
+        // The old gui must no longer update the layouts of the widget when it is removed from the gui
+        BackendGui* newParentGui = parent ? parent->getParentGui() : nullptr;
+        if (m_parentGui && (m_parentGui != newParentGui))
+            m_parentGui->cancelLayoutUpdate(this);
+
+        m_parentGui = newParentGui;
         if (m_parent == parent)
             return;
 
@@ -1345,6 +1424,8 @@ namespace tgui
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+
+            invalidate();
         }
     }
 
@@ -1355,6 +1436,9 @@ namespace tgui
         m_animationTimeElapsed += elapsedTime;
 
         const bool screenRefreshRequired = !m_showAnimations.empty();
+        if (screenRefreshRequired)
+            invalidate();
+
         for (auto it = m_showAnimations.begin(); it != m_showAnimations.end();)
         {
             if ((*it)->update(elapsedTime))
@@ -1363,6 +1447,9 @@ namespace tgui
                 ++it;
         }
 
+        if (screenRefreshRequired)
+            invalidate();
+
         return screenRefreshRequired;
     }
 
@@ -1375,6 +1462,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::recalculateLayouts()
+    {
+        // The size is updated first, as the position may depend on the size (e.g. when binding the right side of the widget)
+        m_size.x.calculateValue();
+        m_size.y.calculateValue();
+        setSize(getSizeLayout());
+
+        m_position.x.calculateValue();
+        m_position.y.calculateValue();
+        setPosition(getPositionLayout());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::appendLayoutDependents(std::vector<Widget*>& dependents) const
+    {
+        for (const Layout* layout : m_boundPositionLayouts)
+        {
+            if (Widget* dependent = layout->getConnectedWidget())
+                dependents.push_back(dependent);
+        }
+
+        for (const Layout* layout : m_boundSizeLayouts)
+        {
+            if (Widget* dependent = layout->getConnectedWidget())
+                dependents.push_back(dependent);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Widget::leftMousePressed(Vector2f)
     {
         m_mouseDown = true;
@@ -1538,37 +1656,42 @@ namespace tgui
 
     void Widget::rendererChanged(const String& property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
-                m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
-            else
-                m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
-        }
-        else if (property == U"Font")
-        {
-            if (getSharedRenderer()->getFont())
-                m_fontCached = getSharedRenderer()->getFont();
-            else if (m_inheritedFont)
-                m_fontCached = m_inheritedFont;
-            else
-                m_fontCached = Font::getGlobalFont();
-        }
-        else if (property == U"TextSize")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            if (getSharedRenderer()->getTextSize())
-                m_textSizeCached = getSharedRenderer()->getTextSize();
-            else
-                m_textSizeCached = m_textSize;
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
+                    m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
+                else
+                    m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+                break;
 
-            updateTextSize();
-        }
-        else if (property == U"TransparentTexture")
-        {
-            m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                if (getSharedRenderer()->getFont())
+                    m_fontCached = getSharedRenderer()->getFont();
+                else if (m_inheritedFont)
+                    m_fontCached = m_inheritedFont;
+                else
+                    m_fontCached = Font::getGlobalFont();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextSize").getValue():
+                if (getSharedRenderer()->getTextSize())
+                    m_textSizeCached = getSharedRenderer()->getTextSize();
+                else
+                    m_textSizeCached = m_textSize;
+
+                updateTextSize();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TransparentTexture").getValue():
+                m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
+                break;
+
+            default:
+                throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
         }
-        else
-            throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1862,6 +1985,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1873,6 +1997,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_parent->getMouseCursor());
 
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -1883,6 +2008,12 @@ namespace tgui
         if (m_boundPositionLayouts.empty())
             return;
 
+        if (m_parentGui && m_parentGui->isDeferredLayoutUpdatesEnabled())
+        {
+            requestLayoutUpdates(*m_parentGui, m_boundPositionLayouts);
+            return;
+        }
+
         // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
         // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
         std::unordered_set<Layout*> boundPositionLayouts(m_boundPositionLayouts);
@@ -1905,6 +2036,12 @@ namespace tgui
         if (m_boundSizeLayouts.empty())
             return;
 
+        if (m_parentGui && m_parentGui->isDeferredLayoutUpdatesEnabled())
+        {
+            requestLayoutUpdates(*m_parentGui, m_boundSizeLayouts);
+            return;
+        }
+
         // Update the connected layouts, but make a copy of the set before iterating over it to prevent issues
         // with the list being changed during the loop if some layout gets copied in a called setSize or setPosition function.
         std::unordered_set<Layout*> boundSizeLayouts(m_boundSizeLayouts);
@@ -1925,6 +2062,28 @@ namespace tgui
     void Widget::rendererChangedCallback(const String& property)
     {
         rendererChanged(property);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateArea(Vector2f positionOffset, Vector2f fullSize)
+    {
+        if (!m_parentGui || !m_parentGui->isPartialRedrawEnabled())
+            return;
+
+        // The area covered by a rotated or scaled widget isn't an axis-aligned rectangle, so the entire screen is redrawn
+        for (const Widget* widget = this; widget != nullptr; widget = widget->getParent())
+        {
+            if ((widget->getRotation() != 0) || (widget->getScale().x != 1) || (widget->getScale().y != 1))
+            {
+                m_parentGui->invalidate();
+                return;
+            }
+        }
+
+        const Vector2f pos = getAbsolutePosition(getWidgetOffset()) + positionOffset;
+        m_parentGui->invalidateRegion({pos.x, pos.y, fullSize.x, fullSize.y});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
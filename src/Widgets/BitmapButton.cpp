@@ -149,6 +149,7 @@ namespace tgui
             m_imageComponent->setVisible(false);
 
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +165,7 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,13 +179,19 @@ namespace tgui
 
     void BitmapButton::rendererChanged(const String& property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            Button::rendererChanged(property);
-            m_imageComponent->setOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Button::rendererChanged(property);
+                m_imageComponent->setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Button::rendererChanged(property);
+                break;
         }
-        else
-            Button::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
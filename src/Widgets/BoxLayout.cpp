@@ -90,6 +90,7 @@ namespace tgui
             Group::add(widget, widgetName);
 
         updateWidgets();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -115,6 +116,7 @@ namespace tgui
         Group::remove(m_widgets[index]);
 
         updateWidgets();
+        invalidate();
         return true;
     }
 
@@ -142,21 +144,26 @@ namespace tgui
 
     void BoxLayout::rendererChanged(const String& property)
     {
-        if (property == U"SpaceBetweenWidgets")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
-        }
-        else if (property == U"Padding")
-        {
-            Group::rendererChanged(property);
-
-            // Update the space between widgets as the padding is used when no space was explicitly set
-            m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
-            updateWidgets();
+            case TGUI_RENDERER_PROPERTY_ID("SpaceBetweenWidgets").getValue():
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                Group::rendererChanged(property);
+
+                // Update the space between widgets as the padding is used when no space was explicitly set
+                m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
+                updateWidgets();
+                break;
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
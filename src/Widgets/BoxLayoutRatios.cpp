@@ -66,6 +66,7 @@ namespace tgui
             m_ratios.push_back(ratio);
 
         BoxLayout::insert(index, widget, widgetName);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,6 +123,7 @@ namespace tgui
 
         m_ratios[index] = ratio;
         updateWidgets();
+        invalidate();
         return true;
     }
 
@@ -215,6 +215,7 @@ namespace tgui
         m_textComponent->setString(caption);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,6 +232,7 @@ namespace tgui
         m_textPosition = position;
         m_textOrigin = origin;
         updateTextPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -338,119 +340,205 @@ namespace tgui
 
     void ButtonBase::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            background.borders = getSharedRenderer()->getBorders();
-            updateSize();
-        }
-        else if (property == U"RoundedBorderRadius")
-        {
-            background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == U"TextColor")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextColorDown")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextColorHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextColorDownHover")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextColorDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextColorFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextColorDownFocused")
-            priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextStyle")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextStyleDown")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextStyleHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextStyleDownHover")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextStyleDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextStyleDownDisabled")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextStyleFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextStyleDownFocused")
-            priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"Texture")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextureDown")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextureHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextureDownHover")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextureDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextureDownFocused")
-            priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BorderColor")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BorderColorDown")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BorderColorHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BorderColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BorderColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BorderColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BorderColorFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BorderColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BackgroundColor")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BackgroundColorDown")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BackgroundColorHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BackgroundColorDownHover")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BackgroundColorDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BackgroundColorDownDisabled")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BackgroundColorFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BackgroundColorDownFocused")
-            priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
-            updateTextPosition();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-            m_textComponent->setOpacity(m_opacityCached);
-            m_backgroundComponent->setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            ClickableWidget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                background.borders = getSharedRenderer()->getBorders();
+                updateSize();
+                break;
 
-            m_textComponent->setFont(m_fontCached);
-            updateTextSize();
+            case TGUI_RENDERER_PROPERTY_ID("RoundedBorderRadius").getValue():
+                background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDown").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorHover").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDownHover").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDownDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorFocused").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDownFocused").getValue():
+                priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleDown").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleHover").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleDownHover").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleDownDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleFocused").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleDownFocused").getValue():
+                priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Texture").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDown").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureHover").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDownHover").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDownDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureFocused").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDownFocused").getValue():
+                priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDown").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorHover").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDownHover").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDownDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorFocused").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDownFocused").getValue():
+                priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDown").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDownHover").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDownDisabled").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorFocused").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDownFocused").getValue():
+                priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextOutlineThickness").getValue():
+                m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
+                updateTextPosition();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextOutlineColor").getValue():
+                m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                ClickableWidget::rendererChanged(property);
+                m_textComponent->setOpacity(m_opacityCached);
+                m_backgroundComponent->setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                ClickableWidget::rendererChanged(property);
+
+                m_textComponent->setFont(m_fontCached);
+                updateTextSize();
+                break;
+
+            default:
+                ClickableWidget::rendererChanged(property);
+                break;
         }
-        else
-            ClickableWidget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,10 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cmath>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -104,7 +108,12 @@ namespace tgui
         m_scrollbar->setHeight(getInnerSize().y);
         m_scrollbar->setViewportSize(static_cast<unsigned int>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()));
 
-        recalculateAllLines();
+        // The lines only have to be word-wrapped again when the width changes. This is postponed until the next frame,
+        // so that the lines are only laid out once when the chat box is resized several times in a row.
+        if (getMaxLineWidth() != m_wrapWidth)
+            m_relayoutRequired = true;
+
+        recalculateFullTextHeight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -127,30 +136,82 @@ namespace tgui
     {
         // Remove the oldest line if you exceed the maximum
         if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
-        {
-            if (m_newLinesBelowOthers)
-                removeLine(0);
-            else
-                removeLine(m_maxLines-1);
-        }
+            removeOldestLines(1);
+
+        addLineInternal(text, color, style);
+        recalculateFullTextHeight();
+        invalidate();
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<String>& lines)
+    {
+        addLines(lines, m_textColor, m_textStyle);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLines(const std::vector<String>& lines, Color color, TextStyles style)
+    {
+        if (lines.empty())
+            return;
+
+        // Don't create the lines that would be removed again because of the line limit
+        std::size_t firstLine = 0;
+        if ((m_maxLines > 0) && (lines.size() > m_maxLines))
+            firstLine = lines.size() - m_maxLines;
+
+        const std::size_t newLineCount = lines.size() - firstLine;
+        if ((m_maxLines > 0) && (m_lines.size() + newLineCount > m_maxLines))
+            removeOldestLines(m_lines.size() + newLineCount - m_maxLines);
+
+        for (std::size_t i = firstLine; i < lines.size(); ++i)
+            addLineInternal(lines[i], color, style);
+
+        recalculateFullTextHeight();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addLineInternal(const String& text, Color color, TextStyles style)
+    {
         Line line;
         line.string = text;
         line.text.setColor(color);
         line.text.setStyle(style);
         line.text.setOpacity(m_opacityCached);
         line.text.setCharacterSize(m_textSizeCached);
-        line.text.setString(text);
         line.text.setFont(m_fontCached);
 
-        recalculateLineText(line);
+        estimateLineHeight(line);
 
         if (m_newLinesBelowOthers)
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.back().top + m_lines.back().height;
+
             m_lines.push_back(std::move(line));
+        }
         else
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.front().top - line.height;
+
             m_lines.push_front(std::move(line));
+        }
+    }
 
-        recalculateFullTextHeight();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::removeOldestLines(std::size_t count)
+    {
+        count = std::min(count, m_lines.size());
+        if (m_newLinesBelowOthers)
+            m_lines.erase(m_lines.begin(), m_lines.begin() + static_cast<std::ptrdiff_t>(count));
+        else
+            m_lines.erase(m_lines.end() - static_cast<std::ptrdiff_t>(count), m_lines.end());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,7 +256,11 @@ namespace tgui
         {
             m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(lineIndex));
 
+            if (lineIndex > 0)
+                updateLinePositions(lineIndex);
+
             recalculateFullTextHeight();
+            invalidate();
             return true;
         }
         else // Index too high
@@ -209,6 +274,7 @@ namespace tgui
         m_lines.clear();
 
         recalculateFullTextHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,13 +293,11 @@ namespace tgui
         // Remove the oldest lines if there are too many lines
         if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
         {
-            if (m_newLinesBelowOthers)
-                m_lines.erase(m_lines.begin(), m_lines.begin() + static_cast<std::ptrdiff_t>(m_lines.size() - m_maxLines));
-            else
-                m_lines.erase(m_lines.begin() + static_cast<std::ptrdiff_t>(m_maxLines), m_lines.end());
-
+            removeOldestLines(m_lines.size() - m_maxLines);
             recalculateFullTextHeight();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,7 +316,25 @@ namespace tgui
         for (auto& line : m_lines)
             line.text.setCharacterSize(m_textSizeCached);
 
-        recalculateAllLines();
+        m_relayoutRequired = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChatBox::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+
+        if (m_relayoutRequired)
+        {
+            recalculateAllLines();
+            screenRefreshRequired = true;
+        }
+
+        if (wrapVisibleLines())
+            screenRefreshRequired = true;
+
+        return screenRefreshRequired;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -260,6 +342,7 @@ namespace tgui
     void ChatBox::setTextColor(Color color)
     {
         m_textColor = color;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -274,6 +357,7 @@ namespace tgui
     void ChatBox::setTextStyle(TextStyles style)
     {
         m_textStyle = style;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -288,6 +372,7 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         m_linesStartFromTop = startFromTop;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,6 +387,7 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,36 +495,174 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float ChatBox::getMaxLineWidth() const
+    {
+        const float scrollbarWidth = m_scrollbar->isShown() ? m_scrollbar->getSize().x : 0;
+        return getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - scrollbarWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateLineText(Line& line)
     {
-        line.text.setString("");
+        String wrappedString;
+        const float maxWidth = getMaxLineWidth();
+        if (maxWidth >= 0)
+            wrappedString = Text::wordWrap(maxWidth, line.string, m_fontCached, line.text.getCharacterSize(), false);
 
-        // Find the maximum width of one line
-        const float scrollbarWidth = m_scrollbar->isShown() ? m_scrollbar->getSize().x : 0;
-        const float maxWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - scrollbarWidth;
-        if (maxWidth < 0)
+        // The height is calculated the same way as the text does it, but without having to create the vertices.
+        // This way only the lines that are actually drawn have to be turned into vertices.
+        if (m_fontCached && (line.text.getCharacterSize() > 0))
+        {
+            const auto extraLines = static_cast<float>(std::count(wrappedString.begin(), wrappedString.end(), U'\n'));
+            line.height = Text::getLineHeight(m_fontCached, line.text.getCharacterSize()) + (extraLines * m_fontCached.getLineSpacing(line.text.getCharacterSize()));
+        }
+        else
+            line.height = 0;
+
+        line.text.setString(wrappedString);
+        line.wrapped = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::estimateLineHeight(Line& line) const
+    {
+        line.wrapped = false;
+
+        const unsigned int characterSize = line.text.getCharacterSize();
+        if (!m_fontCached || (characterSize == 0))
+        {
+            line.height = 0;
             return;
+        }
+
+        // Every character is assumed to be as wide as an 'x'. Lines that fit on a single row, which is what most log messages
+        // do, are thereby usually estimated correctly without having to look up the width of each character.
+        const float maxWidth = getMaxLineWidth();
+        const float characterWidth = m_fontCached.getAdvance(U'x', characterSize);
+        const auto getRowCount = [maxWidth,characterWidth](std::size_t characterCount){
+            if ((maxWidth <= 0) || (characterCount == 0))
+                return std::size_t{1};
+            return static_cast<std::size_t>(std::ceil(static_cast<float>(characterCount) * characterWidth / maxWidth));
+        };
+
+        std::size_t rowCount = 0;
+        std::size_t characterCount = 0;
+        for (const char32_t c : line.string)
+        {
+            if (c == U'\n')
+            {
+                rowCount += getRowCount(characterCount);
+                characterCount = 0;
+            }
+            else
+                ++characterCount;
+        }
+        rowCount += getRowCount(characterCount);
+
+        line.height = Text::getLineHeight(m_fontCached, characterSize) + (static_cast<float>(rowCount - 1) * m_fontCached.getLineSpacing(characterSize));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<std::size_t, std::size_t> ChatBox::getVisibleLines() const
+    {
+        if (m_lines.empty())
+            return {0, 0};
+
+        // The positions of the lines are known without having to look at the other lines,
+        // so the first visible line can be found with a binary search.
+        const float originTop = m_lines.front().top;
+        const float visibleTop = static_cast<float>(m_scrollbar->getValue());
+        const float visibleBottom = visibleTop + getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        const auto firstIt = std::partition_point(m_lines.begin(), m_lines.end(),
+            [originTop,visibleTop](const Line& line){ return line.top - originTop + line.height <= visibleTop; });
+        const auto lastIt = std::partition_point(firstIt, m_lines.end(),
+            [originTop,visibleBottom](const Line& line){ return line.top - originTop < visibleBottom; });
+
+        return {static_cast<std::size_t>(firstIt - m_lines.begin()), static_cast<std::size_t>(lastIt - m_lines.begin())};
+    }
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, m_fontCached, line.text.getCharacterSize(), false));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChatBox::wrapVisibleLines()
+    {
+        bool linesWrapped = false;
+        bool linesChanged = true;
+        while (linesChanged)
+        {
+            linesChanged = false;
+
+            const auto visibleLines = getVisibleLines();
+            for (std::size_t i = visibleLines.first; i < visibleLines.second; ++i)
+            {
+                Line& line = m_lines[i];
+                if (line.wrapped)
+                    continue;
+
+                const float estimatedHeight = line.height;
+                recalculateLineText(line);
+                linesWrapped = true;
+
+                // When the estimate was wrong then the lines below it move and other lines may become visible
+                if (line.height != estimatedHeight)
+                {
+                    updateLinePositions(i + 1);
+                    linesChanged = true;
+                }
+            }
+
+            if (linesChanged)
+                recalculateFullTextHeight();
+        }
+
+        return linesWrapped;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateAllLines()
     {
+        m_relayoutRequired = false;
+        m_wrapWidth = getMaxLineWidth();
+
+        // Only the visible lines will be word-wrapped, the other lines keep an estimated height until they are shown
         for (auto& line : m_lines)
-            recalculateLineText(line);
+            estimateLineHeight(line);
 
+        updateLinePositions(0);
         recalculateFullTextHeight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::updateLinePositions(std::size_t firstIndex)
+    {
+        if (m_lines.empty())
+            return;
+
+        if (firstIndex == 0)
+            m_lines[0].top = 0;
+
+        for (std::size_t i = std::max<std::size_t>(firstIndex, 1); i < m_lines.size(); ++i)
+            m_lines[i].top = m_lines[i-1].top + m_lines[i-1].height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateFullTextHeight()
     {
         m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        if (!m_lines.empty())
+        {
+            // The positions keep growing when lines are added and the oldest ones are removed, so they are occasionally
+            // moved back to 0 to prevent them from becoming so large that they would lose precision.
+            if (std::abs(m_lines.front().top) > 1000000)
+                updateLinePositions(0);
+
+            m_fullTextHeight = m_lines.back().top + m_lines.back().height - m_lines.front().top;
+        }
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scrollbar->getMaximum();
@@ -459,66 +683,74 @@ namespace tgui
 
     void ChatBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"Scrollbar")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scrollbar->setWidth(m_scrollbar->getDefaultWidth());
+                    setSize(m_size);
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                m_scrollbar->setWidth(m_scrollbar->getDefaultWidth());
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setWidth(width);
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setWidth(width);
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scrollbar->setInheritedOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
 
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
 
-            recalculateAllLines();
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scrollbar->setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                    line.text.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                for (auto& line : m_lines)
+                    line.text.setFont(m_fontCached);
+
+                m_relayoutRequired = true;
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -651,10 +883,23 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSizeCached) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate({0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSizeCached)});
 
-        for (const auto& line : m_lines)
+        // Only draw the lines that are visible
+        const auto visibleLines = getVisibleLines();
+        for (std::size_t i = visibleLines.first; i < visibleLines.second; ++i)
         {
-            target.drawText(states, line.text);
-            states.transform.translate({0, line.text.getSize().y});
+            const Line& line = m_lines[i];
+            RenderStates lineStates = states;
+            lineStates.transform.translate({0, line.top - m_lines.front().top});
+            if (line.wrapped)
+                target.drawText(lineStates, line.text);
+            else
+            {
+                // Visible lines are normally wrapped in updateTime, but the widget can be drawn without it being called
+                Text text = line.text;
+                const float maxWidth = getMaxLineWidth();
+                text.setString((maxWidth >= 0) ? Text::wordWrap(maxWidth, line.string, m_fontCached, text.getCharacterSize(), false) : String{});
+                target.drawText(lineStates, text);
+            }
         }
 
         target.removeClippingLayer();
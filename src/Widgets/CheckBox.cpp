@@ -156,6 +156,7 @@ namespace tgui
 
             onCheck.emit(this, true);
             onChange.emit(this, true);
+            invalidate();
         }
         else
             RadioButton::setChecked(checked);
@@ -197,10 +198,17 @@ namespace tgui
 
     void CheckBox::rendererChanged(const String& property)
     {
-        if (property == U"TextureUnchecked")
-            m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == U"TextureChecked")
-            m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
+        {
+            case TGUI_RENDERER_PROPERTY_ID("TextureUnchecked").getValue():
+                m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureChecked").getValue():
+                m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
+                break;
+        }
 
         RadioButton::rendererChanged(property);
     }
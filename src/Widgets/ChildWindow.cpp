@@ -64,8 +64,6 @@ namespace tgui
 
         setTitleTextSize(getGlobalTextSize());
         m_titleBarHeightCached = m_titleText.getSize().y * 1.25f;
-        if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-            m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
 
         if (initRenderer)
         {
@@ -376,6 +374,11 @@ namespace tgui
 
     void ChildWindow::setSize(const Layout2d& size)
     {
+        // The size no longer depends on the client size when a different layout is set. When the size layout is updated
+        // because a bound widget changed, this function is called with the existing layout.
+        if (&size != &m_size)
+            m_sizeSetFromClientSize = false;
+
         Container::setSize(size);
 
         m_bordersCached.updateParentSize(getSize());
@@ -399,17 +402,15 @@ namespace tgui
 
     void ChildWindow::setClientSize(const Layout2d& size)
     {
-        m_decorationLayoutX = nullptr;
-        m_decorationLayoutY = nullptr;
-
         const Vector2f decorationSize = {m_bordersCached.getLeft() + m_bordersCached.getRight(),
                                          m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached};
 
         setSize(size + decorationSize);
 
-        // Keep a pointer to the layout containing the decoration size. If the decoration changes then we need to update this layout
-        m_decorationLayoutX = m_size.x.getRightOperand();
-        m_decorationLayoutY = m_size.y.getRightOperand();
+        // Keep the client size. If the decoration changes then we need to update the size
+        m_clientSizeLayout = size;
+        m_sizeSetFromClientSize = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,6 +468,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -489,6 +491,7 @@ namespace tgui
 
         // Reposition the title text
         updateTitleBarHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -506,6 +509,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -555,6 +559,7 @@ namespace tgui
             m_minimizeButton->setVisible(false);
 
         updateTitleBarHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1094,147 +1099,156 @@ namespace tgui
 
     void ChildWindow::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
 
-            if (m_decorationLayoutX && (m_decorationLayoutX == m_size.x.getRightOperand()))
-                m_decorationLayoutX->replaceValue(m_bordersCached.getLeft() + m_bordersCached.getRight());
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+                updateSizeFromClientSize();
+                setSize(m_size);
+                break;
 
-            setSize(m_size);
-        }
-        else if (property == U"TitleColor")
-        {
-            m_titleText.setColor(getSharedRenderer()->getTitleColor());
-        }
-        else if ((property == U"TextureTitleBar") || (property == U"TitleBarHeight"))
-        {
-            const float oldTitleBarHeight = m_titleBarHeightCached;
+            case TGUI_RENDERER_PROPERTY_ID("TitleColor").getValue():
+                m_titleText.setColor(getSharedRenderer()->getTitleColor());
+                break;
 
-            if (property == U"TextureTitleBar")
-                m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
+            case TGUI_RENDERER_PROPERTY_ID("TextureTitleBar").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TitleBarHeight").getValue():
+            {
+                const float oldTitleBarHeight = m_titleBarHeightCached;
 
-            m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
-            updateTitleBarHeight();
+                if (propertyId == TGUI_RENDERER_PROPERTY_ID("TextureTitleBar"))
+                    m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
-            if (oldTitleBarHeight != m_titleBarHeightCached)
-            {
-                if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                    m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
+                m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
+                updateTitleBarHeight();
+
+                if (oldTitleBarHeight != m_titleBarHeightCached)
+                {
+                    updateSizeFromClientSize();
 
-                // If the title bar changes in height then the inner size will also change
-                recalculateBoundSizeLayouts();
+                    // If the title bar changes in height then the inner size will also change
+                    recalculateBoundSizeLayouts();
+                }
+                break;
             }
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"BorderBelowTitleBar")
-        {
-            m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
-            if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
-                m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            setPosition(m_position);
-        }
-        else if (property == U"PaddingBetweenButtons")
-        {
-            m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
-            setPosition(m_position);
-        }
-        else if (property == U"MinimumResizableBorderWidth")
-        {
-            m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
-        }
-        else if (property == U"ShowTextOnTitleButtons")
-        {
-            m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
-            setTitleButtons(m_titleButtons);
-        }
-        else if (property == U"CloseButton")
-        {
-            auto closeButtonRenderer = getSharedRenderer()->getCloseButton();
-            m_closeButton->setRenderer(closeButtonRenderer);
 
-            const auto maximizeButtonRenderer = getSharedRenderer()->getMaximizeButton();
-            if (!maximizeButtonRenderer || (maximizeButtonRenderer->propertyValuePairs.empty() && !maximizeButtonRenderer->connectedTheme))
-                m_maximizeButton->setRenderer(closeButtonRenderer);
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
 
-            const auto minimizeButtonRenderer = getSharedRenderer()->getMinimizeButton();
-            if (!minimizeButtonRenderer || (minimizeButtonRenderer->propertyValuePairs.empty() && !minimizeButtonRenderer->connectedTheme))
-                m_minimizeButton->setRenderer(closeButtonRenderer);
+            case TGUI_RENDERER_PROPERTY_ID("BorderBelowTitleBar").getValue():
+                m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
+                updateSizeFromClientSize();
+                break;
 
-            updateTitleBarHeight();
-        }
-        else if (property == U"MaximizeButton")
-        {
-            auto buttonRenderer = getSharedRenderer()->getMaximizeButton();
-            if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
-                buttonRenderer = getSharedRenderer()->getCloseButton();
+            case TGUI_RENDERER_PROPERTY_ID("DistanceToSide").getValue():
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                setPosition(m_position);
+                break;
 
-            m_maximizeButton->setRenderer(buttonRenderer);
-            updateTitleBarHeight();
-        }
-        else if (property == U"MinimizeButton")
-        {
-            auto buttonRenderer = getSharedRenderer()->getMinimizeButton();
-            if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
-                buttonRenderer = getSharedRenderer()->getCloseButton();
+            case TGUI_RENDERER_PROPERTY_ID("PaddingBetweenButtons").getValue():
+                m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
+                setPosition(m_position);
+                break;
 
-            m_minimizeButton->setRenderer(buttonRenderer);
-            updateTitleBarHeight();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TitleBarColor")
-        {
-            m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Container::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("MinimumResizableBorderWidth").getValue():
+                m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
+                break;
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
-                button->setInheritedOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("ShowTextOnTitleButtons").getValue():
+                m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
+                setTitleButtons(m_titleButtons);
+                break;
 
-            m_titleText.setOpacity(m_opacityCached);
-            m_spriteTitleBar.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Container::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("CloseButton").getValue():
+            {
+                auto closeButtonRenderer = getSharedRenderer()->getCloseButton();
+                m_closeButton->setRenderer(closeButtonRenderer);
 
-            for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                const auto maximizeButtonRenderer = getSharedRenderer()->getMaximizeButton();
+                if (!maximizeButtonRenderer || (maximizeButtonRenderer->propertyValuePairs.empty() && !maximizeButtonRenderer->connectedTheme))
+                    m_maximizeButton->setRenderer(closeButtonRenderer);
+
+                const auto minimizeButtonRenderer = getSharedRenderer()->getMinimizeButton();
+                if (!minimizeButtonRenderer || (minimizeButtonRenderer->propertyValuePairs.empty() && !minimizeButtonRenderer->connectedTheme))
+                    m_minimizeButton->setRenderer(closeButtonRenderer);
+
+                updateTitleBarHeight();
+                break;
+            }
+
+            case TGUI_RENDERER_PROPERTY_ID("MaximizeButton").getValue():
             {
-                if (button->isVisible())
-                    button->setInheritedFont(m_fontCached);
+                auto buttonRenderer = getSharedRenderer()->getMaximizeButton();
+                if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
+                    buttonRenderer = getSharedRenderer()->getCloseButton();
+
+                m_maximizeButton->setRenderer(buttonRenderer);
+                updateTitleBarHeight();
+                break;
             }
 
-            m_titleText.setFont(m_fontCached);
-            if (m_titleTextSize == 0)
-                m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+            case TGUI_RENDERER_PROPERTY_ID("MinimizeButton").getValue():
+            {
+                auto buttonRenderer = getSharedRenderer()->getMinimizeButton();
+                if (!buttonRenderer || (buttonRenderer->propertyValuePairs.empty() && !buttonRenderer->connectedTheme))
+                    buttonRenderer = getSharedRenderer()->getCloseButton();
 
-            setPosition(m_position);
+                m_minimizeButton->setRenderer(buttonRenderer);
+                updateTitleBarHeight();
+                break;
+            }
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TitleBarColor").getValue():
+                m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorFocused").getValue():
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                    button->setInheritedOpacity(m_opacityCached);
+
+                m_titleText.setOpacity(m_opacityCached);
+                m_spriteTitleBar.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Container::rendererChanged(property);
+
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->isVisible())
+                        button->setInheritedFont(m_fontCached);
+                }
+
+                m_titleText.setFont(m_fontCached);
+                if (m_titleTextSize == 0)
+                    m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, getSharedRenderer()->getTitleBarHeight() * 0.8f));
+
+                setPosition(m_position);
+                break;
+
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1502,6 +1516,15 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChildWindow::updateSizeFromClientSize()
+    {
+        // Call the function from this class, derived classes may do more than just changing the size in setClientSize
+        if (m_sizeSetFromClientSize)
+            ChildWindow::setClientSize(m_clientSizeLayout);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,6 +435,8 @@ namespace tgui
 
         if (colorLast != color)
             onColorChange.emit(this, color);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -596,57 +598,71 @@ namespace tgui
 
     void ColorPicker::rendererChanged(const String& property)
     {
-        if (property == U"Button")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            const auto& renderer = getSharedRenderer()->getButton();
-
-            // During loading from file, the renderer is loaded before the child widgets are loaded.
-            // In this exceptional case, we shouldn't try to set the renderer. The buttons will have their renderer in the form file anyway.
-            if (get("#TGUI_INTERNAL$ColorPickerOK#"))
+            case TGUI_RENDERER_PROPERTY_ID("Button").getValue():
             {
-                get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
-                get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
-                get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
+                const auto& renderer = getSharedRenderer()->getButton();
+
+                // During loading from file, the renderer is loaded before the child widgets are loaded.
+                // In this exceptional case, we shouldn't try to set the renderer. The buttons will have their renderer in the form file anyway.
+                if (get("#TGUI_INTERNAL$ColorPickerOK#"))
+                {
+                    get<Button>("#TGUI_INTERNAL$ColorPickerReset#")->setRenderer(renderer);
+                    get<Button>("#TGUI_INTERNAL$ColorPickerOK#")->setRenderer(renderer);
+                    get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
+                }
+                break;
             }
-        }
-        else if (property == U"Label")
-        {
-            const auto& renderer = getSharedRenderer()->getLabel();
 
-            for (const auto& it : getWidgets())
+            case TGUI_RENDERER_PROPERTY_ID("Label").getValue():
             {
-                if (auto label = std::dynamic_pointer_cast<Label>(it))
-                    label->setRenderer(renderer);
+                const auto& renderer = getSharedRenderer()->getLabel();
+
+                for (const auto& it : getWidgets())
+                {
+                    if (auto label = std::dynamic_pointer_cast<Label>(it))
+                        label->setRenderer(renderer);
+                }
+                break;
             }
-        }
-        else if (property == U"Slider")
-        {
-            const auto& renderer = getSharedRenderer()->getSlider();
 
-            m_red->setRenderer(renderer);
-            m_green->setRenderer(renderer);
-            m_blue->setRenderer(renderer);
-            m_alpha->setRenderer(renderer);
+            case TGUI_RENDERER_PROPERTY_ID("Slider").getValue():
+            {
+                const auto& renderer = getSharedRenderer()->getSlider();
 
-            m_value->setRenderer(renderer);
-        }
-        else if (property == U"EditBox")
-        {
-            const auto& renderer = getSharedRenderer()->getEditBox();
+                m_red->setRenderer(renderer);
+                m_green->setRenderer(renderer);
+                m_blue->setRenderer(renderer);
+                m_alpha->setRenderer(renderer);
+
+                m_value->setRenderer(renderer);
+                break;
+            }
 
-            for (const auto& it : getWidgets())
+            case TGUI_RENDERER_PROPERTY_ID("EditBox").getValue():
             {
-                if (auto editBox = std::dynamic_pointer_cast<EditBox>(it))
-                    editBox->setRenderer(renderer);
+                const auto& renderer = getSharedRenderer()->getEditBox();
+
+                for (const auto& it : getWidgets())
+                {
+                    if (auto editBox = std::dynamic_pointer_cast<EditBox>(it))
+                        editBox->setRenderer(renderer);
+                }
+                break;
             }
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                ChildWindow::rendererChanged(property);
+                m_colorWheelSprite.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ChildWindow::rendererChanged(property);
-            m_colorWheelSprite.setOpacity(m_opacityCached);
-        }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
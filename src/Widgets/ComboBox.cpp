@@ -260,6 +260,8 @@ namespace tgui
 
         if (m_nrOfItemsToDisplay < m_listBox->getItemCount())
             updateListBoxHeight();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -282,6 +284,7 @@ namespace tgui
     {
         const std::size_t itemIndex = m_listBox->addItem(item, id);
         updateListBoxHeight();
+        invalidate();
         return itemIndex;
     }
 
@@ -291,6 +294,7 @@ namespace tgui
     {
         m_listBox->addMultipleItems(itemNames);
         updateListBoxHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,6 +309,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
 
+        invalidate();
         return ret;
     }
 
@@ -320,6 +325,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
 
+        invalidate();
         return ret;
     }
 
@@ -335,6 +341,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
 
+        invalidate();
         return ret;
     }
 
@@ -344,6 +351,7 @@ namespace tgui
     {
         m_text.setString("");
         m_listBox->deselectItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,6 +368,7 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        invalidate();
         return ret;
     }
 
@@ -389,6 +398,7 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        invalidate();
         return ret;
     }
 
@@ -400,6 +410,7 @@ namespace tgui
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -457,6 +468,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -466,6 +478,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -475,6 +488,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -504,6 +518,7 @@ namespace tgui
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
         m_listBox->setMaximumItems(maximumItems);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -527,6 +542,7 @@ namespace tgui
     void ComboBox::setDefaultText(const String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +557,7 @@ namespace tgui
     void ComboBox::setExpandDirection(ExpandDirection direction)
     {
         m_expandDirection = direction;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -682,136 +699,142 @@ namespace tgui
 
     void ComboBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            if (m_enabled || !m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorCached);
-            if (!getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            if (!m_enabled && m_textColorDisabledCached.isSet())
-                m_text.setColor(m_textColorDisabledCached);
-        }
-        else if (property == U"TextStyle")
-        {
-            m_text.setStyle(getSharedRenderer()->getTextStyle());
-            if (!getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            if (getSharedRenderer()->getDefaultTextColor().isSet())
-                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-            else
-                m_defaultText.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"DefaultTextStyle")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            if (getSharedRenderer()->getDefaultTextStyle().isSet())
-                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-            else
-                m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureBackgroundDisabled")
-        {
-            m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
-        }
-        else if (property == U"TextureArrow")
-        {
-            m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                if (m_enabled || !m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorCached);
+                if (!getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDisabled").getValue():
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                if (!m_enabled && m_textColorDisabledCached.isSet())
+                    m_text.setColor(m_textColorDisabledCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+                m_text.setStyle(getSharedRenderer()->getTextStyle());
+                if (!getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("DefaultTextColor").getValue():
+                if (getSharedRenderer()->getDefaultTextColor().isSet())
+                    m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                else
+                    m_defaultText.setColor(getSharedRenderer()->getTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("DefaultTextStyle").getValue():
+                if (getSharedRenderer()->getDefaultTextStyle().isSet())
+                    m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                else
+                    m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackgroundDisabled").getValue():
+                m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrow").getValue():
+                m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowHover").getValue():
+                m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowDisabled").getValue():
+                m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ListBox").getValue():
+                m_listBox->setRenderer(getSharedRenderer()->getListBox());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDisabled").getValue():
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowBackgroundColor").getValue():
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowBackgroundColorHover").getValue():
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowBackgroundColorDisabled").getValue():
+                m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColor").getValue():
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColorHover").getValue():
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColorDisabled").getValue():
+                m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
+                m_spriteArrow.setOpacity(m_opacityCached);
+                m_spriteArrowHover.setOpacity(m_opacityCached);
+                m_spriteArrowDisabled.setOpacity(m_opacityCached);
+
+                m_text.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                m_listBox->setInheritedFont(m_fontCached);
+
+                setSize(m_size);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == U"TextureArrowHover")
-        {
-            m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
-        }
-        else if (property == U"TextureArrowDisabled")
-        {
-            m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
-        }
-        else if (property == U"ListBox")
-        {
-            m_listBox->setRenderer(getSharedRenderer()->getListBox());
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == U"ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == U"ArrowBackgroundColorDisabled")
-        {
-            m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
-        }
-        else if (property == U"ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == U"ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if (property == U"ArrowColorDisabled")
-        {
-            m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteBackgroundDisabled.setOpacity(m_opacityCached);
-            m_spriteArrow.setOpacity(m_opacityCached);
-            m_spriteArrowHover.setOpacity(m_opacityCached);
-            m_spriteArrowDisabled.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-
-            m_text.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            m_listBox->setInheritedFont(m_fontCached);
-
-            setSize(m_size);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -160,6 +160,7 @@ namespace tgui
         setPasswordCharacter(m_passwordChar);
 
         onTextChange.emit(this, m_text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +175,7 @@ namespace tgui
     void EditBox::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,6 +192,7 @@ namespace tgui
         m_selStart = std::min(m_text.length(), start);
         updateSelEnd(length == String::npos ? m_text.length() : std::min(m_text.length(), start + length));
         updateSelection();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -217,6 +220,7 @@ namespace tgui
         m_textAfterSelection.setString("");
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -249,6 +253,8 @@ namespace tgui
             // Set the caret behind the last character
             setCaretPosition(m_displayedText.length());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -311,6 +317,8 @@ namespace tgui
             if (m_selEnd > m_displayedText.length())
                 setCaretPosition(m_selEnd);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,6 +333,7 @@ namespace tgui
     void EditBox::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,6 +355,7 @@ namespace tgui
         m_selStart = charactersBeforeCaret;
         updateSelEnd(charactersBeforeCaret);
         updateSelection();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,6 +396,7 @@ namespace tgui
     {
         m_textSuffix.setString(suffix);
         recalculateTextPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -746,147 +757,157 @@ namespace tgui
 
     void EditBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            updateTextSize();
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
 
-            m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if (property == U"CaretWidth")
-        {
-            m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
-            m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
-        }
-        else if ((property == U"TextColor") || (property == U"TextColorDisabled") || (property == U"TextColorFocused"))
-        {
-            updateTextColor();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == U"Texture")
-        {
-            m_sprite.setTexture(getSharedRenderer()->getTexture());
-        }
-        else if (property == U"TextureHover")
-        {
-            m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
-        }
-        else if (property == U"TextureDisabled")
-        {
-            m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
-        }
-        else if (property == U"TextureFocused")
-        {
-            m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
-        }
-        else if (property == U"TextStyle")
-        {
-            const TextStyles style = getSharedRenderer()->getTextStyle();
-            m_textBeforeSelection.setStyle(style);
-            m_textAfterSelection.setStyle(style);
-            m_textSelection.setStyle(style);
-            m_textSuffix.setStyle(style);
-            m_textFull.setStyle(style);
-
-            // The width of the text can be different, which requires the text to be realigned if it was centered or right-aligned
-            updateTextSize();
-        }
-        else if (property == U"DefaultTextStyle")
-        {
-            m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"BorderColorDisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"BackgroundColorFocused")
-        {
-            m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
-        }
-        else if (property == U"CaretColor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == U"CaretColorHover")
-        {
-            m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
-        }
-        else if (property == U"CaretColorFocused")
-        {
-TGUI_IGNORE_DEPRECATED_WARNINGS_START
-            m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
-TGUI_IGNORE_DEPRECATED_WARNINGS_END
-        }
-        else if (property == U"SelectedTextBackgroundColor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection.setOpacity(m_opacityCached);
-            m_textSelection.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-            m_textSuffix.setOpacity(m_opacityCached);
-
-            m_sprite.setOpacity(m_opacityCached);
-            m_spriteHover.setOpacity(m_opacityCached);
-            m_spriteDisabled.setOpacity(m_opacityCached);
-            m_spriteFocused.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            ClickableWidget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection.setFont(m_fontCached);
-            m_textAfterSelection.setFont(m_fontCached);
-            m_textSuffix.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            updateTextSize();
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
+                updateTextSize();
+
+                m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CaretWidth").getValue():
+                m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
+                m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDisabled").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorFocused").getValue():
+                updateTextColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("DefaultTextColor").getValue():
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Texture").getValue():
+                m_sprite.setTexture(getSharedRenderer()->getTexture());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureHover").getValue():
+                m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDisabled").getValue():
+                m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureFocused").getValue():
+                m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+            {
+                const TextStyles style = getSharedRenderer()->getTextStyle();
+                m_textBeforeSelection.setStyle(style);
+                m_textAfterSelection.setStyle(style);
+                m_textSelection.setStyle(style);
+                m_textSuffix.setStyle(style);
+                m_textFull.setStyle(style);
+
+                // The width of the text can be different, which requires the text to be realigned if it was centered or right-aligned
+                updateTextSize();
+                break;
+            }
+
+            case TGUI_RENDERER_PROPERTY_ID("DefaultTextStyle").getValue():
+                m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorHover").getValue():
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDisabled").getValue():
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorFocused").getValue():
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDisabled").getValue():
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorFocused").getValue():
+                m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CaretColor").getValue():
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CaretColorHover").getValue():
+                m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CaretColorFocused").getValue():
+    TGUI_IGNORE_DEPRECATED_WARNINGS_START
+                m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
+    TGUI_IGNORE_DEPRECATED_WARNINGS_END
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextBackgroundColor").getValue():
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                ClickableWidget::rendererChanged(property);
+
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection.setOpacity(m_opacityCached);
+                m_textSelection.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                m_textSuffix.setOpacity(m_opacityCached);
+
+                m_sprite.setOpacity(m_opacityCached);
+                m_spriteHover.setOpacity(m_opacityCached);
+                m_spriteDisabled.setOpacity(m_opacityCached);
+                m_spriteFocused.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                ClickableWidget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection.setFont(m_fontCached);
+                m_textAfterSelection.setFont(m_fontCached);
+                m_textSuffix.setFont(m_fontCached);
+                m_textFull.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                updateTextSize();
+                break;
+
+            default:
+                ClickableWidget::rendererChanged(property);
+                break;
         }
-        else
-            ClickableWidget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1052,9 +1073,9 @@ TGUI_IGNORE_DEPRECATED_WARNINGS_END
                 continue;
             }
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = m_fontCached.getAdvance(' ', textSize, bold) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = m_fontCached.getAdvance(curChar, textSize, bold);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize, bold);
             if (width + charWidth < posX)
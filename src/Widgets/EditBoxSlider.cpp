@@ -201,6 +201,7 @@ namespace tgui
     void EditBoxSlider::setMinimum(float minimum)
     {
         m_slider->setMinimum(minimum);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +216,7 @@ namespace tgui
     void EditBoxSlider::setMaximum(float maximum)
     {
         m_slider->setMaximum(maximum);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +234,7 @@ namespace tgui
         {
             m_slider->setValue(value);
             setString(String::fromNumberRounded(value, m_decimalPlaces));
+            invalidate();
             return true;
         }
         return false;
@@ -249,6 +252,7 @@ namespace tgui
     void EditBoxSlider::setStep(float step)
     {
         m_slider->setStep(step);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +268,7 @@ namespace tgui
     {
         m_decimalPlaces = decimalPlaces;
         setString(String::fromNumberRounded(getValue(), m_decimalPlaces));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,6 +283,7 @@ namespace tgui
     void EditBoxSlider::setTextAlignment(HorizontalAlignment alignment)
     {
         m_editBox->setAlignment(alignment);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -347,6 +347,7 @@ namespace tgui
         historyChanged();
 
         changePath(path, false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,6 +362,7 @@ namespace tgui
     void FileDialog::setFilename(const String& filename)
     {
         m_editBoxFilename->setText(filename);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +410,7 @@ namespace tgui
         }
 
         m_comboBoxFileTypes->setSelectedItemByIndex(defaultIndex);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -430,6 +433,7 @@ namespace tgui
     void FileDialog::setConfirmButtonText(const String& text)
     {
         m_buttonConfirm->setText(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +448,7 @@ namespace tgui
     void FileDialog::setCancelButtonText(const String& text)
     {
         m_buttonCancel->setText(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -458,6 +463,7 @@ namespace tgui
     void FileDialog::setCreateFolderButtonText(const String& text)
     {
         m_buttonCreateFolder->setText(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -477,6 +483,8 @@ namespace tgui
             addCreateFolderButton();
         else
             remove(m_buttonCreateFolder);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +499,7 @@ namespace tgui
     void FileDialog::setFilenameLabelText(const String& labelText)
     {
         m_labelFilename->setText(labelText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -507,6 +516,7 @@ namespace tgui
         m_listView->setColumnText(0, nameColumnText);
         m_listView->setColumnText(1, sizeColumnText);
         m_listView->setColumnText(2, modifiedColumnText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -676,6 +686,7 @@ namespace tgui
         if (oldSelectedItem >= 0)
             m_listView->setSelectedItem(static_cast<std::size_t>(oldSelectedItem));
 
+        m_listView->invalidate();
         return true;
     }
 
@@ -1223,92 +1234,101 @@ namespace tgui
 
     void FileDialog::rendererChanged(const String& property)
     {
-        if (property == U"ListView")
-        {
-            m_listView->setRenderer(getSharedRenderer()->getListView());
-        }
-        else if (property == U"EditBox")
-        {
-            const auto& renderer = getSharedRenderer()->getEditBox();
-            m_editBoxFilename->setRenderer(renderer);
-            m_editBoxPath->setRenderer(renderer);
-        }
-        else if (property == U"Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            m_buttonCancel->setRenderer(renderer);
-            m_buttonConfirm->setRenderer(renderer);
-            m_buttonCreateFolder->setRenderer(renderer);
-
-            if (!getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(renderer);
-            if (!getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(renderer);
-            if (!getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(renderer);
-        }
-        else if (property == U"BackButton")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            if (getSharedRenderer()->getBackButton())
-                m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
-            else
-                m_buttonBack->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"ForwardButton")
-        {
-            if (getSharedRenderer()->getForwardButton())
-                m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
-            else
-                m_buttonForward->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"UpButton")
-        {
-            if (getSharedRenderer()->getUpButton())
-                m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
-            else
-                m_buttonUp->setRenderer(getSharedRenderer()->getButton());
-        }
-        else if (property == U"FilenameLabel")
-        {
-            m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
-        }
-        else if (property == U"FileTypeComboBox")
-        {
-            m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
-        }
-        else if (property == U"ArrowsOnNavigationButtonsVisible")
-        {
-            if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+            case TGUI_RENDERER_PROPERTY_ID("ListView").getValue():
+                m_listView->setRenderer(getSharedRenderer()->getListView());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("EditBox").getValue():
             {
-                m_buttonBack->setText(U"\u2190");
-                m_buttonForward->setText(U"\u2192");
-                m_buttonUp->setText(U"\u2191");
+                const auto& renderer = getSharedRenderer()->getEditBox();
+                m_editBoxFilename->setRenderer(renderer);
+                m_editBoxPath->setRenderer(renderer);
+                break;
             }
-            else
+
+            case TGUI_RENDERER_PROPERTY_ID("Button").getValue():
             {
-                m_buttonBack->setText(U"");
-                m_buttonForward->setText(U"");
-                m_buttonUp->setText(U"");
+                const auto& renderer = getSharedRenderer()->getButton();
+                m_buttonCancel->setRenderer(renderer);
+                m_buttonConfirm->setRenderer(renderer);
+                m_buttonCreateFolder->setRenderer(renderer);
+
+                if (!getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(renderer);
+                if (!getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(renderer);
+                if (!getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(renderer);
+                break;
             }
+
+            case TGUI_RENDERER_PROPERTY_ID("BackButton").getValue():
+                if (getSharedRenderer()->getBackButton())
+                    m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
+                else
+                    m_buttonBack->setRenderer(getSharedRenderer()->getButton());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ForwardButton").getValue():
+                if (getSharedRenderer()->getForwardButton())
+                    m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
+                else
+                    m_buttonForward->setRenderer(getSharedRenderer()->getButton());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("UpButton").getValue():
+                if (getSharedRenderer()->getUpButton())
+                    m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
+                else
+                    m_buttonUp->setRenderer(getSharedRenderer()->getButton());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("FilenameLabel").getValue():
+                m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("FileTypeComboBox").getValue():
+                m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowsOnNavigationButtonsVisible").getValue():
+                if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
+                {
+                    m_buttonBack->setText(U"\u2190");
+                    m_buttonForward->setText(U"\u2192");
+                    m_buttonUp->setText(U"\u2191");
+                }
+                else
+                {
+                    m_buttonBack->setText(U"");
+                    m_buttonForward->setText(U"");
+                    m_buttonUp->setText(U"");
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                ChildWindow::rendererChanged(property);
+
+                m_buttonBack->setInheritedFont(m_fontCached);
+                m_buttonForward->setInheritedFont(m_fontCached);
+                m_buttonUp->setInheritedFont(m_fontCached);
+                m_editBoxPath->setInheritedFont(m_fontCached);
+                m_listView->setInheritedFont(m_fontCached);
+                m_labelFilename->setInheritedFont(m_fontCached);
+                m_editBoxFilename->setInheritedFont(m_fontCached);
+                m_comboBoxFileTypes->setInheritedFont(m_fontCached);
+                m_buttonCancel->setInheritedFont(m_fontCached);
+                m_buttonConfirm->setInheritedFont(m_fontCached);
+                m_buttonCreateFolder->setInheritedFont(m_fontCached);
+                break;
+
+            default:
+                ChildWindow::rendererChanged(property);
+                break;
         }
-        else if (property == U"Font")
-        {
-            ChildWindow::rendererChanged(property);
-
-            m_buttonBack->setInheritedFont(m_fontCached);
-            m_buttonForward->setInheritedFont(m_fontCached);
-            m_buttonUp->setInheritedFont(m_fontCached);
-            m_editBoxPath->setInheritedFont(m_fontCached);
-            m_listView->setInheritedFont(m_fontCached);
-            m_labelFilename->setInheritedFont(m_fontCached);
-            m_editBoxFilename->setInheritedFont(m_fontCached);
-            m_comboBoxFileTypes->setInheritedFont(m_fontCached);
-            m_buttonCancel->setInheritedFont(m_fontCached);
-            m_buttonConfirm->setInheritedFont(m_fontCached);
-            m_buttonCreateFolder->setInheritedFont(m_fontCached);
-        }
-        else
-            ChildWindow::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
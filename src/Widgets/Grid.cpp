@@ -183,6 +183,8 @@ namespace tgui
             updateWidgets();
         else // We don't need to change the size
             updatePositionsOfAllWidgets();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +324,7 @@ namespace tgui
         }
 
         setWidgetCell(widget, row, col, alignment, padding);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -375,6 +378,7 @@ namespace tgui
         // Automatically update the widgets when their size changes
         m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
 
+        invalidate();
         return true;
     }
 
@@ -420,6 +424,8 @@ namespace tgui
             // Update all widgets
             updateWidgets();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -469,6 +475,8 @@ namespace tgui
             m_objAlignment[row][col] = alignment;
             updatePositionsOfAllWidgets();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
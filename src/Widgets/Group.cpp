@@ -134,13 +134,18 @@ namespace tgui
 
     void Group::rendererChanged(const String& property)
     {
-        if (property == U"Padding")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+
+            default:
+                Container::rendererChanged(property);
+                break;
         }
-        else
-            Container::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
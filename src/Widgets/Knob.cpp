@@ -133,6 +133,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +156,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +186,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,6 +217,8 @@ namespace tgui
             // The knob might have to point in a different direction even though it has the same value
             recalculateRotation();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +248,8 @@ namespace tgui
 
             onValueChange.emit(this, m_value);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,6 +267,7 @@ namespace tgui
 
         // The knob might have to point in a different direction even though it has the same value
         recalculateRotation();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,46 +481,52 @@ namespace tgui
 
     void Knob::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"TextureBackground")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureForeground").getValue():
+                m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColor").getValue():
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ImageRotation").getValue():
+                m_imageRotationCached = getSharedRenderer()->getImageRotation();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteForeground.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == U"TextureForeground")
-        {
-            m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ImageRotation")
-        {
-            m_imageRotationCached = getSharedRenderer()->getImageRotation();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteForeground.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <numeric> // accumulate
@@ -119,6 +120,7 @@ namespace tgui
     {
         m_string = string;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +144,7 @@ namespace tgui
     {
         m_horizontalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +160,7 @@ namespace tgui
     {
         m_verticalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -210,6 +214,7 @@ namespace tgui
 
         m_autoSize = autoSize;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +233,7 @@ namespace tgui
 
         m_maximumTextWidth = maximumWidth;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -385,97 +391,105 @@ namespace tgui
 
     void Label::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
-                                        getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            for (auto& line : m_lines)
-            {
-                for (auto& textPiece : line)
-                    textPiece.setColor(m_textColorCached);
-            }
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextOutlineThickness")
-        {
-            m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
-            rearrangeText();
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
-            for (auto& line : m_lines)
-            {
-                for (auto& textPiece : line)
-                    textPiece.setOutlineColor(m_textOutlineColorCached);
-            }
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
+                                            getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
+                rearrangeText();
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
-            {
-                m_scrollbar->setWidth(m_scrollbar->getDefaultWidth());
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                m_paddingCached.updateParentSize(getSize());
                 rearrangeText();
-            }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setWidth(width);
-            rearrangeText();
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            rearrangeText();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+                rearrangeText();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setColor(m_textColorCached);
+                }
+                break;
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_scrollbar->setInheritedOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            for (auto& line : m_lines)
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextOutlineThickness").getValue():
+                m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
+                rearrangeText();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextOutlineColor").getValue():
+                m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setOutlineColor(m_textOutlineColorCached);
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scrollbar->setWidth(m_scrollbar->getDefaultWidth());
+                    rearrangeText();
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                for (auto& textPiece : line)
-                    textPiece.setOpacity(m_opacityCached);
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setWidth(width);
+                rearrangeText();
+                break;
             }
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+                rearrangeText();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_scrollbar->setInheritedOpacity(m_opacityCached);
+
+                for (auto& line : m_lines)
+                {
+                    for (auto& textPiece : line)
+                        textPiece.setOpacity(m_opacityCached);
+                }
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -582,10 +596,11 @@ namespace tgui
 
     void Label::rearrangeText()
     {
-        m_lines.clear();
-
         if (m_fontCached == nullptr)
+        {
+            m_lines.clear();
             return;
+        }
 
         m_scrollbar->setVisible(!m_autoSize);
 
@@ -604,14 +619,14 @@ namespace tgui
                 maxWidth -= m_scrollbar->getSize().x;
 
             if (maxWidth <= 0)
+            {
+                m_lines.clear();
                 return;
+            }
         }
 
         // Fit the text in the available space
-        Optional<String> wordWrappedString = (maxWidth > 0)
-            ? Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold)
-            : Optional<String>();
-        String* stringPtr = wordWrappedString.has_value() ? &wordWrappedString.value() : &m_string;
+        const String* stringPtr = (maxWidth > 0) ? &getWordWrappedText(maxWidth) : &m_string;
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
@@ -631,10 +646,12 @@ namespace tgui
             {
                 maxWidth -= m_scrollbar->getSize().x;
                 if (maxWidth <= 0)
+                {
+                    m_lines.clear();
                     return;
+                }
 
-                wordWrappedString = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
-                stringPtr = &wordWrappedString.value();
+                stringPtr = &getWordWrappedText(maxWidth);
 
                 const auto newLineCount = std::count(stringPtr->begin(), stringPtr->end(), U'\n') + 1;
                 requiredTextHeight = (newLineCount - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
@@ -648,35 +665,50 @@ namespace tgui
             m_scrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_scrollbar->getSize().x, m_bordersCached.getTop()});
         }
 
-        // Split the string in multiple lines
+        // Split the string in multiple lines. Lines that didn't change since the last time keep their existing text piece.
         float width = 0;
+        std::size_t lineIndex = 0;
         std::size_t searchPosStart = 0;
         std::size_t newLinePos = 0;
         while (newLinePos != String::npos)
         {
             newLinePos = stringPtr->find('\n', searchPosStart);
 
-            TGUI_EMPLACE_BACK(line, m_lines)
-            TGUI_EMPLACE_BACK(textPiece, line)
-            textPiece.setCharacterSize(getTextSize());
-            textPiece.setFont(m_fontCached);
-            textPiece.setStyle(m_textStyleCached);
-            textPiece.setColor(m_textColorCached);
-            textPiece.setOpacity(m_opacityCached);
-            textPiece.setOutlineColor(m_textOutlineColorCached);
-            textPiece.setOutlineThickness(m_textOutlineThicknessCached);
-
+            String lineString;
             if (newLinePos != String::npos)
-                textPiece.setString(stringPtr->substr(searchPosStart, newLinePos - searchPosStart));
+                lineString = stringPtr->substr(searchPosStart, newLinePos - searchPosStart);
             else
-                textPiece.setString(stringPtr->substr(searchPosStart));
+                lineString = stringPtr->substr(searchPosStart);
 
-            if (textPiece.getSize().x > width)
-                width = textPiece.getSize().x;
+            if (lineIndex == m_lines.size())
+                m_lines.emplace_back();
 
+            auto& line = m_lines[lineIndex];
+            if ((line.size() != 1) || (line[0].getString() != lineString) || (line[0].getCharacterSize() != getTextSize())
+             || (line[0].getFont() != m_fontCached) || (line[0].getStyle() != m_textStyleCached)
+             || (line[0].getOutlineThickness() != m_textOutlineThicknessCached))
+            {
+                line.clear();
+                TGUI_EMPLACE_BACK(textPiece, line)
+                textPiece.setCharacterSize(getTextSize());
+                textPiece.setFont(m_fontCached);
+                textPiece.setStyle(m_textStyleCached);
+                textPiece.setColor(m_textColorCached);
+                textPiece.setOpacity(m_opacityCached);
+                textPiece.setOutlineColor(m_textOutlineColorCached);
+                textPiece.setOutlineThickness(m_textOutlineThicknessCached);
+                textPiece.setString(lineString);
+            }
+
+            if (line[0].getSize().x > width)
+                width = line[0].getSize().x;
+
+            ++lineIndex;
             searchPosStart = newLinePos + 1;
         }
 
+        m_lines.resize(lineIndex);
+
         // Update the size of the label
         if (m_autoSize)
         {
@@ -694,6 +726,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const String& Label::getWordWrappedText(float maxWidth)
+    {
+        // The widths of the characters only have to be measured again when the text or its properties changed
+        const bool bold = (m_textStyleCached & TextStyle::Bold) != 0;
+        const float fontScale = m_fontCached ? m_fontCached.getBackendFont()->getFontScale() : 1;
+        if ((m_wordWrapCache.font != m_fontCached) || (m_wordWrapCache.fontScale != fontScale)
+         || (m_wordWrapCache.textSize != m_textSizeCached) || (m_wordWrapCache.bold != bold) || (m_wordWrapCache.text != m_string))
+        {
+            m_wordWrapCache.text = m_string;
+            m_wordWrapCache.font = m_fontCached;
+            m_wordWrapCache.fontScale = fontScale;
+            m_wordWrapCache.textSize = m_textSizeCached;
+            m_wordWrapCache.bold = bold;
+            m_wordWrapCache.characterWidths = Text::measureCharacters(m_string, m_fontCached, m_textSizeCached, bold);
+            m_wordWrapCache.wrappedTexts.clear();
+        }
+
+        for (const auto& wrappedText : m_wordWrapCache.wrappedTexts)
+        {
+            if (wrappedText.first == maxWidth)
+                return wrappedText.second;
+        }
+
+        // Only the two most recent results are kept, as a label with a scrollbar may word-wrap its text for two widths
+        if (m_wordWrapCache.wrappedTexts.size() >= 2)
+            m_wordWrapCache.wrappedTexts.erase(m_wordWrapCache.wrappedTexts.begin());
+
+        m_wordWrapCache.wrappedTexts.emplace_back(maxWidth, Text::wordWrap(maxWidth, m_string, m_wordWrapCache.characterWidths));
+        return m_wordWrapCache.wrappedTexts.back().second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::updateTextPiecePositions(float maxWidth)
     {
         TGUI_ASSERT(!m_lines.empty(), "Label::updateTextPiecePositions requires that m_lines contains at least one line");
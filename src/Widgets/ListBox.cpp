@@ -130,6 +130,7 @@ namespace tgui
             triggerOnScroll();
         }
 
+        invalidate();
         return m_items.size() - 1;
     }
 
@@ -155,6 +156,8 @@ namespace tgui
             m_scrollbar->setValue(m_scrollbar->getMaxValue());
             triggerOnScroll();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +214,7 @@ namespace tgui
             triggerOnScroll();
         }
 
+        invalidate();
         return true;
     }
 
@@ -219,6 +223,7 @@ namespace tgui
     void ListBox::deselectItem()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,6 +278,7 @@ namespace tgui
         updateItemPositions();
         triggerOnScroll();
 
+        invalidate();
         return true;
     }
 
@@ -289,6 +295,7 @@ namespace tgui
 
         m_scrollbar->setMaximum(0);
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,6 +406,7 @@ namespace tgui
             return false;
 
         m_items[index].text.setString(newValue);
+        invalidate();
         return true;
     }
 
@@ -466,6 +474,7 @@ namespace tgui
 
         updateItemPositions();
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,6 +526,8 @@ namespace tgui
             updateItemPositions();
             triggerOnScroll();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +556,7 @@ namespace tgui
     void ListBox::setTextAlignment(HorizontalAlignment alignment)
     {
         m_textAlignment = alignment;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -818,127 +830,135 @@ namespace tgui
 
     void ListBox::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"SelectedTextColor")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColorsAndStyle();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
 
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
 
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-        }
-        else if (property == U"SelectedTextStyle")
-        {
-            m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColorsAndStyle();
+                break;
 
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
+            case TGUI_RENDERER_PROPERTY_ID("TextColorHover").getValue():
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColorsAndStyle();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColorHover").getValue():
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColorsAndStyle();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+
+                for (auto& item : m_items)
+                    item.text.setStyle(m_textStyleCached);
+
+                if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
                     m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
-            }
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextStyle").getValue():
+                m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
+
+                if (m_selectedItem >= 0)
+                {
+                    if (m_selectedTextStyleCached.isSet())
+                        m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
+                    else
+                        m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_scrollbar->setWidth(m_scrollbar->getDefaultWidth());
+                    setSize(m_size);
+                }
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                m_scrollbar->setWidth(m_scrollbar->getDefaultWidth());
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
+                m_scrollbar->setWidth(width);
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
-            m_scrollbar->setWidth(width);
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_scrollbar->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
 
-            // Recalculate the text size with the new font
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
-                m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColor").getValue():
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColorHover").getValue():
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_scrollbar->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
                 for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSizeCached);
-            }
+                    item.text.setOpacity(m_opacityCached);
+                break;
 
-            updateItemPositions();
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                for (auto& item : m_items)
+                    item.text.setFont(m_fontCached);
+
+                // Recalculate the text size with the new font
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+                    for (auto& item : m_items)
+                        item.text.setCharacterSize(m_textSizeCached);
+                }
+
+                updateItemPositions();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
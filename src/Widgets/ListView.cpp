@@ -140,6 +140,7 @@ namespace tgui
 
         m_resizingColumn = 0;
 
+        invalidate();
         return m_columns.size()-1;
     }
 
@@ -159,6 +160,8 @@ namespace tgui
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
             updateColumnWidths();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +194,7 @@ namespace tgui
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
         updateColumnWidths();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,6 +233,7 @@ namespace tgui
         updateColumnWidths();
 
         m_resizingColumn = 0;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,6 +249,7 @@ namespace tgui
     {
         m_requestedHeaderHeight = height;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -276,6 +282,8 @@ namespace tgui
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,6 +313,8 @@ namespace tgui
         {
             TGUI_PRINT_WARNING("setColumnAutoResize called with invalid index.");
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -333,6 +343,8 @@ namespace tgui
         {
             TGUI_PRINT_WARNING("setColumnExpanded called with invalid index.");
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,6 +366,7 @@ namespace tgui
     {
         m_headerVisible = showHeader;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,6 +380,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const String& text)
     {
+        if (m_cellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while the items are provided by a callback.");
+            return m_virtualItemCount;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
@@ -380,6 +399,7 @@ namespace tgui
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
+        invalidate();
         return m_items.size()-1;
     }
 
@@ -387,6 +407,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<String>& itemTexts)
     {
+        if (m_cellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while the items are provided by a callback.");
+            return m_virtualItemCount;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -403,6 +429,7 @@ namespace tgui
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
+        invalidate();
         return m_items.size()-1;
     }
 
@@ -410,6 +437,12 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<String>>& items)
     {
+        if (m_cellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addMultipleItems can't be used while the items are provided by a callback.");
+            return;
+        }
+
         bool columnWidthChanged = false;
         for (const auto& itemToInsert : items)
         {
@@ -431,6 +464,8 @@ namespace tgui
         // Scroll down when auto-scrolling is enabled
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -456,6 +491,8 @@ namespace tgui
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
             m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -484,6 +521,8 @@ namespace tgui
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
             m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -518,6 +557,8 @@ namespace tgui
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
             m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,6 +590,7 @@ namespace tgui
         else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(index, m_textColorHoverCached);
 
+        invalidate();
         return true;
     }
 
@@ -582,6 +624,7 @@ namespace tgui
         else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(index, m_textColorHoverCached);
 
+        invalidate();
         return true;
     }
 
@@ -702,6 +745,7 @@ namespace tgui
 
         updateVerticalScrollbarMaximum();
 
+        invalidate();
         return true;
     }
 
@@ -714,6 +758,11 @@ namespace tgui
 
         m_items.clear();
 
+        m_cellProvider = nullptr;
+        m_virtualItemCount = 0;
+        m_virtualItemOrder.clear();
+        m_visibleItems.clear();
+
         m_iconCount = 0;
         m_maxIconWidth = m_fixedIconSize.x;
 
@@ -721,15 +770,17 @@ namespace tgui
             updateColumnWidths();
 
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
+            invalidate();
             return;
         }
 
@@ -740,6 +791,8 @@ namespace tgui
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
         else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -749,6 +802,7 @@ namespace tgui
         if (!m_multiSelect)
         {
             updateSelectedItem(indices.empty() ? -1 : static_cast<int>(*indices.begin()));
+            invalidate();
             return;
         }
 
@@ -777,6 +831,8 @@ namespace tgui
             m_firstSelectedItemIndex = -1;
             onItemSelect.emit(this, -1);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -784,6 +840,7 @@ namespace tgui
     void ListView::deselectItems()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -893,6 +950,8 @@ namespace tgui
 
         if (updateWidestItemInColumn(0, index))
             updateColumnWidths();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -912,19 +971,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_cellProvider)
+            return m_virtualItemCount;
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_cellProvider)
+            return getVirtualItemCell(rowIndex, columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -935,6 +1000,9 @@ namespace tgui
 
     String ListView::getItem(std::size_t index) const
     {
+        if (m_cellProvider)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -949,7 +1017,12 @@ namespace tgui
     std::vector<String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<String> row;
-        if (index < m_items.size())
+        if (m_cellProvider && (index < m_virtualItemCount))
+        {
+            for (std::size_t i = 0; i < std::max<std::size_t>(1, m_columns.size()); ++i)
+                row.push_back(getVirtualItemCell(index, i));
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -963,6 +1036,32 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
+        if (m_cellProvider)
+        {
+            // Only the order of the row indices is changed, the cells are still requested from the callback
+            if (m_virtualItemOrder.empty())
+            {
+                m_virtualItemOrder.resize(m_virtualItemCount);
+                for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                    m_virtualItemOrder[i] = i;
+            }
+
+            // The callback is only asked for each cell once, instead of twice for every comparison
+            std::vector<String> keys(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                keys[i] = m_cellProvider(i, index);
+
+            std::sort(m_virtualItemOrder.begin(), m_virtualItemOrder.end(),
+                [&cmp, &keys](std::size_t a, std::size_t b)
+                {
+                    return cmp(keys[a], keys[b]);
+                });
+
+            m_visibleItemsOutdated = true;
+            invalidate();
+            return;
+        }
+
         if (index >= m_items.size())
             return;
 
@@ -982,15 +1081,16 @@ namespace tgui
 
         // While the width of the widest item didn't change, its index might have, so we need to locate it again
         updateWidestItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<String> ListView::getItems() const
     {
-        std::vector<String> items(m_items.size());
+        std::vector<String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -1002,6 +1102,15 @@ namespace tgui
     {
         std::vector<std::vector<String>> rows;
 
+        if (m_cellProvider)
+        {
+            rows.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
+
         for (const auto& item : m_items)
         {
             std::vector<String> row;
@@ -1017,6 +1126,71 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setVirtualItems(std::size_t itemCount, const CellProviderFunc& cellProvider)
+    {
+        removeAllItems();
+
+        m_cellProvider = cellProvider;
+        setVirtualItemCount(itemCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setVirtualItemCount(std::size_t itemCount)
+    {
+        if (!m_cellProvider)
+            return;
+
+        // Forget about the selected and hovered items that no longer exist
+        if (!m_selectedItems.empty() && (*m_selectedItems.rbegin() >= itemCount))
+            updateSelectedItem(-1);
+        if (m_hoveredItem >= static_cast<int>(itemCount))
+            updateHoveredItem(-1);
+
+        // If the rows were sorted then new rows are placed at the end
+        if (!m_virtualItemOrder.empty())
+        {
+            if (itemCount < m_virtualItemCount)
+            {
+                m_virtualItemOrder.erase(std::remove_if(m_virtualItemOrder.begin(), m_virtualItemOrder.end(),
+                    [itemCount](std::size_t row){ return row >= itemCount; }), m_virtualItemOrder.end());
+            }
+            else
+            {
+                for (std::size_t i = m_virtualItemCount; i < itemCount; ++i)
+                    m_virtualItemOrder.push_back(i);
+            }
+        }
+
+        const bool itemsAdded = (itemCount > m_virtualItemCount);
+        m_virtualItemCount = itemCount;
+        m_visibleItemsOutdated = true;
+
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        if (itemsAdded && m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::refreshVirtualItems()
+    {
+        m_visibleItemsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::hasVirtualItems() const
+    {
+        return static_cast<bool>(m_cellProvider);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setItemHeight(unsigned int itemHeight)
     {
         m_itemHeight = itemHeight;
@@ -1031,6 +1205,8 @@ namespace tgui
             m_verticalScrollbar->setScrollAmount(m_itemHeight + m_gridLinesWidth);
         else
             m_verticalScrollbar->setScrollAmount(m_itemHeight);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1053,6 +1229,8 @@ namespace tgui
                 text.setCharacterSize(m_textSizeCached);
         }
 
+        m_visibleItems.clear();
+
         if (!m_headerTextSize)
         {
             const unsigned int headerTextSize = getHeaderTextSize();
@@ -1094,6 +1272,7 @@ namespace tgui
         }
 
         updateColumnWidths();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1112,6 +1291,7 @@ namespace tgui
     {
         m_separatorWidth = width;
         updateColumnWidths();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1127,6 +1307,7 @@ namespace tgui
     {
         m_headerSeparatorHeight = height;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1148,6 +1329,8 @@ namespace tgui
             m_verticalScrollbar->setScrollAmount(m_itemHeight + m_gridLinesWidth);
         else
             m_verticalScrollbar->setScrollAmount(m_itemHeight);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1177,6 +1360,7 @@ namespace tgui
     {
         m_showVerticalGridLines = showGridLines;
         updateColumnWidths();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1197,6 +1381,8 @@ namespace tgui
             m_verticalScrollbar->setScrollAmount(m_itemHeight + m_gridLinesWidth);
         else
             m_verticalScrollbar->setScrollAmount(m_itemHeight);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1226,6 +1412,7 @@ namespace tgui
 
         updateWidestItemInColumn(m_columns.empty() ? 0 : (m_columns.size() - 1));
         updateColumnWidths();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1341,6 +1528,8 @@ namespace tgui
 
         if (updateWidestItemInColumn(0))
             updateColumnWidths();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1356,6 +1545,7 @@ namespace tgui
     {
         m_resizableColumns = resizable;
         m_resizingColumn = 0;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1679,7 +1869,7 @@ namespace tgui
             else // Only one item should be selected
                 setSelectedItem(indexAbove);
         }
-        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(m_items.size())))
+        else if (event.code == Event::KeyboardKey::Down && (m_focusedItemIndex + 1 < static_cast<int>(getItemCount())))
         {
             const std::size_t indexBelow = (m_focusedItemIndex >= 0) ? static_cast<std::size_t>(m_focusedItemIndex) + 1 : 0;
             if (m_multiSelect && keyboard::isShiftPressed(event))
@@ -1702,8 +1892,16 @@ namespace tgui
             for (const std::size_t index : m_selectedItems)
             {
                 String temp;
-                for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                if (m_cellProvider)
+                {
+                    for (const auto& cell : getItemRow(index))
+                        temp.append(cell + '\t');
+                }
+                else
+                {
+                    for (const auto& text : m_items[index].texts)
+                        temp.append(text.getString() + '\t');
+                }
 
                 if (*temp.rbegin() == '\t')
                     temp.pop_back();
@@ -1745,157 +1943,169 @@ namespace tgui
 
     void ListView::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextureHeaderBackground")
-        {
-            m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
-        }
-        else if (property == U"TextureBackground")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateItemColors();
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
 
-            if (!m_headerTextColorCached.isSet())
-                updateHeaderTextsColor();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateItemColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateItemColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateItemColors();
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureHeaderBackground").getValue():
+                m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateItemColors();
+
+                if (!m_headerTextColorCached.isSet())
+                    updateHeaderTextsColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorHover").getValue():
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateItemColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateItemColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColorHover").getValue():
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateItemColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_verticalScrollbar->setWidth(m_verticalScrollbar->getDefaultWidth());
+                    m_horizontalScrollbar->setHeight(m_horizontalScrollbar->getDefaultWidth());
+                    setSize(m_size);
+                }
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                m_verticalScrollbar->setWidth(m_verticalScrollbar->getDefaultWidth());
-                m_horizontalScrollbar->setHeight(m_horizontalScrollbar->getDefaultWidth());
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setWidth(width);
+                m_horizontalScrollbar->setHeight(width);
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setWidth(width);
-            m_horizontalScrollbar->setHeight(width);
-            setSize(m_size);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == U"GridLinesColor")
-        {
-            m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
-        }
-        else if (property == U"HeaderTextColor")
-        {
-            m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
-            updateHeaderTextsColor();
-        }
-        else if (property == U"HeaderBackgroundColor")
-        {
-            m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
 
-            m_spriteHeaderBackground.setOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("SeparatorColor").getValue():
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
 
-            for (auto& column : m_columns)
-                column.text.setOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("GridLinesColor").getValue():
+                m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
+                break;
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("HeaderTextColor").getValue():
+                m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
+                updateHeaderTextsColor();
+                break;
 
-                item.icon.setOpacity(m_opacityCached);
-            }
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("HeaderBackgroundColor").getValue():
+                m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
+                break;
 
-            for (auto& column : m_columns)
-                column.text.setFont(m_fontCached);
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
-            }
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColor").getValue():
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColorHover").getValue():
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+
+                m_spriteHeaderBackground.setOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
 
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
-                // Recalculate the text size with the new font
-                updateTextSize();
-            }
-            else
-            {
                 for (auto& column : m_columns)
+                    column.text.setOpacity(m_opacityCached);
+
+                for (auto& item : m_items)
                 {
-                    if (column.designWidth <= 0)
-                        column.width = calculateAutoColumnWidth(column.text);
+                    for (auto& text : item.texts)
+                        text.setOpacity(m_opacityCached);
+
+                    item.icon.setOpacity(m_opacityCached);
                 }
 
-                updateWidestItem();
-                updateColumnWidths();
-            }
+                m_visibleItems.clear();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                for (auto& column : m_columns)
+                    column.text.setFont(m_fontCached);
+
+                for (auto& item : m_items)
+                {
+                    for (auto& text : item.texts)
+                        text.setFont(m_fontCached);
+                }
+
+                m_visibleItems.clear();
+
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                {
+                    // Recalculate the text size with the new font
+                    updateTextSize();
+                }
+                else
+                {
+                    for (auto& column : m_columns)
+                    {
+                        if (column.designWidth <= 0)
+                            column.width = calculateAutoColumnWidth(column.text);
+                    }
+
+                    updateWidestItem();
+                    updateColumnWidths();
+                }
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2150,7 +2360,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const String& caption)
+    Text ListView::createText(const String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -2183,6 +2393,17 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
+        if (m_cellProvider)
+        {
+            // Only the rows that are visible have Text objects, the others will get the correct color when they become visible
+            if ((index >= m_visibleItemsFirstIndex) && (index - m_visibleItemsFirstIndex < m_visibleItems.size()))
+            {
+                for (auto& text : m_visibleItems[index - m_visibleItemsFirstIndex].texts)
+                    text.setColor(color);
+            }
+            return;
+        }
+
         for (auto& text : m_items[index].texts)
             text.setColor(color);
     }
@@ -2217,8 +2438,16 @@ namespace tgui
 
     void ListView::updateItemColors()
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            setItemColor(i, m_textColorCached);
+        if (m_cellProvider)
+        {
+            for (std::size_t i = 0; i < m_visibleItems.size(); ++i)
+                setItemColor(m_visibleItemsFirstIndex + i, m_textColorCached);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                setItemColor(i, m_textColorCached);
+        }
 
         updateSelectedAndhoveredItemColors();
     }
@@ -2588,7 +2817,7 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getItemCount())))
             updateHoveredItem(hoveredItem);
         else
             updateHoveredItem(-1);
@@ -2759,9 +2988,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2820,16 +3050,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = getItemForDrawing(i);
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2847,7 +3078,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = getItemForDrawing(i);
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2857,12 +3089,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == HorizontalAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == HorizontalAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == HorizontalAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2871,6 +3103,104 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    String ListView::getVirtualItemCell(std::size_t rowIndex, std::size_t columnIndex) const
+    {
+        if (!m_virtualItemOrder.empty())
+            rowIndex = m_virtualItemOrder[rowIndex];
+
+        return m_cellProvider(rowIndex, columnIndex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color ListView::getItemTextColor(std::size_t index) const
+    {
+        const bool hovered = (static_cast<int>(index) == m_hoveredItem);
+        if (m_selectedItems.find(index) != m_selectedItems.end())
+        {
+            if (hovered && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+        }
+        else if (hovered && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+
+        return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const
+    {
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        if (!m_visibleItemsOutdated && (firstItem == m_visibleItemsFirstIndex) && (lastItem - firstItem == m_visibleItems.size())
+         && (m_visibleItems.empty() || (m_visibleItems[0].texts.size() == columnCount)))
+            return;
+
+        // Rows that remain visible are kept as-is, the Text objects of the other rows are reused for the rows that became visible
+        std::vector<Item> oldItems;
+        oldItems.swap(m_visibleItems);
+        m_visibleItems.resize(lastItem - firstItem);
+
+        std::vector<bool> rowsFilled(m_visibleItems.size(), false);
+        std::vector<Item> unusedItems;
+        for (std::size_t i = 0; i < oldItems.size(); ++i)
+        {
+            const std::size_t row = m_visibleItemsFirstIndex + i;
+            if (!m_visibleItemsOutdated && (row >= firstItem) && (row < lastItem) && (oldItems[i].texts.size() == columnCount))
+            {
+                m_visibleItems[row - firstItem] = std::move(oldItems[i]);
+                rowsFilled[row - firstItem] = true;
+            }
+            else
+                unusedItems.push_back(std::move(oldItems[i]));
+        }
+
+        for (std::size_t i = 0; i < m_visibleItems.size(); ++i)
+        {
+            if (rowsFilled[i])
+                continue;
+
+            Item& item = m_visibleItems[i];
+            if (!unusedItems.empty())
+            {
+                item = std::move(unusedItems.back());
+                unusedItems.pop_back();
+            }
+
+            const std::size_t row = firstItem + i;
+            const Color color = getItemTextColor(row);
+            if (item.texts.size() > columnCount)
+                item.texts.erase(item.texts.begin() + static_cast<std::ptrdiff_t>(columnCount), item.texts.end());
+
+            for (std::size_t column = 0; column < columnCount; ++column)
+            {
+                if (column < item.texts.size())
+                    item.texts[column].setString(getVirtualItemCell(row, column));
+                else
+                    item.texts.push_back(createText(getVirtualItemCell(row, column)));
+
+                item.texts[column].setColor(color);
+            }
+        }
+
+        m_visibleItemsFirstIndex = firstItem;
+        m_visibleItemsOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListView::Item& ListView::getItemForDrawing(std::size_t index) const
+    {
+        if (m_cellProvider)
+            return m_visibleItems[index - m_visibleItemsFirstIndex];
+        else
+            return m_items[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::updateTime(Duration elapsedTime)
     {
         const bool screenRefreshRequired = Widget::updateTime(elapsedTime);
@@ -2906,16 +3236,20 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t itemCount = getItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
+        if (m_cellProvider)
+            updateVisibleItems(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -2958,7 +3292,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
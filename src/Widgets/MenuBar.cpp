@@ -350,6 +350,7 @@ namespace tgui
     void MenuBar::addMenu(const String& text)
     {
         createMenu(m_menus, text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -381,6 +382,7 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+        invalidate();
         return true;
     }
 
@@ -396,6 +398,7 @@ namespace tgui
             return false;
 
         menu->text.setString(text);
+        invalidate();
         return true;
     }
 
@@ -404,6 +407,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +421,7 @@ namespace tgui
 
             closeMenu();
             m_menus.erase(m_menus.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidate();
             return true;
         }
 
@@ -438,6 +443,7 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
+        invalidate();
         return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
     }
 
@@ -455,6 +461,7 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
+        invalidate();
         return removeSubMenusImpl(hierarchy, 0, m_menus);
     }
 
@@ -472,6 +479,7 @@ namespace tgui
 
             m_menus[i].enabled = enabled;
             updateMenuTextColor(m_menus[i], (m_visibleMenu == static_cast<int>(i)));
+            invalidate();
             return true;
         }
 
@@ -520,6 +528,7 @@ namespace tgui
 
             menuItem.enabled = enabled;
             updateMenuTextColor(menuItem, (menu->selectedMenuItem == static_cast<int>(j)));
+            invalidate();
             return true;
         }
 
@@ -559,6 +568,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -573,6 +583,7 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,6 +638,8 @@ namespace tgui
 
         if (m_menuWidgetPlaceholder->getParent())
             m_menuWidgetPlaceholder->getParent()->remove(m_menuWidgetPlaceholder);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -759,74 +772,80 @@ namespace tgui
 
     void MenuBar::rendererChanged(const String& property)
     {
-        if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors(m_menus, m_visibleMenu);
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureItemBackground")
-        {
-            m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
-        }
-        else if (property == U"TextureSelectedItemBackground")
-        {
-            m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColor")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-        }
-        else if (property == U"SeparatorColor")
-        {
-            m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
-        }
-        else if (property == U"SeparatorThickness")
-        {
-            m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
-        }
-        else if (property == U"SeparatorVerticalPadding")
-        {
-            m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
-        }
-        else if (property == U"SeparatorSidePadding")
-        {
-            m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            updateTextOpacity(m_menus);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            updateTextFont(m_menus);
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDisabled").getValue():
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors(m_menus, m_visibleMenu);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureItemBackground").getValue():
+                m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureSelectedItemBackground").getValue():
+                m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColor").getValue():
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("DistanceToSide").getValue():
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SeparatorColor").getValue():
+                m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SeparatorThickness").getValue():
+                m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SeparatorVerticalPadding").getValue():
+                m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SeparatorSidePadding").getValue():
+                m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+                updateTextOpacity(m_menus);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+                updateTextFont(m_menus);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -218,6 +218,7 @@ namespace tgui
         m_label->setText(text);
 
         rearrange();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -245,6 +246,7 @@ namespace tgui
     {
         addButtonImpl(caption);
         rearrange();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -274,6 +276,7 @@ namespace tgui
         }
 
         rearrange();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -293,6 +296,7 @@ namespace tgui
     {
         m_labelAlignment = labelAlignment;
         rearrange();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,6 +312,7 @@ namespace tgui
     {
         m_buttonAlignment = buttonAlignment;
         rearrange();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,35 +431,42 @@ namespace tgui
 
     void MessageBox::rendererChanged(const String& property)
     {
-        if (property == U"TextColor")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"Button")
-        {
-            const auto& renderer = getSharedRenderer()->getButton();
-            for (auto& button : m_buttons)
-                button->setRenderer(renderer);
-        }
-        else if (property == U"Font")
-        {
-            ChildWindow::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
+                break;
 
-            m_label->setInheritedFont(m_fontCached);
+            case TGUI_RENDERER_PROPERTY_ID("Button").getValue():
+            {
+                const auto& renderer = getSharedRenderer()->getButton();
+                for (auto& button : m_buttons)
+                    button->setRenderer(renderer);
+                break;
+            }
 
-            for (auto& button : m_buttons)
-                button->setInheritedFont(m_fontCached);
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                ChildWindow::rendererChanged(property);
 
-            rearrange();
-        }
-        else
-        {
-            const bool autoSize = m_autoSize;
-            ChildWindow::rendererChanged(property);
+                m_label->setInheritedFont(m_fontCached);
+
+                for (auto& button : m_buttons)
+                    button->setInheritedFont(m_fontCached);
 
-            // Updating e.g. the borders will cause setSize to be called and auto-sizing to be disabled.
-            // Make certain that updating the renderer never impacts our auto-size flag.
-            m_autoSize = autoSize;
+                rearrange();
+                break;
+
+            default:
+            {
+                const bool autoSize = m_autoSize;
+                ChildWindow::rendererChanged(property);
+
+                // Updating e.g. the borders will cause setSize to be called and auto-sizing to be disabled.
+                // Make certain that updating the renderer never impacts our auto-size flag.
+                m_autoSize = autoSize;
+                break;
+            }
         }
     }
 
@@ -275,34 +275,40 @@ namespace tgui
 
     void Panel::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("RoundedBorderRadius").getValue():
+                m_roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Group::rendererChanged(property);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else if (property == U"RoundedBorderRadius")
-        {
-            m_roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Group::rendererChanged(property);
-            m_spriteBackground.setOpacity(m_opacityCached);
-        }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -121,6 +121,7 @@ namespace tgui
 
         ScrollablePanel::add(newPanel, id);
 
+        invalidate();
         return newPanel;
     }
 
@@ -146,6 +147,7 @@ namespace tgui
 
         updateItemsSize();
         updateItemsPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,6 +197,7 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
+        invalidate();
         return true;
     }
 
@@ -203,6 +206,7 @@ namespace tgui
     void PanelListBox::deselectItem()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,6 +257,7 @@ namespace tgui
 
         updateItemsPositions();
 
+        invalidate();
         return true;
     }
 
@@ -265,6 +270,7 @@ namespace tgui
 
         m_items.clear();
         ScrollablePanel::removeAllWidgets();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -407,6 +413,8 @@ namespace tgui
 
             updateItemsPositions();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -487,29 +495,32 @@ namespace tgui
 
     void PanelListBox::rendererChanged(const String& property)
     {
-        if (property == "ItemsBackgroundColor")
-        {
-            m_itemsBackgroundColorCached = getSharedRenderer()->getItemsBackgroundColor();
-            m_panelTemplate->getSharedRenderer()->setBackgroundColor(m_itemsBackgroundColorCached);
-        }
-        else if (property == "ItemsBackgroundColorHover")
-        {
-            m_itemsBackgroundColorHoverCached = getSharedRenderer()->getItemsBackgroundColorHover();
-            updateSelectedAndHoveringItemColorsAndStyle();
-        }
-        else if (property == "SelectedItemsBackgroundColor")
-        {
-            m_selectedItemsBackgroundColorCached = getSharedRenderer()->getSelectedItemsBackgroundColor();
-            updateSelectedAndHoveringItemColorsAndStyle();
-        }
-        else if (property == "SelectedItemsBackgroundColorHover")
-        {
-            m_selectedItemsBackgroundColorHoverCached = getSharedRenderer()->getSelectedItemsBackgroundColorHover();
-            updateSelectedAndHoveringItemColorsAndStyle();
-        }
-        else
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            ScrollablePanel::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("ItemsBackgroundColor").getValue():
+                m_itemsBackgroundColorCached = getSharedRenderer()->getItemsBackgroundColor();
+                m_panelTemplate->getSharedRenderer()->setBackgroundColor(m_itemsBackgroundColorCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ItemsBackgroundColorHover").getValue():
+                m_itemsBackgroundColorHoverCached = getSharedRenderer()->getItemsBackgroundColorHover();
+                updateSelectedAndHoveringItemColorsAndStyle();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedItemsBackgroundColor").getValue():
+                m_selectedItemsBackgroundColorCached = getSharedRenderer()->getSelectedItemsBackgroundColor();
+                updateSelectedAndHoveringItemColorsAndStyle();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedItemsBackgroundColorHover").getValue():
+                m_selectedItemsBackgroundColorHoverCached = getSharedRenderer()->getSelectedItemsBackgroundColorHover();
+                updateSelectedAndHoveringItemColorsAndStyle();
+                break;
+
+            default:
+                ScrollablePanel::rendererChanged(property);
+                break;
         }
     }
 
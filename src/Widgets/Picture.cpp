@@ -176,22 +176,30 @@ namespace tgui
 
     void Picture::rendererChanged(const String& property)
     {
-        if (property == U"Texture")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            case TGUI_RENDERER_PROPERTY_ID("Texture").getValue():
+            {
+                const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
-                setSize(Vector2f{texture.getImageSize()});
+                if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
+                    setSize(Vector2f{texture.getImageSize()});
 
-            m_sprite.setTexture(texture);
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-            m_sprite.setOpacity(m_opacityCached);
+                m_sprite.setTexture(texture);
+                break;
+            }
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+                m_sprite.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
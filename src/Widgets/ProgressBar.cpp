@@ -127,6 +127,7 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +154,7 @@ namespace tgui
 
         // Recalculate the size of the front image (the size of the part that will be drawn)
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +186,8 @@ namespace tgui
             // Recalculate the size of the front image (the size of the part that will be drawn)
             recalculateFillSize();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,6 +217,7 @@ namespace tgui
         m_textFront.setString(text);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +233,7 @@ namespace tgui
     {
         m_fillDirection = direction;
         recalculateFillSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -266,78 +272,89 @@ namespace tgui
 
     void ProgressBar::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if ((property == U"TextColor") || (property == U"TextColorFilled"))
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_textBack.setColor(getSharedRenderer()->getTextColor());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
 
-            if (getSharedRenderer()->getTextColorFilled().isSet())
-                m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
-            else
-                m_textFront.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureFill")
-        {
-            m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
-            recalculateFillSize();
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textBack.setStyle(getSharedRenderer()->getTextStyle());
-            m_textFront.setStyle(getSharedRenderer()->getTextStyle());
-        }
-        else if (property == U"TextOutlineThickness")
-        {
-            const float outlineThickness = getSharedRenderer()->getTextOutlineThickness();
-            m_textBack.setOutlineThickness(outlineThickness);
-            m_textFront.setOutlineThickness(outlineThickness);
-        }
-        else if (property == U"TextOutlineColor")
-        {
-            const Color& outlineColor = getSharedRenderer()->getTextOutlineColor();
-            m_textBack.setOutlineColor(outlineColor);
-            m_textFront.setOutlineColor(outlineColor);
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"FillColor")
-        {
-            m_fillColorCached = getSharedRenderer()->getFillColor();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorFilled").getValue():
+                m_textBack.setColor(getSharedRenderer()->getTextColor());
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteFill.setOpacity(m_opacityCached);
+                if (getSharedRenderer()->getTextColorFilled().isSet())
+                    m_textFront.setColor(getSharedRenderer()->getTextColorFilled());
+                else
+                    m_textFront.setColor(getSharedRenderer()->getTextColor());
+                break;
 
-            m_textBack.setOpacity(m_opacityCached);
-            m_textFront.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
 
-            m_textBack.setFont(m_fontCached);
-            m_textFront.setFont(m_fontCached);
-            updateTextSize();
+            case TGUI_RENDERER_PROPERTY_ID("TextureFill").getValue():
+                m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
+                recalculateFillSize();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+                m_textBack.setStyle(getSharedRenderer()->getTextStyle());
+                m_textFront.setStyle(getSharedRenderer()->getTextStyle());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextOutlineThickness").getValue():
+            {
+                const float outlineThickness = getSharedRenderer()->getTextOutlineThickness();
+                m_textBack.setOutlineThickness(outlineThickness);
+                m_textFront.setOutlineThickness(outlineThickness);
+                break;
+            }
+
+            case TGUI_RENDERER_PROPERTY_ID("TextOutlineColor").getValue():
+            {
+                const Color& outlineColor = getSharedRenderer()->getTextOutlineColor();
+                m_textBack.setOutlineColor(outlineColor);
+                m_textFront.setOutlineColor(outlineColor);
+                break;
+            }
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("FillColor").getValue():
+                m_fillColorCached = getSharedRenderer()->getFillColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteFill.setOpacity(m_opacityCached);
+
+                m_textBack.setOpacity(m_opacityCached);
+                m_textFront.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                m_textBack.setFont(m_fontCached);
+                m_textFront.setFont(m_fontCached);
+                updateTextSize();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +162,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,6 +175,7 @@ namespace tgui
 
         m_text.setString(text);
         onSizeChange.emit(this, getSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,165 +305,175 @@ namespace tgui
 
     void RadioButton::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            m_bordersCached.updateParentSize(getSize());
-            updateTextureSizes();
-        }
-        else if ((property == U"TextColor") || (property == U"TextColorHover") || (property == U"TextColorDisabled")
-              || (property == U"TextColorChecked") || (property == U"TextColorCheckedHover") || (property == U"TextColorCheckedDisabled"))
-        {
-            updateTextColor();
-        }
-        else if (property == U"TextStyle")
-        {
-            m_textStyleCached = getSharedRenderer()->getTextStyle();
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
+        {
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                m_bordersCached.updateParentSize(getSize());
+                updateTextureSizes();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorHover").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDisabled").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorChecked").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorCheckedHover").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("TextColorCheckedDisabled").getValue():
+                updateTextColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextStyle").getValue():
+                m_textStyleCached = getSharedRenderer()->getTextStyle();
+
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == U"TextStyleChecked")
-        {
-            m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
+            case TGUI_RENDERER_PROPERTY_ID("TextStyleChecked").getValue():
+                m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
-            if (m_checked && m_textStyleCheckedCached.isSet())
-                m_text.setStyle(m_textStyleCheckedCached);
-            else
-                m_text.setStyle(m_textStyleCached);
-        }
-        else if (property == U"TextureUnchecked")
-        {
-            m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
-            updateTextureSizes();
-        }
-        else if (property == U"TextureChecked")
-        {
-            m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
-            updateTextureSizes();
-        }
-        else if (property == U"TextureUncheckedHover")
-        {
-            m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
-        }
-        else if (property == U"TextureCheckedHover")
-        {
-            m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
-        }
-        else if (property == U"TextureUncheckedDisabled")
-        {
-            m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
-        }
-        else if (property == U"TextureCheckedDisabled")
-        {
-            m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
-        }
-        else if (property == U"TextureUncheckedFocused")
-        {
-            m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
-        }
-        else if (property == U"TextureCheckedFocused")
-        {
-            m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
-        }
-        else if (property == U"CheckColor")
-        {
-            m_checkColorCached = getSharedRenderer()->getCheckColor();
-        }
-        else if (property == U"CheckColorHover")
-        {
-            m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
-        }
-        else if (property == U"CheckColorDisabled")
-        {
-            m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"BorderColorDisabled")
-        {
-            m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
-        }
-        else if (property == U"BorderColorFocused")
-        {
-            m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
-        }
-        else if (property == U"BorderColorChecked")
-        {
-            m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
-        }
-        else if (property == U"BorderColorCheckedHover")
-        {
-            m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
-        }
-        else if (property == U"BorderColorCheckedDisabled")
-        {
-            m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
-        }
-        else if (property == U"BorderColorCheckedFocused")
-        {
-            m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"BackgroundColorChecked")
-        {
-            m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
-        }
-        else if (property == U"BackgroundColorCheckedHover")
-        {
-            m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
-        }
-        else if (property == U"BackgroundColorCheckedDisabled")
-        {
-            m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
-        }
-        else if (property == U"TextDistanceRatio")
-        {
-            m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteUnchecked.setOpacity(m_opacityCached);
-            m_spriteChecked.setOpacity(m_opacityCached);
-            m_spriteUncheckedHover.setOpacity(m_opacityCached);
-            m_spriteCheckedHover.setOpacity(m_opacityCached);
-            m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteCheckedDisabled.setOpacity(m_opacityCached);
-            m_spriteUncheckedFocused.setOpacity(m_opacityCached);
-            m_spriteCheckedFocused.setOpacity(m_opacityCached);
-
-            m_text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+                if (m_checked && m_textStyleCheckedCached.isSet())
+                    m_text.setStyle(m_textStyleCheckedCached);
+                else
+                    m_text.setStyle(m_textStyleCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureUnchecked").getValue():
+                m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
+                updateTextureSizes();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureChecked").getValue():
+                m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
+                updateTextureSizes();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureUncheckedHover").getValue():
+                m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureCheckedHover").getValue():
+                m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureUncheckedDisabled").getValue():
+                m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureCheckedDisabled").getValue():
+                m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureUncheckedFocused").getValue():
+                m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureCheckedFocused").getValue():
+                m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CheckColor").getValue():
+                m_checkColorCached = getSharedRenderer()->getCheckColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CheckColorHover").getValue():
+                m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CheckColorDisabled").getValue():
+                m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorHover").getValue():
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorDisabled").getValue():
+                m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorFocused").getValue():
+                m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorChecked").getValue():
+                m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorCheckedHover").getValue():
+                m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorCheckedDisabled").getValue():
+                m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorCheckedFocused").getValue():
+                m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDisabled").getValue():
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorChecked").getValue():
+                m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorCheckedHover").getValue():
+                m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorCheckedDisabled").getValue():
+                m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextDistanceRatio").getValue():
+                m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteUnchecked.setOpacity(m_opacityCached);
+                m_spriteChecked.setOpacity(m_opacityCached);
+                m_spriteUncheckedHover.setOpacity(m_opacityCached);
+                m_spriteCheckedHover.setOpacity(m_opacityCached);
+                m_spriteUncheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteCheckedDisabled.setOpacity(m_opacityCached);
+                m_spriteUncheckedFocused.setOpacity(m_opacityCached);
+                m_spriteCheckedFocused.setOpacity(m_opacityCached);
 
-            m_text.setFont(m_fontCached);
-            updateTextSize();
+                m_text.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                m_text.setFont(m_fontCached);
+                updateTextSize();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
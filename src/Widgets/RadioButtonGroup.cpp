@@ -67,6 +67,8 @@ namespace tgui
             if (widget->getWidgetType() == U"RadioButton")
                 std::static_pointer_cast<RadioButton>(widget)->setChecked(false);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
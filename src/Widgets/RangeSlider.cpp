@@ -241,6 +241,7 @@ namespace tgui
             setSelectionStart(m_selectionStart);
 
         updateThumbPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +271,7 @@ namespace tgui
             setSelectionEnd(m_selectionEnd);
 
         updateThumbPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,6 +307,8 @@ namespace tgui
 
             updateThumbPositions();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,6 +344,8 @@ namespace tgui
 
             updateThumbPositions();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,6 +364,7 @@ namespace tgui
         // Reset the values in case it does not match the step
         setSelectionStart(m_selectionStart);
         setSelectionEnd(m_selectionEnd);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -524,91 +531,97 @@ namespace tgui
 
     void RangeSlider::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"TextureTrack")
-        {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_imageOrientation = Orientation::Vertical;
-            else
-                m_imageOrientation = Orientation::Horizontal;
+            case TGUI_RENDERER_PROPERTY_ID("TextureTrack").getValue():
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            setSize(m_size);
-        }
-        else if (property == U"TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == U"TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == U"TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-            setSize(m_size);
-        }
-        else if (property == U"TextureSelectedTrack")
-        {
-            m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
-            setSize(m_size);
-        }
-        else if (property == U"TextureSelectedTrackHover")
-        {
-            m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
-            setSize(m_size);
-        }
-        else if (property == U"TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == U"TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == U"SelectedTrackColor")
-        {
-            m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
-        }
-        else if (property == U"SelectedTrackColorHover")
-        {
-            m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTrack.setOpacity(m_opacityCached);
-            m_spriteSelectedTrackHover.setOpacity(m_opacityCached);
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_imageOrientation = Orientation::Vertical;
+                else
+                    m_imageOrientation = Orientation::Horizontal;
+
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureTrackHover").getValue():
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureThumb").getValue():
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureThumbHover").getValue():
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureSelectedTrack").getValue():
+                m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureSelectedTrackHover").getValue():
+                m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TrackColor").getValue():
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TrackColorHover").getValue():
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTrackColor").getValue():
+                m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTrackColorHover").getValue():
+                m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColor").getValue():
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColorHover").getValue():
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorHover").getValue():
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTrack.setOpacity(m_opacityCached);
+                m_spriteSelectedTrackHover.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/RichTextLabel.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
@@ -46,6 +47,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    static bool areBlueprintLinesEqual(const std::vector<std::vector<Text::Blueprint>>& left, const std::vector<std::vector<Text::Blueprint>>& right)
+    {
+        if (left.size() != right.size())
+            return false;
+
+        for (std::size_t i = 0; i < left.size(); ++i)
+        {
+            if (left[i].size() != right[i].size())
+                return false;
+
+            for (std::size_t j = 0; j < left[i].size(); ++j)
+            {
+                const auto& leftPiece = left[i][j];
+                const auto& rightPiece = right[i][j];
+                if ((leftPiece.characterSize != rightPiece.characterSize) || (leftPiece.style != rightPiece.style) || (leftPiece.color != rightPiece.color)
+                 || (leftPiece.gapSize != rightPiece.gapSize) || (leftPiece.text != rightPiece.text))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     RichTextLabel::RichTextLabel(const char* typeName, bool initRenderer) :
         Label{typeName, initRenderer}
     {
@@ -77,13 +103,18 @@ namespace tgui
 
     void RichTextLabel::rendererChanged(const String& property)
     {
-        if (property == U"TextColor")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            rearrangeText();
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                rearrangeText();
+                break;
+
+            default:
+                Label::rendererChanged(property);
+                break;
         }
-        else
-            Label::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,10 +175,7 @@ namespace tgui
         m_images.clear();
 
         // Fit the text in the available space
-        Optional<std::vector<std::vector<Text::Blueprint>>> wordWrappedLines = (maxWidth > 0)
-            ? Text::wordWrap(maxWidth, textPiecesLines, m_fontCached)
-            : Optional<std::vector<std::vector<Text::Blueprint>>>();
-        auto* textPiecesLinesPtr = wordWrappedLines.has_value() ? &wordWrappedLines.value() : &textPiecesLines;
+        const auto* textPiecesLinesPtr = (maxWidth > 0) ? &getWordWrappedLines(maxWidth, textPiecesLines) : &textPiecesLines;
 
         const float defaultLineSpacing = m_fontCached.getLineSpacing(m_textSizeCached);
         float requiredTextHeight = calculateTextHeight(*textPiecesLinesPtr, defaultLineSpacing);
@@ -161,8 +189,7 @@ namespace tgui
                 if (maxWidth <= 0)
                     return;
 
-                wordWrappedLines = Text::wordWrap(maxWidth, textPiecesLines, m_fontCached);
-                textPiecesLinesPtr = &wordWrappedLines.value();
+                textPiecesLinesPtr = &getWordWrappedLines(maxWidth, textPiecesLines);
 
                 requiredTextHeight = calculateTextHeight(*textPiecesLinesPtr, defaultLineSpacing);
             }
@@ -392,6 +419,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::vector<std::vector<Text::Blueprint>>& RichTextLabel::getWordWrappedLines(float maxWidth, const std::vector<std::vector<Text::Blueprint>>& textPiecesLines)
+    {
+        const float fontScale = m_fontCached ? m_fontCached.getBackendFont()->getFontScale() : 1;
+        if ((m_blueprintWordWrapCache.font != m_fontCached) || (m_blueprintWordWrapCache.fontScale != fontScale)
+         || !areBlueprintLinesEqual(m_blueprintWordWrapCache.lines, textPiecesLines))
+        {
+            m_blueprintWordWrapCache.font = m_fontCached;
+            m_blueprintWordWrapCache.fontScale = fontScale;
+            m_blueprintWordWrapCache.lines = textPiecesLines;
+            m_blueprintWordWrapCache.wrappedLines.clear();
+        }
+
+        for (const auto& wrappedLines : m_blueprintWordWrapCache.wrappedLines)
+        {
+            if (wrappedLines.first == maxWidth)
+                return wrappedLines.second;
+        }
+
+        // Only the two most recent results are kept, as a label with a scrollbar may word-wrap its text for two widths
+        if (m_blueprintWordWrapCache.wrappedLines.size() >= 2)
+            m_blueprintWordWrapCache.wrappedLines.erase(m_blueprintWordWrapCache.wrappedLines.begin());
+
+        m_blueprintWordWrapCache.wrappedLines.emplace_back(maxWidth, Text::wordWrap(maxWidth, textPiecesLines, m_fontCached));
+        return m_blueprintWordWrapCache.wrappedLines.back().second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RichTextLabel::constructRichLineBlueprints(std::vector<std::vector<Text::Blueprint>>& textPiecesLines, std::vector<Texture>& images)
     {
         TGUI_ASSERT(textPiecesLines.empty() && images.empty(), "RichTextLabel::constructRichLineBlueprints must be called with empty vectors")
@@ -306,6 +306,7 @@ namespace tgui
         }
 
         updateScrollbars();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -706,36 +707,44 @@ namespace tgui
 
     void ScrollablePanel::rendererChanged(const String& property)
     {
-        if (property == U"Scrollbar")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setWidth(width);
+                    m_horizontalScrollbar->setHeight(width);
+                    updateScrollbars();
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setWidth(width);
                 m_horizontalScrollbar->setHeight(width);
                 updateScrollbars();
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setWidth(width);
-            m_horizontalScrollbar->setHeight(width);
-            updateScrollbars();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                break;
+
+            default:
+                Panel::rendererChanged(property);
+                break;
         }
-        else
-            Panel::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -119,6 +119,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +148,8 @@ namespace tgui
             // Recalculate the size and position of the thumb image
             updateSize();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +174,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,6 +199,7 @@ namespace tgui
     void Scrollbar::setScrollAmount(unsigned int scrollAmount)
     {
         m_scrollAmount = std::max(1u, scrollAmount);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +245,8 @@ namespace tgui
 
             rightMouseButtonNoLongerDown();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -275,6 +282,7 @@ namespace tgui
 
         m_orientation = orientation;
         setSize(getSize().y, getSize().x);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -290,6 +298,7 @@ namespace tgui
     {
         m_orientationLocked = true;
         m_orientation = orientation;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -884,99 +893,105 @@ namespace tgui
 
     void Scrollbar::rendererChanged(const String& property)
     {
-        if (property == U"TextureTrack")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
-            if (m_sizeSet)
-                updateSize();
-            else
-            {
-                if (m_orientation == Orientation::Vertical)
-                    setSize({getDefaultWidth(), getSize().y});
+            case TGUI_RENDERER_PROPERTY_ID("TextureTrack").getValue():
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+                if (m_sizeSet)
+                    updateSize();
                 else
-                    setSize({getSize().x, getDefaultWidth()});
+                {
+                    if (m_orientation == Orientation::Vertical)
+                        setSize({getDefaultWidth(), getSize().y});
+                    else
+                        setSize({getSize().x, getDefaultWidth()});
 
-                m_sizeSet = false;
-            }
-        }
-        else if (property == U"TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == U"TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            updateSize();
-        }
-        else if (property == U"TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == U"TextureArrowUp")
-        {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
-            updateSize();
-        }
-        else if (property == U"TextureArrowUpHover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == U"TextureArrowDown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-            updateSize();
-        }
-        else if (property == U"TextureArrowDownHover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == U"TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == U"TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == U"ArrowBackgroundColor")
-        {
-            m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
-        }
-        else if (property == U"ArrowBackgroundColorHover")
-        {
-            m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
-        }
-        else if (property == U"ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == U"ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                    m_sizeSet = false;
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureTrackHover").getValue():
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureThumb").getValue():
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                updateSize();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureThumbHover").getValue():
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowUp").getValue():
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                updateSize();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowUpHover").getValue():
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowDown").getValue():
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                updateSize();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowDownHover").getValue():
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TrackColor").getValue():
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TrackColorHover").getValue():
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColor").getValue():
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColorHover").getValue():
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowBackgroundColor").getValue():
+                m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowBackgroundColorHover").getValue():
+                m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColor").getValue():
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColorHover").getValue():
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -88,10 +88,17 @@ namespace tgui
 
     void SeparatorLine::rendererChanged(const String& property)
     {
-        if (property == U"Color")
-            m_colorCached = getSharedRenderer()->getColor();
-        else
-            Widget::rendererChanged(property);
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
+        {
+            case TGUI_RENDERER_PROPERTY_ID("Color").getValue():
+                m_colorCached = getSharedRenderer()->getColor();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +240,7 @@ namespace tgui
             setValue(m_minimum);
 
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +266,7 @@ namespace tgui
             setValue(m_maximum);
 
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -296,6 +298,8 @@ namespace tgui
 
             updateThumbPosition();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -313,6 +317,7 @@ namespace tgui
 
         // Reset the value in case it does not match the step
         setValue(m_value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -333,6 +338,7 @@ namespace tgui
 
         m_orientation = orientation;
         setSize(getSize().y, getSize().x);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -348,6 +354,7 @@ namespace tgui
     {
         m_orientationLocked = true;
         m_orientation = orientation;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +370,7 @@ namespace tgui
     {
         m_invertedDirection = invertedDirection;
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,75 +568,81 @@ namespace tgui
 
     void Slider::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"TextureTrack")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
 
-            if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
-                m_imageOrientation = Orientation::Vertical;
-            else
-                m_imageOrientation = Orientation::Horizontal;
+            case TGUI_RENDERER_PROPERTY_ID("TextureTrack").getValue():
+                m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
-            setSize(m_size);
-        }
-        else if (property == U"TextureTrackHover")
-        {
-            m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
-        }
-        else if (property == U"TextureThumb")
-        {
-            m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
-        }
-        else if (property == U"TextureThumbHover")
-        {
-            m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
-        }
-        else if (property == U"TrackColor")
-        {
-            m_trackColorCached = getSharedRenderer()->getTrackColor();
-        }
-        else if (property == U"TrackColorHover")
-        {
-            m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
-        }
-        else if (property == U"ThumbColor")
-        {
-            m_thumbColorCached = getSharedRenderer()->getThumbColor();
-        }
-        else if (property == U"ThumbColorHover")
-        {
-            m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"ThumbWithinTrack")
-        {
-            m_thumbWithinTrackCached = getSharedRenderer()->getThumbWithinTrack();
-            updateThumbPosition();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+                if (m_spriteTrack.getTexture().getImageSize().x < m_spriteTrack.getTexture().getImageSize().y)
+                    m_imageOrientation = Orientation::Vertical;
+                else
+                    m_imageOrientation = Orientation::Horizontal;
+
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureTrackHover").getValue():
+                m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureThumb").getValue():
+                m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureThumbHover").getValue():
+                m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TrackColor").getValue():
+                m_trackColorCached = getSharedRenderer()->getTrackColor();
+                break;
 
-            m_spriteTrack.setOpacity(m_opacityCached);
-            m_spriteTrackHover.setOpacity(m_opacityCached);
-            m_spriteThumb.setOpacity(m_opacityCached);
-            m_spriteThumbHover.setOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("TrackColorHover").getValue():
+                m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColor").getValue():
+                m_thumbColorCached = getSharedRenderer()->getThumbColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbColorHover").getValue():
+                m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorHover").getValue():
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ThumbWithinTrack").getValue():
+                m_thumbWithinTrackCached = getSharedRenderer()->getThumbWithinTrack();
+                updateThumbPosition();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteTrack.setOpacity(m_opacityCached);
+                m_spriteTrackHover.setOpacity(m_opacityCached);
+                m_spriteThumb.setOpacity(m_opacityCached);
+                m_spriteThumbHover.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
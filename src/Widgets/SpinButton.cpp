@@ -145,6 +145,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_value < m_minimum)
             setValue(m_minimum);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +169,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_value > m_maximum)
             setValue(m_maximum);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,6 +199,8 @@ namespace tgui
             m_value = value;
             onValueChange.emit(this, value);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -209,6 +215,7 @@ namespace tgui
     void SpinButton::setStep(float step)
     {
         m_step = step;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,6 +251,7 @@ namespace tgui
     {
         m_orientationLocked = true;
         m_orientation = orientation;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -339,63 +347,69 @@ namespace tgui
 
     void SpinButton::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"BorderBetweenArrows")
-        {
-            m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
-            setSize(m_size);
-        }
-        else if (property == U"TextureArrowUp")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderBetweenArrows").getValue():
+                m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowUp").getValue():
+                m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowUpHover").getValue():
+                m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowDown").getValue():
+                m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureArrowDownHover").getValue():
+                m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColor").getValue():
+                m_arrowColorCached = getSharedRenderer()->getArrowColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ArrowColorHover").getValue():
+                m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteArrowUp.setOpacity(m_opacityCached);
+                m_spriteArrowUpHover.setOpacity(m_opacityCached);
+                m_spriteArrowDown.setOpacity(m_opacityCached);
+                m_spriteArrowDownHover.setOpacity(m_opacityCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else if (property == U"TextureArrowUpHover")
-        {
-            m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
-        }
-        else if (property == U"TextureArrowDown")
-        {
-            m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
-        }
-        else if (property == U"TextureArrowDownHover")
-        {
-            m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"ArrowColor")
-        {
-            m_arrowColorCached = getSharedRenderer()->getArrowColor();
-        }
-        else if (property == U"ArrowColorHover")
-        {
-            m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
-
-            m_spriteArrowUp.setOpacity(m_opacityCached);
-            m_spriteArrowUpHover.setOpacity(m_opacityCached);
-            m_spriteArrowDown.setOpacity(m_opacityCached);
-            m_spriteArrowDownHover.setOpacity(m_opacityCached);
-        }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
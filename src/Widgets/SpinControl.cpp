@@ -208,6 +208,7 @@ namespace tgui
     void SpinControl::setMinimum(float minimum)
     {
         m_spinButton->setMinimum(minimum);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,6 +223,7 @@ namespace tgui
     void SpinControl::setMaximum(float maximum)
     {
         m_spinButton->setMaximum(maximum);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,6 +241,7 @@ namespace tgui
         {
             m_spinButton->setValue(value);
             setString(String::fromNumberRounded(value, m_decimalPlaces));
+            invalidate();
             return true;
         }
         return false;
@@ -256,6 +259,7 @@ namespace tgui
     void SpinControl::setStep(float step)
     {
         m_spinButton->setStep(step);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +275,7 @@ namespace tgui
     {
         m_decimalPlaces = decimalPlaces;
         setString(String::fromNumberRounded(getValue(), m_decimalPlaces));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,6 +309,7 @@ namespace tgui
     {
         m_spinButtonWidth = width;
         setSize(m_size);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +123,7 @@ namespace tgui
     {
         m_orientation = orientation;
         updateAvailableSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -138,6 +139,7 @@ namespace tgui
     {
         m_splitterMinOffset = minOffset;
         updateAvailableSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +155,7 @@ namespace tgui
     {
         m_splitterMaxOffset = maxOffset;
         updateAvailableSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,6 +171,7 @@ namespace tgui
     {
         m_splitterOffset = offset;
         updateAvailableSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -183,6 +187,7 @@ namespace tgui
     {
         m_splitterWidth = width;
         updateChildren();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -197,6 +202,7 @@ namespace tgui
     void SplitContainer::setMinimumGrabWidth(float width)
     {
         m_minimumGrabWidth = width;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -336,16 +342,21 @@ namespace tgui
 
     void SplitContainer::rendererChanged(const String& property)
     {
-        if (property == U"SplitterColor")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_splitterColorCached = getSharedRenderer()->getSplitterColor();
-        }
-        else if (property == U"SplitterColorHover")
-        {
-            m_splitterColorHoverCached = getSharedRenderer()->getSplitterColorHover();
+            case TGUI_RENDERER_PROPERTY_ID("SplitterColor").getValue():
+                m_splitterColorCached = getSharedRenderer()->getSplitterColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SplitterColorHover").getValue():
+                m_splitterColorHoverCached = getSharedRenderer()->getSplitterColorHover();
+                break;
+
+            default:
+                Group::rendererChanged(property);
+                break;
         }
-        else
-            Group::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -187,6 +187,7 @@ namespace tgui
     {
         m_tabs->setHeight(height);
         setSize(getSizeLayout());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -207,6 +208,7 @@ namespace tgui
         else
             panel->setVisible(false);
 
+        invalidate();
         return panel;
     }
 
@@ -233,6 +235,7 @@ namespace tgui
         else
             panel->setVisible(false);
 
+        invalidate();
         return panel;
     }
 
@@ -273,6 +276,7 @@ namespace tgui
                 m_selectedPanel = nullptr;
         }
 
+        invalidate();
         return true;
     }
 
@@ -297,6 +301,7 @@ namespace tgui
         m_tabs->select(index);
 
         onSelectionChange.emit(this, static_cast<int>(index));
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -395,6 +400,8 @@ namespace tgui
 
         for (const auto& panel : m_panels)
             layoutPanel(panel);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -414,6 +421,7 @@ namespace tgui
         m_tabFixedSize = fixedSize;
 
         layoutTabs();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +435,7 @@ namespace tgui
 
     bool TabContainer::changeTabText(std::size_t index, const String& text)
     {
+        invalidate();
         return m_tabs->changeText(index, text);
     }
 
@@ -119,6 +119,8 @@ namespace tgui
             m_autoSize = autoSize;
             recalculateTabsWidth();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +172,8 @@ namespace tgui
         // If the tab has to be selected then do so
         if (selectTab)
             select(index);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +195,7 @@ namespace tgui
 
         m_tabs[index].text.setString(text);
         recalculateTabsWidth();
+        invalidate();
         return true;
     }
 
@@ -230,6 +235,7 @@ namespace tgui
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
+        invalidate();
         return true;
     }
 
@@ -242,6 +248,8 @@ namespace tgui
             m_selectedTab = -1;
             updateTextColors();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -277,6 +285,7 @@ namespace tgui
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
         recalculateTabsWidth();
+        invalidate();
         return true;
     }
 
@@ -289,6 +298,7 @@ namespace tgui
         m_hoveringTab = -1;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,6 +334,7 @@ namespace tgui
 
         m_tabs[index].visible = visible;
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -345,6 +356,7 @@ namespace tgui
 
         m_tabs[index].enabled = enabled;
         updateTextColors();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,6 +392,8 @@ namespace tgui
         // Recalculate the size when the text is auto sizing
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             updateTextSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -389,6 +403,7 @@ namespace tgui
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,6 +420,7 @@ namespace tgui
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -563,125 +579,131 @@ namespace tgui
 
     void Tabs::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            recalculateTabsWidth();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors();
-        }
-        else if (property == U"TextColorDisabled")
-        {
-            m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
-            updateTextColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors();
-        }
-        else if (property == U"TextureTab")
-        {
-            m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
-        }
-        else if (property == U"TextureTabHover")
-        {
-            m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
-        }
-        else if (property == U"TextureSelectedTab")
-        {
-            m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
-        }
-        else if (property == U"TextureSelectedTabHover")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
-        }
-        else if (property == U"TextureDisabledTab")
-        {
-            m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
-        }
-        else if (property == U"DistanceToSide")
-        {
-            m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
-            recalculateTabsWidth();
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"BackgroundColorDisabled")
-        {
-            m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
-        {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"BorderColorHover")
-        {
-            m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
-        }
-        else if (property == U"SelectedBorderColor")
-        {
-            m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
-        }
-        else if (property == U"SelectedBorderColorHover")
-        {
-            m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                recalculateTabsWidth();
+                break;
 
-            m_spriteTab.setOpacity(m_opacityCached);
-            m_spriteTabHover.setOpacity(m_opacityCached);
-            m_spriteSelectedTab.setOpacity(m_opacityCached);
-            m_spriteSelectedTabHover.setOpacity(m_opacityCached);
-            m_spriteDisabledTab.setOpacity(m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors();
+                break;
 
-            for (auto& tab : m_tabs)
-                tab.text.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("TextColorHover").getValue():
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors();
+                break;
 
-            for (auto& tab : m_tabs)
-                tab.text.setFont(m_fontCached);
+            case TGUI_RENDERER_PROPERTY_ID("TextColorDisabled").getValue():
+                m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
+                updateTextColors();
+                break;
 
-            // Recalculate the size when the text is auto sizing
-            if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-                updateTextSize();
-            else
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColorHover").getValue():
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureTab").getValue():
+                m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureTabHover").getValue():
+                m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureSelectedTab").getValue():
+                m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureSelectedTabHover").getValue():
+                m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureDisabledTab").getValue():
+                m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("DistanceToSide").getValue():
+                m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
                 recalculateTabsWidth();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorDisabled").getValue():
+                m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColor").getValue():
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColorHover").getValue():
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColorHover").getValue():
+                m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBorderColor").getValue():
+                m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBorderColorHover").getValue():
+                m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_spriteTab.setOpacity(m_opacityCached);
+                m_spriteTabHover.setOpacity(m_opacityCached);
+                m_spriteSelectedTab.setOpacity(m_opacityCached);
+                m_spriteSelectedTabHover.setOpacity(m_opacityCached);
+                m_spriteDisabledTab.setOpacity(m_opacityCached);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                for (auto& tab : m_tabs)
+                    tab.text.setFont(m_fontCached);
+
+                // Recalculate the size when the text is auto sizing
+                if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
+                    updateTextSize();
+                else
+                    recalculateTabsWidth();
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <iterator>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,6 +41,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Replaces count elements starting at index by the new elements, without moving the elements behind them when the amount stays the same
+        template <typename T>
+        void replaceElements(std::vector<T>& elements, std::size_t index, std::size_t count, std::vector<T>&& newElements)
+        {
+            const std::size_t commonCount = std::min(count, newElements.size());
+            std::move(newElements.begin(), newElements.begin() + static_cast<std::ptrdiff_t>(commonCount), elements.begin() + static_cast<std::ptrdiff_t>(index));
+
+            if (newElements.size() > count)
+            {
+                elements.insert(elements.begin() + static_cast<std::ptrdiff_t>(index + count),
+                                std::make_move_iterator(newElements.begin() + static_cast<std::ptrdiff_t>(commonCount)),
+                                std::make_move_iterator(newElements.end()));
+            }
+            else if (count > newElements.size())
+            {
+                elements.erase(elements.begin() + static_cast<std::ptrdiff_t>(index + commonCount),
+                               elements.begin() + static_cast<std::ptrdiff_t>(index + count));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TextArea::TextArea(const char* typeName, bool initRenderer) :
         Widget{typeName, false}
     {
@@ -141,6 +167,7 @@ namespace tgui
         rearrangeText(false);
 
         onTextChange.emit(this, m_text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +189,7 @@ namespace tgui
     void TextArea::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,6 +209,7 @@ namespace tgui
         if (oldSelEnd != m_selEnd)
             onCaretPositionChange.emit(this);                    // Emit onCaretPositionChange now.
         updateSelectionTexts();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +271,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::scrollbarValueChanged(Orientation orientation)
+    {
+        // Only the visible lines are stored in the text objects, so they have to be updated when scrolling vertically
+        if (orientation == Orientation::Vertical)
+            recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::setMaximumCharacters(std::size_t maxChars)
     {
         // Set the new character limit ( 0 to disable the limit )
@@ -254,6 +292,8 @@ namespace tgui
             m_text.erase(m_maxChars, String::npos);
             rearrangeText(false);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +309,7 @@ namespace tgui
     {
         // Do not allow evil cartridge returns.
         m_tabText = tabText.replace('\r', U"");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -311,6 +352,8 @@ namespace tgui
     void TextArea::setCaretPosition(std::size_t charactersBeforeCaret)
     {
         setCaretPositionImpl(charactersBeforeCaret, true, true); // Update m_selEnd and emit onCaretPositionChange.
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -350,6 +393,7 @@ namespace tgui
     void TextArea::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,14 +465,21 @@ namespace tgui
 
     void TextArea::enableMonospacedFontOptimization(bool enable)
     {
+        if (m_monospacedFontOptimizationEnabled == enable)
+            return;
+
         m_monospacedFontOptimizationEnabled = enable;
+
+        // The widths of the lines weren't being calculated while the optimization was enabled
+        if (!enable && (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never))
+            rearrangeText(true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
-        m_verticalScrollbar->setValue(value);
+        m_verticalScrollbarAccessor.setValue(value);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -813,7 +864,7 @@ namespace tgui
             }
 
             // Do not emit onCaretPositionChanged signal yet, as it could be invalid.
-            rearrangeText(true, false);
+            rearrangeChangedText(caretPosition, 0, 1, false);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -925,9 +976,9 @@ namespace tgui
             //    return Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextArea strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == U'\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = m_fontCached.getAdvance(' ', getTextSize(), false) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = m_fontCached.getAdvance(curChar, getTextSize(), false);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize(), false);
             if (width + charWidth + kerning <= position.x)
@@ -986,7 +1037,7 @@ namespace tgui
                 m_selStart = m_selEnd;
             }
 
-            rearrangeText(true);
+            rearrangeChangedText(std::min(selStart, selEnd), std::max(selStart, selEnd) - std::min(selStart, selEnd), 0);
         }
     }
 
@@ -1006,12 +1057,13 @@ namespace tgui
             return;
 
         // Insert string.
-        m_text.insert(getSelectionEnd(), text);
+        const std::size_t caretPosition = getSelectionEnd();
+        m_text.insert(caretPosition, text);
         m_lines[m_selEnd.y].insert(m_selEnd.x, text);
 
         m_selEnd.x += text.length();
         m_selStart = m_selEnd;
-        rearrangeText(true, false);
+        rearrangeChangedText(caretPosition, 0, text.length(), false);
         onCaretPositionChange.emit(this);
 
         onTextChange.emit(this, m_text);
@@ -1260,7 +1312,7 @@ namespace tgui
                 m_text.erase(pos - 1, 1);
                 // If the "special case" above passes, and we let rearrangeText() emit the onCaretPositionChange signal,
                 // the same signal will be emitted twice. So prevent sending signal in rearrangeText() and always send it manually afterwards.
-                rearrangeText(true, false);
+                rearrangeChangedText(pos - 1, 1, 0, false);
                 onCaretPositionChange.emit(this);
             }
         }
@@ -1284,8 +1336,10 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
-            m_text.erase(getSelectionEnd(), 1);
-            rearrangeText(true);
+            const std::size_t caretPosition = getSelectionEnd();
+            const std::size_t removedChars = (caretPosition < m_text.length()) ? 1 : 0;
+            m_text.erase(caretPosition, removedChars);
+            rearrangeChangedText(caretPosition, removedChars, 0);
         }
         else // You did select some characters, so remove them
             deleteSelectedCharacters();
@@ -1352,67 +1406,182 @@ namespace tgui
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        String string;
-        if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        // Store the current selection position when we are keeping the selection
+        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
+        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
+
+        // Word-wrap all paragraphs
+        if (!rewrapParagraphs(0, m_paragraphs.size(), 0, m_text.length()))
+            return;
+
+        updateRearrangedLines(keepSelection, selStart, selEnd, emitCaretChangedPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::rearrangeChangedText(std::size_t changeStart, std::size_t removedChars, std::size_t insertedChars, bool emitCaretChangedPosition)
+    {
+        // Don't continue when line height is 0 or when there is no font yet
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
+
+        // Rearrange the entire text if the cached paragraphs don't match the text from before the change
+        std::size_t oldTextLength = m_paragraphs.size() - 1;
+        for (const auto& paragraph : m_paragraphs)
+            oldTextLength += paragraph.length;
+
+        if (m_paragraphs.empty() || (oldTextLength + insertedChars != m_text.length() + removedChars))
+        {
+            rearrangeText(true, emitCaretChangedPosition);
+            return;
+        }
+
+        const std::size_t selStart = getSelectionStart();
+        const std::size_t selEnd = getSelectionEnd();
+
+        // Find the paragraphs that contained the changed characters. The newline at the end of a paragraph belongs to that paragraph,
+        // so removing it will cause the next paragraph to be included as well.
+        std::size_t firstParagraph = 0;
+        std::size_t charStart = 0;
+        while ((firstParagraph + 1 < m_paragraphs.size()) && (charStart + m_paragraphs[firstParagraph].length < changeStart))
+        {
+            charStart += m_paragraphs[firstParagraph].length + 1;
+            ++firstParagraph;
+        }
+
+        std::size_t lastParagraph = firstParagraph;
+        std::size_t oldCharEnd = charStart + m_paragraphs[firstParagraph].length;
+        while ((lastParagraph + 1 < m_paragraphs.size()) && (oldCharEnd < changeStart + removedChars))
+        {
+            ++lastParagraph;
+            oldCharEnd += m_paragraphs[lastParagraph].length + 1;
+        }
+
+        // Only word-wrap the paragraphs that were changed
+        if (!rewrapParagraphs(firstParagraph, lastParagraph - firstParagraph + 1, charStart, oldCharEnd + insertedChars - removedChars))
+            return;
+
+        updateRearrangedLines(true, selStart, selEnd, emitCaretChangedPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextArea::rewrapParagraphs(std::size_t firstParagraph, std::size_t oldParagraphCount, std::size_t charStart, std::size_t charEnd)
+    {
+        const bool wordWrapEnabled = (m_horizontalScrollbar->getPolicy() == Scrollbar::Policy::Never);
+
+        float maxLineWidth = 0;
+        if (wordWrapEnabled)
         {
             // Find the maximum width of one line
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
             if (m_verticalScrollbar->isShown())
                 maxLineWidth -= m_verticalScrollbar->getSize().x;
 
-            // Don't do anything when there is no room for the text
+            // Don't do anything when there is no room for the text. The paragraphs will all be rebuilt once there is room again.
             if (maxLineWidth <= 0)
-                return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
+            {
+                m_paragraphs.clear();
+                return false;
+            }
         }
 
-        // Store the current selection position when we are keeping the selection
-        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
-        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
+        // Find the lines that were created for the paragraphs that are being replaced
+        std::size_t firstLine = 0;
+        for (std::size_t i = 0; i < firstParagraph; ++i)
+            firstLine += m_paragraphs[i].lineCount;
 
-        // Split the string in multiple lines
-        m_maxLineWidth = 0;
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != String::npos)
+        std::size_t oldLineCount = 0;
+        if (firstParagraph + oldParagraphCount < m_paragraphs.size())
         {
-            newLinePos = string.find('\n', searchPosStart);
+            for (std::size_t i = firstParagraph; i < firstParagraph + oldParagraphCount; ++i)
+                oldLineCount += m_paragraphs[i].lineCount;
+        }
+        else
+            oldLineCount = m_lines.size() - firstLine;
 
-            if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substr(searchPosStart));
+        // Split the text in paragraphs and word-wrap each of them separately.
+        // Word-wrapping restarts after every newline, so this gives the same result as wrapping the text as a whole.
+        std::vector<Paragraph> newParagraphs;
+        std::vector<String> newLines;
+        std::size_t paragraphStart = charStart;
+        while (true)
+        {
+            std::size_t paragraphEnd = m_text.find(U'\n', paragraphStart);
+            if ((paragraphEnd == String::npos) || (paragraphEnd > charEnd))
+                paragraphEnd = charEnd;
+
+            Paragraph paragraph;
+            paragraph.length = paragraphEnd - paragraphStart;
 
-            if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
+            String paragraphText = m_text.substr(paragraphStart, paragraph.length);
+            if (wordWrapEnabled)
             {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
+                const String wrappedText = Text::wordWrap(maxLineWidth, paragraphText, m_fontCached, m_textSizeCached, false);
+
+                std::size_t searchPosStart = 0;
+                std::size_t newLinePos = 0;
+                while (newLinePos != String::npos)
                 {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
+                    newLinePos = wrappedText.find(U'\n', searchPosStart);
+                    if (newLinePos != String::npos)
+                        newLines.push_back(wrappedText.substr(searchPosStart, newLinePos - searchPosStart));
+                    else
+                        newLines.push_back(wrappedText.substr(searchPosStart));
+
+                    ++paragraph.lineCount;
+                    searchPosStart = newLinePos + 1;
                 }
             }
+            else // Every paragraph is a single line, of which we need to know the width for the horizontal scrollbar
+            {
+                if (!m_monospacedFontOptimizationEnabled)
+                    paragraph.width = Text::getLineWidth(paragraphText, m_fontCached, m_textSizeCached);
+
+                newLines.push_back(std::move(paragraphText));
+                paragraph.lineCount = 1;
+            }
 
-            searchPosStart = newLinePos + 1;
+            newParagraphs.push_back(paragraph);
+
+            if (paragraphEnd == charEnd)
+                break;
+
+            paragraphStart = paragraphEnd + 1;
         }
 
-        if ((m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+        replaceElements(m_paragraphs, firstParagraph, oldParagraphCount, std::move(newParagraphs));
+        replaceElements(m_lines, firstLine, oldLineCount, std::move(newLines));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateRearrangedLines(bool keepSelection, std::size_t selStart, std::size_t selEnd, bool emitCaretChangedPosition)
+    {
+        // Find the width of the longest line, which is only needed when there is a horizontal scrollbar
+        m_maxLineWidth = 0;
+        if (m_horizontalScrollbar->getPolicy() != Scrollbar::Policy::Never)
+        {
+            if (m_monospacedFontOptimizationEnabled)
+            {
+                // Every paragraph is a single line, so only the width of the line with the most characters has to be calculated
+                std::size_t longestLineIndex = 0;
+                for (std::size_t i = 1; i < m_paragraphs.size(); ++i)
+                {
+                    if (m_paragraphs[i].length > m_paragraphs[longestLineIndex].length)
+                        longestLineIndex = i;
+                }
+
+                m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
+            }
+            else
+            {
+                for (const auto& paragraph : m_paragraphs)
+                    m_maxLineWidth = std::max(m_maxLineWidth, paragraph.width);
+            }
+        }
 
         // Check if we should try to keep our selection
         if (keepSelection)
@@ -1542,71 +1711,6 @@ namespace tgui
 
     void TextArea::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (const auto& line : m_lines)
-                displayedText += line + U"\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString(U"");
-            m_textSelection2.setString(U"");
-            m_textAfterSelection1.setString(U"");
-            m_textAfterSelection2.setString(U"");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString(U"");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
-
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + U"\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbar->getPolicy() != Scrollbar::Policy::Never)
         {
@@ -1710,94 +1814,8 @@ namespace tgui
             return;
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
         m_defaultText.setPosition({textOffset, 0});
 
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(selectionEnd.y + 1) * m_lineHeight});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
-
-                if (!m_lines[selectionStart.y].empty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
-
-                    if (!m_lines[i].empty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y) * m_lineHeight,
-                                                      textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
-                    }
-                    else
-                        m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
-                }
-            }
-        }
-
         if (m_parentGui)
         {
             const Vector2f caretPosition = {m_caretPosition.x + m_bordersCached.getLeft() + m_paddingCached.getLeft() - static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -1842,6 +1860,143 @@ namespace tgui
 
         if (m_verticalScrollbar->isShown())
             m_verticalScrollbar->setPosition({getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop()});
+
+        updateVisibleTexts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateVisibleTexts()
+    {
+        m_selectionRects.clear();
+        if (m_lines.empty() || !m_fontCached)
+            return;
+
+        // Only the lines that are visible are placed inside the text objects.
+        // One extra line is included as the last line may only be partially visible.
+        const std::size_t firstLine = std::min(m_topLine, m_lines.size() - 1);
+        const std::size_t lastLine = std::min(m_topLine + m_visibleLines + 1, m_lines.size());
+
+        const auto joinLines = [this](std::size_t begin, std::size_t end)
+            {
+                String string;
+                for (std::size_t i = begin; i < end; ++i)
+                    string += m_lines[i] + U"\n";
+
+                return string;
+            };
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstLine) * m_lineHeight});
+
+        // If there is no selection then just put the whole visible text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            m_textBeforeSelection.setString(joinLines(firstLine, lastLine));
+            m_textSelection1.setString(U"");
+            m_textSelection2.setString(U"");
+            m_textAfterSelection1.setString(U"");
+            m_textAfterSelection2.setString(U"");
+            return;
+        }
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        const bool selectionStartVisible = (selectionStart.y >= firstLine) && (selectionStart.y < lastLine);
+        const bool selectionEndVisible = (selectionEnd.y >= firstLine) && (selectionEnd.y < lastLine);
+
+        /// TODO: Implement a way to calculate text size without creating a text object?
+        Text tempText;
+        tempText.setFont(m_fontCached);
+        tempText.setCharacterSize(getTextSize());
+        tempText.setStyle(m_textBeforeSelection.getStyle());
+        const auto getTextWidth = [&tempText](const String& text)
+            {
+                if (text.empty())
+                    return 0.f;
+
+                tempText.setString(text);
+                return tempText.findCharacterPos(text.length()).x;
+            };
+
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
+            kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
+
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
+            kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
+
+        // Set the text before the selection
+        if (selectionStart.y < firstLine)
+            m_textBeforeSelection.setString(U"");
+        else if (selectionStart.y >= lastLine)
+            m_textBeforeSelection.setString(joinLines(firstLine, lastLine));
+        else
+            m_textBeforeSelection.setString(joinLines(firstLine, selectionStart.y) + m_lines[selectionStart.y].substr(0, selectionStart.x));
+
+        // Set the selected text on the first line of the selection
+        String selection1;
+        if (selectionStart.y == selectionEnd.y)
+            selection1 = m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x);
+        else
+            selection1 = m_lines[selectionStart.y].substr(selectionStart.x);
+
+        float selection1Left = textOffset;
+        if (selectionStart.x > 0)
+            selection1Left += getTextWidth(m_lines[selectionStart.y].substr(0, selectionStart.x)) + kerningSelectionStart;
+
+        const float selection1Width = getTextWidth(selection1);
+        m_textSelection1.setString(selectionStartVisible ? selection1 : U"");
+        m_textSelection1.setPosition({selection1Left, static_cast<float>(selectionStart.y) * m_lineHeight});
+
+        // Set the selected text on the other lines
+        float afterSelection1Left = selection1Left + selection1Width + kerningSelectionEnd;
+        if (selectionStart.y != selectionEnd.y)
+        {
+            const std::size_t selection2FirstLine = std::max(selectionStart.y + 1, firstLine);
+            String selection2 = joinLines(selection2FirstLine, std::min(selectionEnd.y, lastLine));
+            if (selectionEndVisible)
+                selection2 += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
+
+            m_textSelection2.setString(selection2);
+            m_textSelection2.setPosition({textOffset, static_cast<float>(selection2FirstLine) * m_lineHeight});
+
+            afterSelection1Left = textOffset + getTextWidth(m_lines[selectionEnd.y].substr(0, selectionEnd.x)) + kerningSelectionEnd;
+        }
+        else
+            m_textSelection2.setString(U"");
+
+        // Set the text after the selection
+        m_textAfterSelection1.setString(selectionEndVisible ? m_lines[selectionEnd.y].substr(selectionEnd.x) : U"");
+        m_textAfterSelection1.setPosition({afterSelection1Left, static_cast<float>(selectionEnd.y) * m_lineHeight});
+
+        const std::size_t afterSelection2FirstLine = std::max(selectionEnd.y + 1, firstLine);
+        m_textAfterSelection2.setString(joinLines(afterSelection2FirstLine, lastLine));
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>(afterSelection2FirstLine) * m_lineHeight});
+
+        // Recalculate the selection rectangles of the visible lines
+        for (std::size_t i = std::max(selectionStart.y, firstLine); i < std::min(selectionEnd.y + 1, lastLine); ++i)
+        {
+            if (i == selectionStart.y)
+            {
+                m_selectionRects.emplace_back(selection1Left, static_cast<float>(i) * m_lineHeight, selection1Width, m_lineHeight);
+
+                // There is kerning when the selection is on just this line
+                if (selectionStart.y == selectionEnd.y)
+                    m_selectionRects.back().width += kerningSelectionEnd;
+                else
+                    m_selectionRects.back().width += textOffset;
+            }
+            else if (i < selectionEnd.y)
+                m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, 2 * textOffset + getTextWidth(m_lines[i]), m_lineHeight);
+            else // Last line of the selection
+                m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, afterSelection1Left, m_lineHeight);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1862,103 +2017,111 @@ namespace tgui
 
     void TextArea::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"TextColor")
-        {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
-        }
-        else if (property == U"SelectedTextColor")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
-        }
-        else if (property == U"DefaultTextColor")
-        {
-            m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
+                m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
+                m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("DefaultTextColor").getValue():
+                m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
+                    m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                    setSize(m_size);
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
-                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
+                m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
+                m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
                 setSize(m_size);
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
-            m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            setSize(m_size);
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedTextBackgroundColor")
-        {
-            m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"CaretColor")
-        {
-            m_caretColorCached = getSharedRenderer()->getCaretColor();
-        }
-        else if (property == U"CaretWidth")
-        {
-            m_caretWidthCached = getSharedRenderer()->getCaretWidth();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
-            m_defaultText.setOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextBackgroundColor").getValue():
+                m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("CaretColor").getValue():
+                m_caretColorCached = getSharedRenderer()->getCaretColor();
+                break;
 
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
-            m_defaultText.setFont(m_fontCached);
-            setTextSize(getTextSize());
+            case TGUI_RENDERER_PROPERTY_ID("CaretWidth").getValue():
+                m_caretWidthCached = getSharedRenderer()->getCaretWidth();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_textBeforeSelection.setOpacity(m_opacityCached);
+                m_textAfterSelection1.setOpacity(m_opacityCached);
+                m_textAfterSelection2.setOpacity(m_opacityCached);
+                m_textSelection1.setOpacity(m_opacityCached);
+                m_textSelection2.setOpacity(m_opacityCached);
+                m_defaultText.setOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+
+                m_textBeforeSelection.setFont(m_fontCached);
+                m_textSelection1.setFont(m_fontCached);
+                m_textSelection2.setFont(m_fontCached);
+                m_textAfterSelection1.setFont(m_fontCached);
+                m_textAfterSelection2.setFont(m_fontCached);
+                m_defaultText.setFont(m_fontCached);
+                setTextSize(getTextSize());
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +74,7 @@ namespace tgui
         updateState();
 
         onToggle.emit(this, m_down);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
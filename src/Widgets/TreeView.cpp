@@ -78,6 +78,7 @@ namespace tgui
             newNode->text = oldNode->text;
             newNode->depth = oldNode->depth;
             newNode->expanded = oldNode->expanded;
+            newNode->childrenPending = oldNode->childrenPending;
             newNode->parent = parent;
 
             for (const auto& oldChild : oldNode->nodes)
@@ -267,6 +268,7 @@ namespace tgui
         onExpand                            {other.onExpand},
         onCollapse                          {other.onCollapse},
         onRightClick                        {other.onRightClick},
+        m_childrenProvider                  {other.m_childrenProvider},
         m_selectedItem                      {other.m_selectedItem},
         m_hoveredItem                       {other.m_hoveredItem},
         m_itemHeight                        {other.m_itemHeight},
@@ -316,6 +318,7 @@ namespace tgui
             std::swap(onRightClick,                         temp.onRightClick);
             std::swap(m_nodes,                              temp.m_nodes);
             std::swap(m_visibleNodes,                       temp.m_visibleNodes);
+            std::swap(m_childrenProvider,                   temp.m_childrenProvider);
             std::swap(m_selectedItem,                       temp.m_selectedItem);
             std::swap(m_hoveredItem,                        temp.m_hoveredItem);
             std::swap(m_itemHeight,                         temp.m_itemHeight);
@@ -415,11 +418,46 @@ namespace tgui
             createNode(m_nodes, nullptr, hierarchy.back());
 
         markNodesDirty();
+        invalidate();
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TreeView::addLazyItem(const std::vector<String>& hierarchy, bool createParents)
+    {
+        if (hierarchy.empty())
+            return false;
+
+        std::vector<std::shared_ptr<Node>>* nodes = &m_nodes;
+        Node* parent = nullptr;
+        if (hierarchy.size() >= 2)
+        {
+            parent = findParentNode(hierarchy, 0, m_nodes, nullptr, createParents);
+            if (!parent)
+                return false;
+
+            nodes = &parent->nodes;
+        }
+
+        createNode(*nodes, parent, hierarchy.back());
+        nodes->back()->childrenPending = true;
+        nodes->back()->expanded = false;
+
+        markNodesDirty();
+        invalidate();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setChildrenProvider(const ChildrenProviderFunc& func)
+    {
+        m_childrenProvider = func;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TreeView::changeItem(const std::vector<String>& hierarchy, const String& leafText)
     {
         if (hierarchy.empty())
@@ -430,6 +468,7 @@ namespace tgui
             return false;
 
         node->text.setString(leafText);
+        invalidate();
         return true;
     }
 
@@ -438,6 +477,7 @@ namespace tgui
     void TreeView::expand(const std::vector<String>& hierarchy)
     {
         expandOrCollapse(hierarchy, true);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,6 +486,7 @@ namespace tgui
     {
         expandOrCollapseAll(m_nodes, true);
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -453,6 +494,7 @@ namespace tgui
     void TreeView::collapse(const std::vector<String>& hierarchy)
     {
         expandOrCollapse(hierarchy, false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -461,6 +503,7 @@ namespace tgui
     {
         expandOrCollapseAll(m_nodes, false);
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,6 +529,7 @@ namespace tgui
             if (m_visibleNodes[i].get() == node)
             {
                 updateSelectedItem(static_cast<int>(i));
+                invalidate();
                 return true;
             }
         }
@@ -498,6 +542,7 @@ namespace tgui
     void TreeView::deselectItem()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -506,6 +551,7 @@ namespace tgui
     {
         const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
         markNodesDirty();
+        invalidate();
         return ret;
     }
 
@@ -515,6 +561,7 @@ namespace tgui
     {
         m_nodes.clear();
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -602,6 +649,7 @@ namespace tgui
         parentNodes->erase(parentNodes->begin() + static_cast<std::ptrdiff_t>(currentIndex));
         parentNodes->insert(parentNodes->begin() + static_cast<std::ptrdiff_t>(index), node);
         markNodesDirty();
+        invalidate();
         return true;
     }
 
@@ -671,6 +719,7 @@ namespace tgui
         node->text.setString(newHierarchy.back());
         node->parent = newParentNode;
         markNodesDirty();
+        invalidate();
         return true;
     }
 
@@ -681,7 +730,7 @@ namespace tgui
         if (index >= m_visibleNodes.size())
             return;
 
-        if (m_visibleNodes[index]->nodes.empty())
+        if (m_visibleNodes[index]->nodes.empty() && !m_visibleNodes[index]->childrenPending)
             return;
 
         std::vector<String> hierarchy;
@@ -693,13 +742,111 @@ namespace tgui
             node = node->parent;
         }
 
-        m_visibleNodes[index]->expanded = !m_visibleNodes[index]->expanded;
-        if (m_visibleNodes[index]->expanded)
+        // The visible list is updated before emitting the signal, as the callback is allowed to change the tree
+        const bool expanded = !m_visibleNodes[index]->expanded;
+        m_visibleNodes[index]->expanded = expanded;
+        if (expanded)
+            loadPendingChildren(*m_visibleNodes[index]);
+
+        updateVisibleChildNodes(index);
+
+        if (expanded)
             onExpand.emit(this, hierarchy.back(), hierarchy);
         else
             onCollapse.emit(this, hierarchy.back(), hierarchy);
+    }
 
-        markNodesDirty();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::loadPendingChildren(Node& node)
+    {
+        if (!node.childrenPending)
+            return;
+
+        node.childrenPending = false;
+        if (!m_childrenProvider)
+            return;
+
+        std::vector<String> hierarchy;
+        const Node* parent = &node;
+        while (parent)
+        {
+            hierarchy.insert(hierarchy.begin(), parent->text.getString());
+            parent = parent->parent;
+        }
+
+        for (const auto& child : m_childrenProvider(hierarchy))
+        {
+            createNode(node.nodes, &node, child.text);
+            if (child.hasChildren)
+            {
+                node.nodes.back()->childrenPending = true;
+                node.nodes.back()->expanded = false;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateVisibleChildNodes(std::size_t index)
+    {
+        Node* const selectedNode = (m_selectedItem >= 0) ? m_visibleNodes[static_cast<std::size_t>(m_selectedItem)].get() : nullptr;
+        Node* const hoveredNode = (m_hoveredItem >= 0) ? m_visibleNodes[static_cast<std::size_t>(m_hoveredItem)].get() : nullptr;
+
+        // The previously visible descendants of the node are stored directly behind it in the list
+        const auto& node = *m_visibleNodes[index];
+        std::size_t removeEnd = index + 1;
+        while ((removeEnd < m_visibleNodes.size()) && (m_visibleNodes[removeEnd]->depth > node.depth))
+            ++removeEnd;
+
+        bool widestNodeRemoved = false;
+        for (std::size_t i = index + 1; i < removeEnd; ++i)
+        {
+            const Text& text = m_visibleNodes[i]->text;
+            if (text.getPosition().x + text.getSize().x + m_paddingCached.getRight() >= m_maxRight)
+                widestNodeRemoved = true;
+        }
+
+        std::vector<std::shared_ptr<Node>> insertedNodes;
+        if (node.expanded)
+            updateVisibleNodes(m_visibleNodes[index]->nodes, insertedNodes, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached));
+
+        const auto removedCount = static_cast<int>(removeEnd - index - 1);
+        const auto insertedCount = static_cast<int>(insertedNodes.size());
+        m_visibleNodes.erase(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index + 1), m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(removeEnd));
+        m_visibleNodes.insert(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(index + 1), insertedNodes.begin(), insertedNodes.end());
+
+        // Only when the widest item disappeared do we need to look at the other visible items to find the new width
+        if (widestNodeRemoved)
+        {
+            m_maxRight = 0;
+            for (const auto& visibleNode : m_visibleNodes)
+                m_maxRight = std::max(m_maxRight, visibleNode->text.getPosition().x + visibleNode->text.getSize().x + m_paddingCached.getRight());
+        }
+
+        if (selectedNode && (m_selectedItem > static_cast<int>(index)))
+        {
+            if (m_selectedItem <= static_cast<int>(index) + removedCount)
+            {
+                selectedNode->text.setColor(m_textColorCached);
+                m_selectedItem = -1;
+            }
+            else
+                m_selectedItem += insertedCount - removedCount;
+        }
+
+        // The hovered item remains the one below the mouse, which may now be a different node
+        if (hoveredNode)
+        {
+            hoveredNode->text.setColor(m_textColorCached);
+            if (static_cast<std::size_t>(m_hoveredItem) >= m_visibleNodes.size())
+                m_hoveredItem = -1;
+        }
+
+        if (selectedNode || hoveredNode)
+            updateSelectedAndHoveringItemColors();
+
+        updateScrollbars();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -769,6 +916,7 @@ namespace tgui
         m_horizontalScrollbar->setScrollAmount(m_itemHeight);
         markNodesDirty();
         updateIconBounds();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1112,7 +1260,7 @@ namespace tgui
             if (!m_visibleNodes[selectedItemIdx]->nodes.empty() && m_visibleNodes[selectedItemIdx]->expanded)
             {
                 m_visibleNodes[selectedItemIdx]->expanded = false;
-                markNodesDirty();
+                updateVisibleChildNodes(selectedItemIdx);
             }
             else if (m_visibleNodes[selectedItemIdx]->parent)
             {
@@ -1152,10 +1300,11 @@ namespace tgui
         {
             // If item is a collapsed node then expand it. Otherwise simply select the next item.
             TGUI_ASSERT(selectedItemIdx <= m_visibleNodes.size(), "Selected item index has to be in range");
-            if (!m_visibleNodes[selectedItemIdx]->nodes.empty() && !m_visibleNodes[selectedItemIdx]->expanded)
+            if ((!m_visibleNodes[selectedItemIdx]->nodes.empty() || m_visibleNodes[selectedItemIdx]->childrenPending) && !m_visibleNodes[selectedItemIdx]->expanded)
             {
                 m_visibleNodes[selectedItemIdx]->expanded = true;
-                markNodesDirty();
+                loadPendingChildren(*m_visibleNodes[selectedItemIdx]);
+                updateVisibleChildNodes(selectedItemIdx);
             }
             else if (selectedItemIdx + 1 < m_visibleNodes.size())
                 updateSelectedItem(m_selectedItem + 1);
@@ -1199,124 +1348,132 @@ namespace tgui
 
     void TreeView::rendererChanged(const String& property)
     {
-        if (property == U"Borders")
-        {
-            m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
-        }
-        else if (property == U"Padding")
-        {
-            m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
-        }
-        else if (property == U"BackgroundColor")
-        {
-            m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
-        }
-        else if (property == U"SelectedBackgroundColor")
-        {
-            m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
-        }
-        else if (property == U"BackgroundColorHover")
-        {
-            m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
-        }
-        else if (property == U"SelectedBackgroundColorHover")
+        const RendererPropertyId propertyId{property};
+        switch (propertyId.getValue())
         {
-            m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
-        }
-        else if (property == U"BorderColor")
-        {
-            m_borderColorCached = getSharedRenderer()->getBorderColor();
-        }
-        else if (property == U"TextureBackground")
-        {
-            m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-        }
-        else if (property == U"TextureBranchExpanded")
-        {
-            m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == U"TextureBranchCollapsed")
-        {
-            m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == U"TextureLeaf")
-        {
-            m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
-            updateIconBounds();
-            markNodesDirty();
-        }
-        else if (property == U"TextColor")
-        {
-            m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"TextColorHover")
-        {
-            m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"SelectedTextColor")
-        {
-            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"SelectedTextColorHover")
-        {
-            m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors(m_nodes);
-            updateSelectedAndHoveringItemColors();
-        }
-        else if (property == U"Scrollbar")
-        {
-            m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
-            m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+            case TGUI_RENDERER_PROPERTY_ID("Borders").getValue():
+                m_bordersCached = getSharedRenderer()->getBorders();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Padding").getValue():
+                m_paddingCached = getSharedRenderer()->getPadding();
+                setSize(m_size);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColor").getValue():
+                m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColor").getValue():
+                m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BackgroundColorHover").getValue():
+                m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedBackgroundColorHover").getValue():
+                m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("BorderColor").getValue():
+                m_borderColorCached = getSharedRenderer()->getBorderColor();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBackground").getValue():
+                m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBranchExpanded").getValue():
+                m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
+                updateIconBounds();
+                markNodesDirty();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureBranchCollapsed").getValue():
+                m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
+                updateIconBounds();
+                markNodesDirty();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextureLeaf").getValue():
+                m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
+                updateIconBounds();
+                markNodesDirty();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColor").getValue():
+                m_textColorCached = getSharedRenderer()->getTextColor();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("TextColorHover").getValue():
+                m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
 
-            // If no scrollbar width was set then we may need to use the one from the texture
-            if (getSharedRenderer()->getScrollbarWidth() == 0)
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColor").getValue():
+                m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("SelectedTextColorHover").getValue():
+                m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
+                updateTextColors(m_nodes);
+                updateSelectedAndHoveringItemColors();
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Scrollbar").getValue():
+                m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+                m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
+
+                // If no scrollbar width was set then we may need to use the one from the texture
+                if (getSharedRenderer()->getScrollbarWidth() == 0)
+                {
+                    const float width = m_verticalScrollbar->getDefaultWidth();
+                    m_verticalScrollbar->setWidth(width);
+                    m_horizontalScrollbar->setHeight(width);
+                    markNodesDirty();
+                }
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("ScrollbarWidth").getValue():
             {
-                const float width = m_verticalScrollbar->getDefaultWidth();
+                const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
                 m_verticalScrollbar->setWidth(width);
                 m_horizontalScrollbar->setHeight(width);
                 markNodesDirty();
+                break;
             }
-        }
-        else if (property == U"ScrollbarWidth")
-        {
-            const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
-            m_verticalScrollbar->setWidth(width);
-            m_horizontalScrollbar->setHeight(width);
-            markNodesDirty();
-        }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
-        {
-            Widget::rendererChanged(property);
 
-            setTextOpacityImpl(m_nodes, m_opacityCached);
+            case TGUI_RENDERER_PROPERTY_ID("Opacity").getValue():
+            case TGUI_RENDERER_PROPERTY_ID("OpacityDisabled").getValue():
+                Widget::rendererChanged(property);
 
-            m_spriteBackground.setOpacity(m_opacityCached);
-            m_spriteBranchExpanded.setOpacity(m_opacityCached);
-            m_spriteBranchCollapsed.setOpacity(m_opacityCached);
-            m_spriteLeaf.setOpacity(m_opacityCached);
+                setTextOpacityImpl(m_nodes, m_opacityCached);
 
-            m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
-            m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == U"Font")
-        {
-            Widget::rendererChanged(property);
-            setTextFontImpl(m_nodes, m_fontCached);
+                m_spriteBackground.setOpacity(m_opacityCached);
+                m_spriteBranchExpanded.setOpacity(m_opacityCached);
+                m_spriteBranchCollapsed.setOpacity(m_opacityCached);
+                m_spriteLeaf.setOpacity(m_opacityCached);
+
+                m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
+                m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
+                break;
+
+            case TGUI_RENDERER_PROPERTY_ID("Font").getValue():
+                Widget::rendererChanged(property);
+                setTextFontImpl(m_nodes, m_fontCached);
+                break;
+
+            default:
+                Widget::rendererChanged(property);
+                break;
         }
-        else
-            Widget::rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1401,29 +1558,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int TreeView::updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos)
+    void TreeView::updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, std::vector<std::shared_ptr<Node>>& visibleNodes, float textPadding)
     {
         for (auto& node : nodes)
         {
-            m_visibleNodes.push_back(node);
-            if (selectedNode == node.get())
-                m_selectedItem = static_cast<int>(pos);
+            visibleNodes.push_back(node);
 
+            // The vertical position of the row is only added when drawing, so that the texts don't have to be
+            // repositioned when items are inserted or removed above them.
             const float iconPadding = (m_iconBounds.x / 4.f);
             const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
             node->text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                    (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f)});
+                                    (m_itemHeight - node->text.getSize().y) / 2.f});
 
             const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
             if (right > m_maxRight)
                 m_maxRight = right;
 
-            pos++;
             if (node->expanded && !node->nodes.empty())
-                pos = updateVisibleNodes(node->nodes, selectedNode, textPadding, pos);
+                updateVisibleNodes(node->nodes, visibleNodes, textPadding);
         }
-
-        return pos;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1440,7 +1594,19 @@ namespace tgui
         m_hoveredItem = -1;
         m_selectedItem = -1;
         m_visibleNodes.clear();
-        updateVisibleNodes(m_nodes, selectedNode, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), 0);
+        updateVisibleNodes(m_nodes, m_visibleNodes, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached));
+
+        if (selectedNode)
+        {
+            for (std::size_t i = 0; i < m_visibleNodes.size(); ++i)
+            {
+                if (m_visibleNodes[i].get() == selectedNode)
+                {
+                    m_selectedItem = static_cast<int>(i);
+                    break;
+                }
+            }
+        }
 
         if (oldHoveredItem >= 0)
         {
@@ -1451,6 +1617,13 @@ namespace tgui
             updateSelectedAndHoveringItemColors();
         }
 
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbars()
+    {
         m_verticalScrollbar->setMaximum(static_cast<unsigned int>(m_itemHeight * m_visibleNodes.size()));
         m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxRight));
 
@@ -1557,7 +1730,7 @@ namespace tgui
             statesForIcon.transform.translate({std::round(iconOffset), std::round((i * m_itemHeight) + ((m_itemHeight - m_iconBounds.y) / 2.f))});
 
             // Draw an icon for the leaf node if a texture is set
-            if (m_visibleNodes[i]->nodes.empty())
+            if (m_visibleNodes[i]->nodes.empty() && !m_visibleNodes[i]->childrenPending)
             {
                 if (m_spriteLeaf.isSet())
                     target.drawSprite(statesForIcon, m_spriteLeaf);
@@ -1625,7 +1798,11 @@ namespace tgui
 
         // Draw the texts
         for (std::size_t i = firstNode; i < lastNode; ++i)
-            target.drawText(states, m_visibleNodes[i]->text);
+        {
+            auto statesForText = states;
+            statesForText.transform.translate({0, static_cast<float>(i * m_itemHeight)});
+            target.drawText(statesForText, m_visibleNodes[i]->text);
+        }
 
         target.removeClippingLayer();
 
@@ -1670,6 +1847,12 @@ namespace tgui
             bool nodeChanged = false;
             if (expandNode)
             {
+                if (node->childrenPending)
+                {
+                    loadPendingChildren(*node);
+                    nodeChanged = true;
+                }
+
                 // When expanding, also expand all parents
                 auto* nodeToExpand = node;
                 while (nodeToExpand)
@@ -1704,6 +1887,9 @@ namespace tgui
                 if (node->text.getString() != hierarchy.back())
                     continue;
 
+                if (expandNode)
+                    loadPendingChildren(*node);
+
                 if (node->expanded != expandNode)
                 {
                     node->expanded = expandNode;
@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2024 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+#include <cmath>
+
+namespace
+{
+    // Render target that doesn't draw anything but gives access to the cached shape geometry
+    class ShapeCachingRenderTarget : public tgui::BackendRenderTarget
+    {
+    public:
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override {}
+        void drawGui(const std::shared_ptr<tgui::RootContainer>&) override {}
+        void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex*, std::size_t, const unsigned int*, std::size_t,
+                             const std::shared_ptr<tgui::BackendTexture>&) override {}
+
+        const ShapeGeometry* getCircle(float size)
+        {
+            return &getCachedShapeGeometry({ShapeGeometryKey::Type::Circle, {size, size}, 0, 1, tgui::Color::Red, tgui::Color::Black});
+        }
+
+        bool isCircleCached(float size) const
+        {
+            return m_shapeGeometryLookup.count({ShapeGeometryKey::Type::Circle, {size, size}, 0, 1, tgui::Color::Red, tgui::Color::Black}) > 0;
+        }
+
+        std::size_t getCachedShapeCount() const
+        {
+            return m_shapeGeometryCache.size();
+        }
+
+        static constexpr std::size_t MaxCachedShapes = MaxCachedShapeGeometries;
+
+    protected:
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+    };
+}
+
+TEST_CASE("[BackendRenderTarget]")
+{
+    ShapeCachingRenderTarget target;
+
+    SECTION("Shape geometry is reused")
+    {
+        const auto* circle = target.getCircle(20);
+        REQUIRE(!circle->vertices.empty());
+        REQUIRE(!circle->indices.empty());
+        REQUIRE(target.getCachedShapeCount() == 1);
+
+        REQUIRE(target.getCircle(20) == circle);
+        REQUIRE(target.getCachedShapeCount() == 1);
+
+        REQUIRE(target.getCircle(30) != circle);
+        REQUIRE(target.getCachedShapeCount() == 2);
+        REQUIRE(target.getCircle(20) == circle);
+        REQUIRE(target.getCachedShapeCount() == 2);
+    }
+
+    SECTION("Least recently used shape is removed when cache is full")
+    {
+        for (unsigned int i = 1; i <= ShapeCachingRenderTarget::MaxCachedShapes; ++i)
+            (void)target.getCircle(static_cast<float>(i));
+
+        REQUIRE(target.getCachedShapeCount() == ShapeCachingRenderTarget::MaxCachedShapes);
+
+        // Using the oldest shape again makes the second shape the least recently used one
+        const auto* firstCircle = target.getCircle(1);
+        (void)target.getCircle(1000);
+
+        REQUIRE(target.getCachedShapeCount() == ShapeCachingRenderTarget::MaxCachedShapes);
+        REQUIRE(target.isCircleCached(1));
+        REQUIRE(!target.isCircleCached(2));
+        REQUIRE(target.isCircleCached(3));
+        REQUIRE(target.isCircleCached(1000));
+        REQUIRE(target.getCircle(1) == firstCircle);
+    }
+
+    SECTION("Shapes with NaN parameters aren't cached")
+    {
+        (void)target.getCircle(20);
+        REQUIRE(target.getCircle(std::nanf(""))->vertices.empty());
+        REQUIRE(target.getCircle(std::nanf(""))->indices.empty());
+        REQUIRE(target.getCachedShapeCount() == 1);
+        REQUIRE(target.isCircleCached(20));
+    }
+}
@@ -0,0 +1,247 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2024 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The test cases in this file measure how long certain operations take. They are hidden and only run when explicitly
+// selected, e.g. with the "[benchmark]" tag on the command line. The timings are printed as warnings.
+
+#include "Tests.hpp"
+
+#if !TGUI_BUILD_AS_CXX_MODULE
+    #include <TGUI/Loading/ImageLoader.hpp>
+#endif
+
+// Creates the contents of a widget file with 500 panels that each contain 10 buttons
+static std::string createLargeWidgetFile()
+{
+    std::string input;
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        input += "Panel.\"Panel" + std::to_string(i) + "\" {\n"
+                 "    Position = (0, " + std::to_string(i * 100) + ");\n"
+                 "    Size = (400, 100);\n"
+                 "\n";
+
+        for (unsigned int j = 0; j < 10; ++j)
+        {
+            input += "    Button.\"Button" + std::to_string(j) + "\" {\n"
+                     "        Position = (" + std::to_string(j * 40) + ", 20);\n"
+                     "        Size = (40, 30);\n"
+                     "        Text = \"Click me\";\n"
+                     "        ToolTip { Label { Text = \"Button " + std::to_string(j) + "\"; } }\n"
+                     "\n"
+                     "        Renderer {\n"
+                     "            BackgroundColor = #F5F5F5;\n"
+                     "            Borders = (1, 1, 1, 1);\n"
+                     "            Texture = \"resources/Black.png\" Part(0, 64, 45, 50) Middle(10, 0, 25, 50) Smooth;\n"
+                     "        }\n"
+                     "    }\n"
+                     "\n";
+        }
+
+        input += "}\n"
+                 "\n";
+    }
+
+    return input;
+}
+
+// Calls the function and returns how many microseconds it took
+template <typename Func>
+static long long measureMicroseconds(Func&& func)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+// Compares measuring text with the metrics tables of the font against retrieving the glyph of each character.
+// Both methods run once before they are timed, so that neither of them has to load the glyphs.
+TEST_CASE("[Text] Measurement benchmark", "[.][benchmark]")
+{
+    const tgui::Font font{"resources/DejaVuSans.ttf"};
+    const auto backendFont = font.getBackendFont();
+
+    std::vector<tgui::String> texts;
+    for (unsigned int i = 0; i < 10000; ++i)
+        texts.emplace_back("Line " + tgui::String(i) + U": The quick brown fox jumps over the lazy dog. Voil\u00E0!");
+
+    std::vector<float> expectedWidths;
+    const auto measureWithGlyphs = [&]{
+        expectedWidths.clear();
+        for (const auto& text : texts)
+        {
+            float width = 0;
+            char32_t prevChar = 0;
+            for (const char32_t curChar : text)
+            {
+                width += backendFont->getGlyph(curChar, 16, false).advance + backendFont->getKerning(prevChar, curChar, 16, false);
+                prevChar = curChar;
+            }
+            expectedWidths.push_back(width);
+        }
+    };
+
+    std::vector<float> widths;
+    const auto measureWithTables = [&]{
+        widths = tgui::Text::getLineWidths(texts, font, 16);
+    };
+
+    measureWithGlyphs();
+    measureWithTables();
+
+    const long long glyphDuration = measureMicroseconds(measureWithGlyphs);
+    const long long tableDuration = measureMicroseconds(measureWithTables);
+
+    REQUIRE(widths == expectedWidths);
+    WARN("Measuring " << texts.size() << " lines with getGlyph and getKerning: " << glyphDuration << " us");
+    WARN("Measuring " << texts.size() << " lines with Text::getLineWidths: " << tableDuration << " us");
+}
+
+// Compares loading an image by mapping the file into memory against reading it into a buffer first
+TEST_CASE("[ImageLoader] Loading benchmark", "[.][benchmark]")
+{
+    const tgui::String filename = "resources/image.png";
+    const unsigned int iterations = 2000;
+
+    const long long readDuration = measureMicroseconds([&]{
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+            REQUIRE(fileContents != nullptr);
+
+            tgui::Vector2u imageSize;
+            REQUIRE(tgui::ImageLoader::loadFromMemory(fileContents.get(), fileSize, imageSize) != nullptr);
+        }
+    });
+
+    const long long mapDuration = measureMicroseconds([&]{
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            tgui::Vector2u imageSize;
+            REQUIRE(tgui::ImageLoader::loadFromFile(filename, imageSize) != nullptr);
+        }
+    });
+
+    WARN("Loading " << filename << " " << iterations << " times via readFileToMemory: " << readDuration << " us");
+    WARN("Loading " << filename << " " << iterations << " times with ImageLoader::loadFromFile: " << mapDuration << " us");
+}
+
+// Creates layouts from strings and bind functions, and then measures how long it takes to update the bound layouts
+TEST_CASE("[Layouts] Creation and evaluation benchmark", "[.][benchmark]")
+{
+    const char* expressions[] = {"min(50%, &.w - 20)", "parent.width - 10", "30%", "(&.iw - 20) / 2 + 5", "max(Panel.right + 5, 10%)"};
+
+    auto root = tgui::Panel::create({1000, 1000});
+    auto panel = tgui::Panel::create({500, 400});
+    root->add(panel, "Panel");
+
+    std::vector<tgui::Layout> layouts;
+    const long long creationDuration = measureMicroseconds([&]{
+        layouts.reserve(100000);
+        for (unsigned int i = 0; i < 100000; ++i)
+        {
+            if (i % 2 == 0)
+                layouts.emplace_back(expressions[(i / 2) % 5]);
+            else
+                layouts.push_back(tgui::bindMin(tgui::bindWidth(panel) * 0.5f + 10, tgui::bindInnerHeight(panel) - static_cast<float>(i)));
+        }
+    });
+
+    const long long evaluationDuration = measureMicroseconds([&]{
+        for (unsigned int i = 0; i < 10; ++i)
+            panel->setSize({500.f + i, 400.f + i});
+    });
+
+    REQUIRE(layouts[1].getValue() == 264.5f);
+    REQUIRE(layouts[99999].getValue() == 409 - 99999);
+    WARN("Creating " << layouts.size() << " layouts: " << creationDuration << " us");
+    WARN("Evaluating the " << (layouts.size() / 2) << " bound layouts 10 times: " << evaluationDuration << " us");
+}
+
+// Compares parsing a large widget file in the text format against parsing the same file in the binary format
+TEST_CASE("[DataIO] Binary format benchmark", "[.][benchmark]")
+{
+    const std::string input = createLargeWidgetFile();
+
+    std::stringstream binaryStream;
+    tgui::DataIO::emitBinary(tgui::DataIO::parse(tgui::CharStringView{input}), binaryStream);
+    const std::string binary = binaryStream.str();
+
+    std::unique_ptr<tgui::DataIO::Node> textRootNode;
+    const long long textDuration = measureMicroseconds([&]{
+        textRootNode = tgui::DataIO::parse(tgui::CharStringView{input});
+    });
+
+    std::unique_ptr<tgui::DataIO::Node> binaryRootNode;
+    const long long binaryDuration = measureMicroseconds([&]{
+        binaryRootNode = tgui::DataIO::parse(tgui::CharStringView{binary});
+    });
+
+    REQUIRE(textRootNode->children.size() == 500);
+    REQUIRE(binaryRootNode->children.size() == 500);
+
+    std::stringstream emittedFromText;
+    std::stringstream emittedFromBinary;
+    tgui::DataIO::emit(textRootNode, emittedFromText);
+    tgui::DataIO::emit(binaryRootNode, emittedFromBinary);
+    REQUIRE(emittedFromBinary.str() == emittedFromText.str());
+
+    WARN("Parsing " << (input.size() / 1024) << " KiB from the text format: " << textDuration << " us");
+    WARN("Parsing " << (binary.size() / 1024) << " KiB from the binary format: " << binaryDuration << " us");
+}
+
+// Compares loading a large form with loadWidgetsFromFile from a text file against loading it from a binary file.
+// Each file is loaded into a new gui, so the time includes reading the file, parsing it and creating all widgets.
+TEST_CASE("[Container] Widget file loading benchmark", "[.][benchmark]")
+{
+    // The texture stays loaded, so that neither of the files has to load the image
+    const tgui::Texture texture{"resources/Black.png"};
+
+    // Both files are saved from the same widgets
+    REQUIRE(tgui::writeFile("BenchmarkWidgetFile1.txt", createLargeWidgetFile()));
+    {
+        GuiNull gui;
+        gui.loadWidgetsFromFile("BenchmarkWidgetFile1.txt");
+        gui.saveWidgetsToFile("BenchmarkWidgetFile2.txt");
+        gui.saveWidgetsToFile("BenchmarkWidgetFile2.bin", true);
+    }
+
+    // Each gui is destroyed before the next file is loaded, because the widgets that still exist slow down loading.
+    // The loaded widgets are saved as text again to check that both files contain the same form.
+    const auto measureLoading = [](const tgui::String& filename, const tgui::String& savedFilename){
+        GuiNull gui;
+        const long long duration = measureMicroseconds([&]{ gui.loadWidgetsFromFile(filename); });
+        REQUIRE(gui.getWidgets().size() == 500);
+        gui.saveWidgetsToFile(savedFilename);
+        return duration;
+    };
+
+    const long long textDuration = measureLoading("BenchmarkWidgetFile2.txt", "BenchmarkWidgetFile3.txt");
+    const long long binaryDuration = measureLoading("BenchmarkWidgetFile2.bin", "BenchmarkWidgetFile4.txt");
+    REQUIRE(compareFiles("BenchmarkWidgetFile3.txt", "BenchmarkWidgetFile4.txt"));
+
+    WARN("Loading 5500 widgets with loadWidgetsFromFile from a text file: " << textDuration << " us");
+    WARN("Loading 5500 widgets with loadWidgetsFromFile from a binary file: " << binaryDuration << " us");
+}
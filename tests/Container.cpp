@@ -24,6 +24,92 @@
 
 #include "Tests.hpp"
 
+namespace
+{
+    // Render target that counts how many times a cached container draws its child widgets to a texture
+    class TextureCountingRenderTarget : public tgui::BackendRenderTarget
+    {
+    public:
+        TextureCountingRenderTarget()
+        {
+            setView({0, 0, 400, 300}, {0, 0, 400, 300}, {400, 300});
+        }
+
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override {}
+        void drawGui(const std::shared_ptr<tgui::RootContainer>&) override {}
+        void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex*, std::size_t, const unsigned int*, std::size_t,
+                             const std::shared_ptr<tgui::BackendTexture>&) override {}
+
+        bool drawToTexture(std::shared_ptr<tgui::BackendTexture>& texture, tgui::Vector2u textureSize, tgui::FloatRect,
+                           const std::function<void(tgui::BackendRenderTarget&, const tgui::RenderStates&)>& drawFunc) override
+        {
+            if (!texture || (texture->getSize() != textureSize))
+            {
+                texture = std::make_shared<tgui::BackendTexture>();
+                texture->loadTextureOnly(textureSize, nullptr, false);
+            }
+
+            drawFunc(*this, {});
+            ++texturesDrawn;
+            return true;
+        }
+
+        unsigned int texturesDrawn = 0;
+
+    protected:
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+    };
+
+    // Render target that remembers how often the screen was cleared and to which areas the drawing was clipped
+    class RedrawRecordingRenderTarget : public tgui::BackendRenderTarget
+    {
+    public:
+        void setClearColor(const tgui::Color&) override {}
+        void clearScreen() override { ++clearCount; }
+        void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex*, std::size_t, const unsigned int*, std::size_t,
+                             const std::shared_ptr<tgui::BackendTexture>&) override {}
+
+        void drawGui(const std::shared_ptr<tgui::RootContainer>& root) override
+        {
+            clippingRects.clear();
+            root->draw(*this, {});
+        }
+
+        void addClippingLayer(const tgui::RenderStates& states, tgui::FloatRect rect) override
+        {
+            clippingRects.push_back(rect);
+            BackendRenderTarget::addClippingLayer(states, rect);
+        }
+
+        unsigned int clearCount = 0;
+        std::vector<tgui::FloatRect> clippingRects;
+
+    protected:
+        void updateClipping(tgui::FloatRect, tgui::FloatRect) override {}
+    };
+
+    // Gui that draws to a RedrawRecordingRenderTarget and gives access to the functions used by the main loop
+    class RedrawRecordingGui : public GuiNull
+    {
+    public:
+        RedrawRecordingGui()
+        {
+            target->setView({0, 0, 200, 200}, {0, 0, 200, 200}, {200, 200});
+            m_backendRenderTarget = target;
+        }
+
+        using BackendGui::prepareRedraw;
+
+        void drawFrame()
+        {
+            BackendGui::draw();
+        }
+
+        std::shared_ptr<RedrawRecordingRenderTarget> target = std::make_shared<RedrawRecordingRenderTarget>();
+    };
+}
+
 TEST_CASE("[Container]")
 {
     auto container = std::make_shared<GuiNull>();
@@ -404,6 +490,228 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("CachedAsTexture")
+    {
+        REQUIRE(!widget2->isCachedAsTexture());
+        widget2->setCachedAsTexture(true);
+        REQUIRE(widget2->isCachedAsTexture());
+
+        auto copy = tgui::Panel::copy(widget2);
+        REQUIRE(copy->isCachedAsTexture());
+
+        widget2->setCachedAsTexture(false);
+        REQUIRE(!widget2->isCachedAsTexture());
+        REQUIRE(copy->isCachedAsTexture());
+    }
+
+    SECTION("Changing the contents of a child redraws a cached container")
+    {
+        auto panel = tgui::Panel::create({200, 100});
+        panel->setCachedAsTexture(true);
+        auto label = tgui::Label::create("Text");
+        panel->add(label);
+        auto listBox = tgui::ListBox::create();
+        listBox->setPosition({0, 30});
+        panel->add(listBox);
+
+        tgui::BackendGui& gui{*globalGui};
+        gui.removeAllWidgets();
+        gui.add(panel);
+        gui.setPartialRedrawEnabled(true);
+
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        label->setText("Changed");
+        REQUIRE(gui.isRedrawRequired());
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        listBox->addItem("Item");
+        REQUIRE(gui.isRedrawRequired());
+        gui.draw();
+
+        gui.setPartialRedrawEnabled(false);
+        gui.removeAllWidgets();
+    }
+
+    SECTION("Cached texture is only redrawn when the child widgets draw something different")
+    {
+        auto panel = tgui::Panel::create({200, 100});
+        panel->setCachedAsTexture(true);
+        auto label = tgui::Label::create("Text");
+        panel->add(label);
+        auto button = tgui::Button::create("Button");
+        button->setPosition({0, 40});
+        button->setSize({100, 30});
+        panel->add(button);
+
+        tgui::BackendGui& gui{*globalGui};
+        gui.removeAllWidgets();
+        gui.add(panel);
+        gui.setPartialRedrawEnabled(true);
+
+        const auto moveMouse = [&gui](tgui::Vector2f pos){
+            const tgui::Vector2f pixel = gui.mapCoordsToPixel(pos);
+            tgui::Event event;
+            event.type = tgui::Event::Type::MouseMoved;
+            event.mouseMove.x = static_cast<int>(pixel.x);
+            event.mouseMove.y = static_cast<int>(pixel.y);
+            gui.handleEvent(event);
+        };
+
+        TextureCountingRenderTarget target;
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 1);
+
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 1);
+
+        // Hovering a label doesn't change how it looks
+        moveMouse({10, 5});
+        moveMouse({15, 8});
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 1);
+
+        // Hovering the button changes its colors
+        moveMouse({10, 50});
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 2);
+
+        moveMouse({20, 55});
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 2);
+
+        label->setText("Changed");
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 3);
+
+        button->setPosition({0, 50});
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 4);
+
+        panel->invalidateTextureCache();
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 5);
+
+        target.drawWidget({}, panel);
+        REQUIRE(target.texturesDrawn == 5);
+
+        gui.setPartialRedrawEnabled(false);
+        gui.removeAllWidgets();
+    }
+
+    SECTION("Partial redrawing")
+    {
+        RedrawRecordingGui gui;
+        auto button = tgui::Button::create("Button");
+        button->setPosition({20, 30});
+        button->setSize({50, 20});
+        gui.add(button);
+        auto label = tgui::Label::create("Label");
+        label->setPosition({100, 100});
+        gui.add(label);
+
+        gui.setDrawingUpdatesTime(false);
+        gui.setPartialRedrawEnabled(true);
+        const tgui::Color clearColor{255, 255, 255};
+
+        // The first frame is always drawn entirely
+        REQUIRE(gui.prepareRedraw(clearColor));
+        REQUIRE(gui.target->clearCount == 1);
+        gui.drawFrame();
+        REQUIRE(gui.target->clippingRects.empty());
+
+        // Nothing is drawn when nothing changed
+        REQUIRE(!gui.isRedrawRequired());
+        REQUIRE(!gui.prepareRedraw(clearColor));
+
+        const auto sendMouseEvent = [&gui](tgui::Event::Type type, int x, int y){
+            tgui::Event event;
+            event.type = type;
+            if (type == tgui::Event::Type::MouseMoved)
+            {
+                event.mouseMove.x = x;
+                event.mouseMove.y = y;
+            }
+            else
+            {
+                event.mouseButton.button = tgui::Event::MouseButton::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+            }
+            gui.handleEvent(event);
+        };
+
+        SECTION("Changing a widget")
+        {
+            // Only the area of the changed widget is redrawn, with a margin of 1 pixel
+            label->setText("Changed");
+            REQUIRE(gui.prepareRedraw(clearColor));
+            REQUIRE(gui.target->clearCount == 1);
+            gui.drawFrame();
+            REQUIRE(!gui.target->clippingRects.empty());
+            REQUIRE(gui.target->clippingRects.front() == tgui::FloatRect{99, 99, label->getSize().x + 2, label->getSize().y + 2});
+
+            REQUIRE(!gui.prepareRedraw(clearColor));
+
+            // The old and the new area are redrawn when a widget is moved
+            button->setPosition({40, 30});
+            REQUIRE(gui.prepareRedraw(clearColor));
+            gui.drawFrame();
+            REQUIRE(gui.target->clippingRects.front() == tgui::FloatRect{19, 29, 72, 22});
+            REQUIRE(gui.target->clearCount == 1);
+        }
+
+        SECTION("Events")
+        {
+            // Moving the mouse where there are no widgets doesn't damage anything
+            sendMouseEvent(tgui::Event::Type::MouseMoved, 150, 20);
+            sendMouseEvent(tgui::Event::Type::MouseMoved, 160, 30);
+            REQUIRE(!gui.isRedrawRequired());
+            REQUIRE(!gui.prepareRedraw(clearColor));
+
+            // The button is redrawn when the mouse enters it
+            sendMouseEvent(tgui::Event::Type::MouseMoved, 30, 40);
+            REQUIRE(gui.prepareRedraw(clearColor));
+            gui.drawFrame();
+            REQUIRE(gui.target->clippingRects.front() == tgui::FloatRect{19, 29, 52, 22});
+            REQUIRE(gui.target->clearCount == 1);
+        }
+
+        SECTION("Signals and timers")
+        {
+            // Signal handlers could change anything, so the entire screen is redrawn after a signal was emitted
+            unsigned int clickCount = 0;
+            button->onClick([&]{ ++clickCount; });
+            sendMouseEvent(tgui::Event::Type::MouseButtonPressed, 30, 40);
+            sendMouseEvent(tgui::Event::Type::MouseButtonReleased, 30, 40);
+            REQUIRE(clickCount == 1);
+            REQUIRE(gui.prepareRedraw(clearColor));
+            REQUIRE(gui.target->clearCount == 2);
+            gui.drawFrame();
+            REQUIRE(gui.target->clippingRects.empty());
+            REQUIRE(!gui.prepareRedraw(clearColor));
+
+            // The same happens when the callback of a timer was called
+            bool timerCalled = false;
+            tgui::Timer::scheduleCallback([&]{ timerCalled = true; }, std::chrono::milliseconds(10));
+            (void)gui.updateTime(std::chrono::milliseconds(20));
+            REQUIRE(timerCalled);
+            REQUIRE(gui.prepareRedraw(clearColor));
+            REQUIRE(gui.target->clearCount == 3);
+            gui.drawFrame();
+            REQUIRE(gui.target->clippingRects.empty());
+        }
+
+        SECTION("Transparent clear color")
+        {
+            label->setText("Changed");
+            REQUIRE(gui.prepareRedraw({255, 255, 255, 200}));
+            REQUIRE(gui.target->clearCount == 2);
+        }
+    }
+
     SECTION("getWidgetAtPos / getWidgetBelowMouseCursor")
     {
         container->setAbsoluteView({-5, 40, 100, 400});
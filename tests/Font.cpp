@@ -24,6 +24,13 @@
 
 #include "Tests.hpp"
 
+#include <atomic>
+#include <thread>
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+#endif
+
 TEST_CASE("[Font]")
 {
     REQUIRE(tgui::Font() == nullptr);
@@ -37,4 +44,243 @@ TEST_CASE("[Font]")
     REQUIRE(!font.isSmooth());
     font.setSmooth(true);
     REQUIRE(font.isSmooth());
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    SECTION("GlyphCache")
+    {
+        // Add a byte to the end of the file, so that the font doesn't share its glyphs with fonts from other tests
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents != nullptr);
+        std::vector<std::uint8_t> modifiedFileContents(fileContents.get(), fileContents.get() + fileSize);
+        modifiedFileContents.push_back(0);
+
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromMemory(modifiedFileContents.data(), modifiedFileContents.size()));
+        REQUIRE(backendFont->getGlyphCacheStatistics().pageCount == 0);
+
+        backendFont->setEvictionDelay(2);
+        REQUIRE(backendFont->getEvictionDelay() == 2);
+        backendFont->setMaximumPageSize(512);
+        REQUIRE(backendFont->getMaximumPageSize() == 512);
+
+        (void)backendFont->getGlyph(U'a', 20, false);
+        (void)backendFont->getGlyph(U'b', 20, false);
+        (void)backendFont->getGlyph(U'a', 30, false);
+
+        unsigned int textureVersion = 0;
+        REQUIRE(backendFont->getTexture(20, textureVersion) != nullptr);
+
+        auto statistics = backendFont->getGlyphCacheStatistics();
+        REQUIRE(statistics.pageCount == 2);
+        REQUIRE(statistics.glyphCount == 3);
+        REQUIRE(statistics.fullUploads == 1);
+
+        // Adding a glyph to an existing page only uploads the changed pixels when supported
+        (void)backendFont->getGlyph(U'c', 20, false);
+        unsigned int newTextureVersion = 0;
+        REQUIRE(backendFont->getTexture(20, newTextureVersion) != nullptr);
+        REQUIRE(newTextureVersion == textureVersion);
+        REQUIRE(backendFont->getGlyphCacheStatistics().fullUploads + backendFont->getGlyphCacheStatistics().partialUploads == 2);
+
+        // Loading the same font again shares the glyphs
+        auto backendFont2 = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont2->loadFromMemory(modifiedFileContents.data(), modifiedFileContents.size()));
+        REQUIRE(backendFont2->getGlyphCacheStatistics().glyphCount == 4);
+        REQUIRE(backendFont2->getEvictionDelay() == 2);
+        backendFont2 = nullptr;
+
+        // Pages that aren't used for a few frames are removed
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            (void)backendFont->getGlyph(U'a', 20, false);
+            backendFont->frameDrawn();
+        }
+
+        statistics = backendFont->getGlyphCacheStatistics();
+        REQUIRE(statistics.pageCount == 1);
+        REQUIRE(statistics.glyphCount == 3);
+        REQUIRE(statistics.evictedGlyphs == 1);
+    }
+
+    SECTION("Full glyph textures")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents != nullptr);
+        std::vector<std::uint8_t> modifiedFileContents(fileContents.get(), fileContents.get() + fileSize);
+        modifiedFileContents.push_back(3);
+
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromMemory(modifiedFileContents.data(), modifiedFileContents.size()));
+
+        (void)backendFont->getGlyph(U'a', 20, false);
+        unsigned int textureVersion = 0;
+        const auto firstTexture = backendFont->getTexture(20, textureVersion);
+        REQUIRE(firstTexture != nullptr);
+        const tgui::Vector2u textureSize = backendFont->getTextureSize(20);
+
+        // When a texture is full, the glyphs are placed in a new texture of the same size instead of resizing the texture
+        tgui::String str;
+        unsigned int maxTextureIndex = 0;
+        for (char32_t codePoint = U'!'; codePoint < 0x250; ++codePoint)
+        {
+            if (!backendFont->hasGlyph(codePoint))
+                continue;
+
+            str += codePoint;
+            maxTextureIndex = std::max(maxTextureIndex, backendFont->getGlyph(codePoint, 20, false).textureIndex);
+        }
+
+        REQUIRE(maxTextureIndex > 0);
+        REQUIRE(backendFont->getGlyphCacheStatistics().pageCount == maxTextureIndex + 1);
+        REQUIRE(backendFont->getTextureSize(20) == textureSize);
+
+        unsigned int newTextureVersion = 0;
+        REQUIRE(backendFont->getTexture(20, newTextureVersion) == firstTexture);
+        REQUIRE(newTextureVersion == textureVersion);
+        REQUIRE(backendFont->getTextureAtIndex(20, maxTextureIndex, newTextureVersion) != nullptr);
+        REQUIRE(backendFont->getTextureAtIndex(20, maxTextureIndex + 1, newTextureVersion) == nullptr);
+
+        // A text that uses glyphs from all textures is drawn with each of them
+        tgui::BackendText text;
+        text.setFont(backendFont);
+        text.setCharacterSize(20);
+        text.setString(str);
+        REQUIRE(text.getVertexData().size() == maxTextureIndex + 1);
+    }
+
+    SECTION("DistanceField")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents != nullptr);
+        std::vector<std::uint8_t> modifiedFileContents(fileContents.get(), fileContents.get() + fileSize);
+        modifiedFileContents.push_back(1);
+
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromMemory(modifiedFileContents.data(), modifiedFileContents.size()));
+
+        REQUIRE(!backendFont->isDistanceFieldEnabled());
+        backendFont->setDistanceFieldEnabled(true);
+        REQUIRE(backendFont->isDistanceFieldEnabled());
+
+        const tgui::FontGlyph smallGlyph = backendFont->getGlyph(U'A', 20, false);
+        const tgui::FontGlyph largeGlyph = backendFont->getGlyph(U'A', 40, false);
+
+        unsigned int textureVersion;
+        const auto texture = backendFont->getTexture(20, textureVersion);
+        REQUIRE(texture != nullptr);
+
+        if (tgui::getBackend()->getRenderer()->supportsDistanceFieldTextures())
+        {
+            // All character sizes share the same glyph, which is scaled
+            REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 1);
+            REQUIRE(smallGlyph.textureRect == largeGlyph.textureRect);
+            REQUIRE(largeGlyph.advance == Approx(smallGlyph.advance * 2));
+            REQUIRE(texture->isDistanceField());
+            REQUIRE(backendFont->getTexture(40, textureVersion) == texture);
+        }
+        else // Normal glyphs are used when the renderer doesn't support distance fields
+        {
+            REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 2);
+            REQUIRE(!texture->isDistanceField());
+        }
+    }
+
+    SECTION("PreloadGlyphs")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents != nullptr);
+        std::vector<std::uint8_t> modifiedFileContents(fileContents.get(), fileContents.get() + fileSize);
+        modifiedFileContents.push_back(2);
+
+        auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(backendFont->loadFromMemory(modifiedFileContents.data(), modifiedFileContents.size()));
+        REQUIRE(!backendFont->isPreloadingGlyphs());
+
+        backendFont->preloadGlyphs(U'A', U'Z', {16, 24});
+
+        // The glyphs are added to the font at the end of a frame, once the background threads rasterized them
+        while (backendFont->isPreloadingGlyphs())
+            backendFont->frameDrawn();
+
+        REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 2 * 26);
+
+        // Preloaded glyphs aren't evicted before they were used
+        for (unsigned int i = 0; i <= backendFont->getEvictionDelay(); ++i)
+            backendFont->frameDrawn();
+
+        REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 2 * 26);
+
+        // Drawing text with the preloaded glyphs doesn't require loading them again
+        const tgui::FontGlyph glyph = backendFont->getGlyph(U'M', 24, false);
+        REQUIRE(glyph.textureRect.width > 0);
+        REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 2 * 26);
+
+        (void)backendFont->getGlyph(U'a', 24, false);
+        REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 2 * 26 + 1);
+
+        // Once a character size was used, its glyphs are evicted when it is no longer drawn
+        for (unsigned int i = 0; i <= backendFont->getEvictionDelay(); ++i)
+            backendFont->frameDrawn();
+
+        REQUIRE(backendFont->getGlyphCacheStatistics().pageCount == 1);
+        REQUIRE(backendFont->getGlyphCacheStatistics().glyphCount == 26);
+    }
+
+    SECTION("Loading on multiple threads")
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory("resources/DejaVuSans.ttf", fileSize);
+        REQUIRE(fileContents != nullptr);
+
+        // Fonts share the freetype library and the faces of identical files, even when they are created on different threads
+        std::atomic<unsigned int> loadedFonts{0};
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&fileContents,fileSize,&loadedFonts]{
+                for (unsigned int j = 0; j < 10; ++j)
+                {
+                    auto backendFont = std::make_shared<tgui::BackendFontFreetype>();
+                    if (backendFont->loadFromMemory(fileContents.get(), fileSize) && backendFont->hasGlyph(U'A'))
+                        ++loadedFonts;
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(loadedFonts == 40);
+    }
+#endif
+
+    SECTION("Metrics tables")
+    {
+        auto backendFont = font.getBackendFont();
+        const tgui::String characters = U"AVTo.,W\u00E9\u00FF\u0100\u03A9";
+        for (const unsigned int characterSize : {13u, 24u})
+        {
+            for (const bool bold : {false, true})
+            {
+                for (const char32_t first : characters)
+                {
+                    REQUIRE(font.getAdvance(first, characterSize, bold) == backendFont->getGlyph(first, characterSize, bold).advance);
+                    for (const char32_t second : characters)
+                        REQUIRE(font.getKerning(first, second, characterSize, bold) == backendFont->getKerning(first, second, characterSize, bold));
+                }
+            }
+        }
+
+        // The tables are cleared when the font scale changes
+        const float oldAdvance = font.getAdvance(U'W', 13);
+        backendFont->setFontScale(1.5f);
+        REQUIRE(font.getAdvance(U'W', 13) == backendFont->getGlyph(U'W', 13, false).advance);
+        REQUIRE(font.getKerning(U'A', U'V', 13) == backendFont->getKerning(U'A', U'V', 13, false));
+        backendFont->setFontScale(1);
+        REQUIRE(font.getAdvance(U'W', 13) == oldAdvance);
+    }
 }
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <sstream>
 
 #include "Tests.hpp"
 
@@ -868,6 +869,162 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Compiled expressions")
+    {
+        auto panel1 = tgui::Panel::create({200, 100});
+        auto panel2 = tgui::Panel::create({400, 300});
+
+        // Layouts created from the same string don't share any state
+        auto button1 = tgui::Button::create();
+        button1->setSize({"min(50%, &.h - 20)", "25%"});
+        panel1->add(button1);
+
+        auto button2 = tgui::Button::create();
+        button2->setSize({"min(50%, &.h - 20)", "25%"});
+        panel2->add(button2);
+
+        REQUIRE(button1->getSize() == tgui::Vector2f(80, 25));
+        REQUIRE(button2->getSize() == tgui::Vector2f(200, 75));
+        REQUIRE(button1->getSizeLayout().toString() == "(min(50%, &.h - 20), 25%)");
+
+        // A copied layout binds the widgets again once it is connected to a different widget
+        auto button3 = tgui::Button::create();
+        button3->setSize(button1->getSizeLayout());
+        panel2->add(button3);
+        REQUIRE(button3->getSize() == tgui::Vector2f(200, 75));
+
+        panel1->setSize({100, 200});
+        REQUIRE(button1->getSize() == tgui::Vector2f(50, 50));
+        REQUIRE(button3->getSize() == tgui::Vector2f(200, 75));
+
+        // Long expressions need more room to be evaluated
+        tgui::String expression = "1";
+        for (unsigned int i = 0; i < 20; ++i)
+            expression = "1 + (" + expression + ")";
+        REQUIRE(Layout(expression).getValue() == 21);
+
+        // A layout that only binds a widget becomes a constant when the widget is destroyed
+        Layout layout;
+        {
+            auto button4 = tgui::Button::create();
+            button4->setSize({50, 20});
+            layout = bindWidth(button4) + 10;
+            REQUIRE(layout.getValue() == 60);
+
+            Layout layout2 = bindHeight(button4);
+            REQUIRE(!layout2.isConstant());
+            REQUIRE(layout2.getValue() == 20);
+
+            button4 = nullptr;
+            REQUIRE(layout2.isConstant());
+            REQUIRE(layout2.getValue() == 0);
+        }
+        REQUIRE(layout.getValue() == 10);
+    }
+
+    SECTION("Deferred layout updates")
+    {
+        GuiNull gui;
+        REQUIRE(!gui.isDeferredLayoutUpdatesEnabled());
+        gui.setDeferredLayoutUpdatesEnabled(true);
+        REQUIRE(gui.isDeferredLayoutUpdatesEnabled());
+
+        auto panel = tgui::Panel::create({100, 100});
+        gui.add(panel);
+
+        auto button1 = tgui::Button::create();
+        button1->setSize({"50%", 20});
+        panel->add(button1, "Button1");
+
+        auto button2 = tgui::Button::create();
+        button2->setPosition({bindRight(button1), 0});
+        button2->setSize({bindWidth(button1) * 2, 20});
+        panel->add(button2, "Button2");
+
+        REQUIRE(button1->getSize() == tgui::Vector2f(50, 20));
+        REQUIRE(button2->getPosition() == tgui::Vector2f(50, 0));
+        REQUIRE(button2->getSize() == tgui::Vector2f(100, 20));
+
+        unsigned int sizeChangedCount = 0;
+        button2->onSizeChange([&]{ ++sizeChangedCount; });
+
+        // Dependent widgets are only updated when the gui processes the pending layouts
+        panel->setSize({200, 100});
+        REQUIRE(button1->getSize() == tgui::Vector2f(50, 20));
+        REQUIRE(button2->getSize() == tgui::Vector2f(100, 20));
+
+        gui.updateLayouts();
+        REQUIRE(button1->getSize() == tgui::Vector2f(100, 20));
+        REQUIRE(button2->getPosition() == tgui::Vector2f(100, 0));
+        REQUIRE(button2->getSize() == tgui::Vector2f(200, 20));
+        REQUIRE(sizeChangedCount == 1);
+
+        // Disabling the deferred updates processes the pending layouts
+        panel->setSize({100, 100});
+        gui.setDeferredLayoutUpdatesEnabled(false);
+        REQUIRE(button2->getSize() == tgui::Vector2f(100, 20));
+
+        SECTION("Dependency cycle")
+        {
+            // Layouts that depend on each other are reported but don't cause an infinite loop
+            gui.setDeferredLayoutUpdatesEnabled(true);
+            std::ostringstream warnings;
+            std::streambuf *oldbuf = std::cerr.rdbuf(warnings.rdbuf());
+            button1->setSize({bindWidth(button2), 20});
+            gui.updateLayouts();
+            std::cerr.rdbuf(oldbuf);
+
+#if !defined(NDEBUG)
+            const std::string warning = warnings.str();
+            REQUIRE(warning.find("Dependency cycle") != std::string::npos);
+            REQUIRE(warning.find("'Button1'") != std::string::npos);
+            REQUIRE(warning.find("'Button2'") != std::string::npos);
+#endif
+            // The updates stop after 10 rounds, the widths of the buttons doubled in each round
+            REQUIRE(button1->getSize() == tgui::Vector2f(102400, 20));
+            REQUIRE(button2->getSize() == tgui::Vector2f(102400, 20));
+            REQUIRE(button2->getPosition() == tgui::Vector2f(51200, 0));
+
+            // The gui no longer has pending updates afterwards
+            const tgui::Vector2f button1Size = button1->getSize();
+            gui.updateLayouts();
+            REQUIRE(button1->getSize() == button1Size);
+        }
+
+        SECTION("Removing widgets with pending updates")
+        {
+            // A widget that is destroyed before the layouts are updated is no longer updated by the gui
+            gui.setDeferredLayoutUpdatesEnabled(true);
+            button1->setSize({60, 20});
+            REQUIRE(button2->getSize() == tgui::Vector2f(100, 20));
+            panel->remove(button2);
+            button2 = nullptr;
+            gui.updateLayouts();
+            REQUIRE(button1->getSize() == tgui::Vector2f(60, 20));
+
+            // A widget that is destroyed by a signal handler while updating an earlier widget is skipped as well
+            button1->setSize({"50%", 20});
+            auto button3 = tgui::Button::create();
+            button3->setSize({bindWidth(button1), 20});
+            panel->add(button3, "Button3");
+            REQUIRE(button3->getSize() == tgui::Vector2f(50, 20));
+
+            button1->onSizeChange([&]{
+                if (button3)
+                {
+                    panel->remove(button3);
+                    button3 = nullptr;
+                }
+            });
+
+            panel->setSize({300, 100});
+            gui.updateLayouts();
+            REQUIRE(button1->getSize() == tgui::Vector2f(150, 20));
+            REQUIRE(button3 == nullptr);
+            REQUIRE(panel->getWidgets().size() == 1);
+        }
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
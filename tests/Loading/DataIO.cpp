@@ -228,6 +228,126 @@ TEST_CASE("[DataIO]")
         }
     }
 
+    SECTION("parse from memory")
+    {
+        const std::string input = "Widget.\"Caf\xC3\xA9\" {\n"
+                                  "    Text = \"Na\xC3\xAFve\";\n"
+                                  "    Value =   1\t\n  2 /* comment */3// comment\n;\n"
+                                  "    List = [ a , \"b, c\" ];\n"
+                                  "    Nested/**/Name { Property = Value; }\n"
+                                  "}";
+
+        std::unique_ptr<tgui::DataIO::Node> rootNode;
+        REQUIRE_NOTHROW(rootNode = tgui::DataIO::parse(tgui::CharStringView{input}));
+        REQUIRE(rootNode->children.size() == 1);
+
+        const auto& node = rootNode->children[0];
+        REQUIRE(node->name == U"Widget.\"Caf\u00E9\"");
+        REQUIRE(node->propertyValuePairs.size() == 3);
+        REQUIRE(node->propertyValuePairs["Text"]->value == U"\"Na\u00EFve\"");
+        REQUIRE(node->propertyValuePairs["Value"]->value == "1 2 3");
+        REQUIRE(node->propertyValuePairs["List"]->listNode);
+        REQUIRE(node->propertyValuePairs["List"]->valueList.size() == 2);
+        REQUIRE(node->propertyValuePairs["List"]->valueList[0] == "a");
+        REQUIRE(node->propertyValuePairs["List"]->valueList[1] == "\"b, c\"");
+        REQUIRE(node->children.size() == 1);
+        REQUIRE(node->children[0]->name == "NestedName");
+        REQUIRE(node->children[0]->propertyValuePairs["Property"]->value == "Value");
+
+        std::stringstream emitted;
+        tgui::DataIO::emit(rootNode, emitted);
+        REQUIRE(emitted.str() == "Widget.\"Caf\xC3\xA9\" {\n"
+                                 "    List = [ a , \"b, c\"];\n"
+                                 "    Text = \"Na\xC3\xAFve\";\n"
+                                 "    Value = 1 2 3;\n"
+                                 "\n"
+                                 "    NestedName {\n"
+                                 "        Property = Value;\n"
+                                 "    }\n"
+                                 "}\n");
+
+        REQUIRE_THROWS_WITH(tgui::DataIO::parse(tgui::CharStringView{"A {\n    B = 1;\n    C = ;\n}"}),
+                            "Error while parsing input at line 3. Found empty value.");
+    }
+
+    SECTION("binary format")
+    {
+        std::stringstream input{"Widget.\"Caf\xC3\xA9\" {\n"
+                                "    Text = \"Na\xC3\xAFve\";\n"
+                                "    List = [ a , \"b, c\" ];\n"
+                                "    Nested { Property = Value; }\n"
+                                "}\n"
+                                "Widget.Other : Widget.\"Caf\xC3\xA9\" { Extra = Value; }"};
+        const auto rootNode = tgui::DataIO::parse(input);
+
+        std::stringstream binaryStream;
+        tgui::DataIO::emitBinary(rootNode, binaryStream);
+        const std::string binary = binaryStream.str();
+        REQUIRE(tgui::DataIO::isBinary(tgui::CharStringView{binary}));
+        REQUIRE(!tgui::DataIO::isBinary(tgui::CharStringView{input.str()}));
+
+        // The parse function detects the binary format automatically
+        std::unique_ptr<tgui::DataIO::Node> loadedRootNode;
+        REQUIRE_NOTHROW(loadedRootNode = tgui::DataIO::parse(tgui::CharStringView{binary}));
+        REQUIRE(loadedRootNode->children.size() == 2);
+        REQUIRE(loadedRootNode->children[1]->parent == loadedRootNode.get());
+        REQUIRE(loadedRootNode->children[0]->children[0]->parent == loadedRootNode->children[0].get());
+        REQUIRE(loadedRootNode->children[0]->propertyValuePairs["List"]->listNode);
+        REQUIRE(loadedRootNode->children[0]->propertyValuePairs["List"]->valueList.size() == 2);
+        REQUIRE(loadedRootNode->children[0]->propertyValuePairs["List"]->valueList[1] == "\"b, c\"");
+        REQUIRE(loadedRootNode->children[1]->propertyValuePairs.size() == 3);
+
+        std::stringstream emittedOriginal;
+        std::stringstream emittedLoaded;
+        tgui::DataIO::emit(rootNode, emittedOriginal);
+        tgui::DataIO::emit(loadedRootNode, emittedLoaded);
+        REQUIRE(emittedOriginal.str() == emittedLoaded.str());
+
+        REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(tgui::CharStringView{binary.data(), binary.size() - 1}), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(tgui::CharStringView{input.str()}), tgui::Exception);
+
+        // Deeply nested sections are rejected instead of recursing until the stack overflows
+        const auto emitNestedSections = [](unsigned int depth){
+            auto nestedRootNode = std::make_unique<tgui::DataIO::Node>();
+            tgui::DataIO::Node* node = nestedRootNode.get();
+            for (unsigned int i = 0; i < depth; ++i)
+            {
+                node->children.push_back(std::make_unique<tgui::DataIO::Node>());
+                node->children.back()->parent = node;
+                node->children.back()->name = "Panel";
+                node = node->children.back().get();
+            }
+
+            std::stringstream stream;
+            tgui::DataIO::emitBinary(nestedRootNode, stream);
+            return stream.str();
+        };
+        REQUIRE_NOTHROW((void)tgui::DataIO::parseBinary(tgui::CharStringView{emitNestedSections(200)}));
+        REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(tgui::CharStringView{emitNestedSections(1000)}), tgui::Exception);
+    }
+
+    SECTION("shipped themes and forms")
+    {
+        // The expected files were emitted from the trees that the stream parser created before DataIO parsed from memory
+        for (const char* filename : {"resources/Black.txt", "resources/BabyBlue.txt", "resources/TransparentGrey.txt",
+                                     "resources/ThemeComments.txt", "resources/ThemeNested.txt", "resources/ThemeSpecialCases.txt",
+                                     "resources/forms/EditingScreen.txt", "resources/forms/SetListViewColumns.txt", "resources/forms/SetTexture.txt"})
+        {
+            INFO("Filename: " << filename);
+
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+            REQUIRE(fileContents != nullptr);
+
+            std::stringstream emitted;
+            tgui::DataIO::emit(tgui::DataIO::parse(tgui::CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize}), emitted);
+
+            const tgui::String emittedFilename = "DataIO_" + tgui::Filesystem::Path(filename).getFilename();
+            REQUIRE(tgui::writeFile(emittedFilename, emitted));
+            REQUIRE(compareFiles(emittedFilename, "expected/" + emittedFilename));
+        }
+    }
+
     SECTION("correct input")
     {
         std::stringstream stream;
@@ -0,0 +1,69 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2024 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+
+#if !TGUI_BUILD_AS_CXX_MODULE
+    #include <TGUI/Loading/ImageLoader.hpp>
+#endif
+
+TEST_CASE("[ImageLoader]")
+{
+    SECTION("loadFromFile")
+    {
+        for (const tgui::String filename : {"resources/image.png", "resources/image.jpg", "resources/image.bmp"})
+        {
+            tgui::Vector2u imageSize;
+            const auto pixels = tgui::ImageLoader::loadFromFile(filename, imageSize);
+            REQUIRE(pixels != nullptr);
+            REQUIRE(imageSize == tgui::Vector2u{50, 50});
+
+            // Loading the mapped file has to give the same pixels as decoding a copy of the file in memory
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+            REQUIRE(fileContents != nullptr);
+
+            tgui::Vector2u imageSizeFromMemory;
+            const auto pixelsFromMemory = tgui::ImageLoader::loadFromMemory(fileContents.get(), fileSize, imageSizeFromMemory);
+            REQUIRE(pixelsFromMemory != nullptr);
+            REQUIRE(imageSizeFromMemory == imageSize);
+            REQUIRE(std::memcmp(pixels.get(), pixelsFromMemory.get(), 4 * imageSize.x * imageSize.y) == 0);
+        }
+    }
+
+    SECTION("Invalid files")
+    {
+        tgui::Vector2u imageSize;
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources/NonExistent.png", imageSize) == nullptr);
+
+        // Directories can be opened but not mapped, they end up in the fallback code that reads the file normally
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources", imageSize) == nullptr);
+
+        // A file that exists but isn't an image
+        REQUIRE(tgui::ImageLoader::loadFromFile("resources/Black.txt", imageSize) == nullptr);
+
+        const std::uint8_t data[] = {1, 2, 3, 4};
+        REQUIRE(tgui::ImageLoader::loadFromMemory(data, sizeof(data), imageSize) == nullptr);
+    }
+}
@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 
+#include <thread>
+
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/SvgImage.hpp>
 #endif
@@ -54,6 +56,40 @@ TEST_CASE("[SvgImage]")
         REQUIRE(tgui::Vector2u{texture->getSize()} == tgui::Vector2u{100, 100});
     }
 
+    SECTION("Cached textures")
+    {
+        tgui::SvgImage svgImage{"resources/SFML.svg"};
+
+        auto texture1 = svgImage.getTexture({100, 100});
+        REQUIRE(tgui::Vector2u{texture1->getSize()} == tgui::Vector2u{100, 100});
+        REQUIRE(svgImage.getTexture({100, 100}) == texture1);
+
+        // Other sizes are rasterized in the background while the current texture remains in use
+        REQUIRE(svgImage.getTexture({50, 40}, texture1) == texture1);
+        REQUIRE(svgImage.getTexture({60, 40}, texture1) == texture1);
+        REQUIRE(tgui::SvgImage::getPendingRasterizationCount() >= 1);
+
+        while (tgui::SvgImage::getPendingRasterizationCount() > 0)
+            (void)tgui::Timer::updateTime(std::chrono::milliseconds(10));
+
+        auto texture2 = svgImage.getTexture({60, 40}, texture1);
+        REQUIRE(texture2 != texture1);
+        REQUIRE(tgui::Vector2u{texture2->getSize()} == tgui::Vector2u{60, 40});
+
+        // Rasterization still finishes when the timers were cleared while a request was pending (e.g. because the backend was reset)
+        REQUIRE(svgImage.getTexture({70, 40}, texture1) == texture1);
+        tgui::Timer::clearTimers();
+        REQUIRE(svgImage.getTexture({80, 40}, texture1) == texture1);
+        for (unsigned int i = 0; (i < 5000) && (tgui::SvgImage::getPendingRasterizationCount() > 0); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            (void)tgui::Timer::updateTime(std::chrono::milliseconds(10));
+        }
+
+        REQUIRE(tgui::SvgImage::getPendingRasterizationCount() == 0);
+        REQUIRE(svgImage.getTexture({80, 40}, texture1) != texture1);
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
@@ -74,6 +110,10 @@ TEST_CASE("[SvgImage]")
             picture->setPosition(40, 10);
             picture->setSize(80, 80);
 
+            // The new size is rasterized in the background
+            while (tgui::SvgImage::getPendingRasterizationCount() > 0)
+                (void)tgui::Timer::updateTime(std::chrono::milliseconds(10));
+
             TEST_DRAW("Svg_TransformedAndColored.png")
         }
     }
@@ -138,4 +138,36 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Word-wrap")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        REQUIRE(tgui::Text::wordWrap(0, "Hello world", font, 20, false) == "Hello world");
+
+        const float wordWidth = tgui::Text::getLineWidth("Hello", font, 20);
+        REQUIRE(tgui::Text::wordWrap(wordWidth + 1, "Hello you\nHi", font, 20, false) == "Hello \nyou\nHi");
+
+        // The same measurements can be reused to word-wrap the text with different widths
+        const tgui::String str = "Some longer text\twith tabs,\r\nnewlines\n\nand averyveryverylongwordthatneedstobesplit";
+        const auto characterWidths = tgui::Text::measureCharacters(str, font, 20, false);
+        REQUIRE(characterWidths.advances.size() == str.length());
+        REQUIRE(characterWidths.kernings.size() == str.length());
+        for (float maxWidth = 20; maxWidth < 500; maxWidth += 20)
+            REQUIRE(tgui::Text::wordWrap(maxWidth, str, characterWidths) == tgui::Text::wordWrap(maxWidth, str, font, 20, false));
+    }
+
+    SECTION("Line widths")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        const std::vector<tgui::String> texts = {"", "Hello world", "AVAVA\tWo", U"Caf\u00E9 \u03A9mega", "First\r\nSecond"};
+
+        const std::vector<float> widths = tgui::Text::getLineWidths(texts, font, 20, tgui::TextStyle::Bold);
+        REQUIRE(widths.size() == texts.size());
+        for (std::size_t i = 0; i < texts.size(); ++i)
+            REQUIRE(widths[i] == tgui::Text::getLineWidth(texts[i], font, 20, tgui::TextStyle::Bold));
+
+        REQUIRE(widths[0] == 0);
+        REQUIRE(widths[4] == tgui::Text::getLineWidth("First", font, 20, tgui::TextStyle::Bold));
+        REQUIRE(tgui::Text::getLineWidths(texts, nullptr, 20) == std::vector<float>(texts.size(), 0.f));
+    }
 }
@@ -29,6 +29,8 @@
 
 #include "Tests.hpp"
 
+#include <thread>
+
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/TextureManager.hpp>
 #endif
@@ -118,6 +120,62 @@ TEST_CASE("[Texture]")
                 REQUIRE(texture.getMiddleRect() == tgui::UIntRect(6, 5, 28, 20));
                 REQUIRE(texture.isSmooth() == true);
             }
+
+            SECTION("loadAsync")
+            {
+                std::vector<tgui::Texture> loadedTextures;
+                const auto onLoaded = [&](const tgui::Texture& texture){ loadedTextures.push_back(texture); };
+
+                // Requests for the same file are combined
+                tgui::Texture::loadAsync("resources/image.png", onLoaded, {10, 5, 40, 30});
+                tgui::Texture::loadAsync("resources/image.png", onLoaded);
+                tgui::Texture::loadAsync("NonExistent.png", onLoaded);
+                REQUIRE(loadedTextures.empty());
+                REQUIRE(tgui::TextureManager::getAsyncLoadingCount() == 2);
+
+                // The textures are created on the gui thread once the images are decoded
+                for (unsigned int i = 0; (i < 5000) && (tgui::TextureManager::getAsyncLoadingCount() > 0); ++i)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    (void)tgui::Timer::updateTime(std::chrono::milliseconds(10));
+                }
+
+                REQUIRE(tgui::TextureManager::getAsyncLoadingCount() == 0);
+                REQUIRE(loadedTextures.size() == 3);
+                std::vector<tgui::Texture> successfulTextures;
+                for (const auto& texture : loadedTextures)
+                {
+                    if (texture.getData())
+                        successfulTextures.push_back(texture);
+                }
+
+                REQUIRE(successfulTextures.size() == 2);
+                REQUIRE(successfulTextures[0].getData() == successfulTextures[1].getData());
+                REQUIRE(successfulTextures[0].getId() == "resources/image.png");
+                REQUIRE(successfulTextures[0].getPartRect() == tgui::UIntRect(10, 5, 40, 30));
+                REQUIRE(successfulTextures[1].getPartRect() == tgui::UIntRect(0, 0, 50, 50));
+                REQUIRE(successfulTextures[1].getData()->backendTexture->getSize() == tgui::Vector2u(50, 50));
+
+                // An image that was already loaded is available immediately
+                bool textureReused = false;
+                tgui::Texture::loadAsync("resources/image.png", [&](const tgui::Texture& texture){ textureReused = (texture.getData() == successfulTextures[0].getData()); });
+                REQUIRE(textureReused);
+
+                // Loading still finishes when the timers were cleared while a request was pending (e.g. because the backend was reset)
+                unsigned int failedLoadCount = 0;
+                const auto onFailedLoad = [&](const tgui::Texture& texture){ if (!texture.getData()) ++failedLoadCount; };
+                tgui::Texture::loadAsync("NonExistent1.png", onFailedLoad);
+                tgui::Timer::clearTimers();
+                tgui::Texture::loadAsync("NonExistent2.png", onFailedLoad);
+                for (unsigned int i = 0; (i < 5000) && (tgui::TextureManager::getAsyncLoadingCount() > 0); ++i)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    (void)tgui::Timer::updateTime(std::chrono::milliseconds(10));
+                }
+
+                REQUIRE(tgui::TextureManager::getAsyncLoadingCount() == 0);
+                REQUIRE(failedLoadCount == 2);
+            }
         }
 
         SECTION("loadFromBase64")
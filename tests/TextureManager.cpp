@@ -56,4 +56,62 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    SECTION("Atlas")
+    {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+        REQUIRE(tgui::TextureManager::getAtlasMaximumImageSize() == 128);
+
+        {
+            tgui::Texture texture1{"resources/TransparentParts.png"};
+            tgui::Texture texture2{"resources/CheckBox1.png", {}, {}, true};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+
+            // Both images are stored in the same texture
+            REQUIRE(texture1.getData()->atlasRect);
+            REQUIRE(texture2.getData()->atlasRect);
+            REQUIRE(texture1.getData()->backendTexture == texture2.getData()->backendTexture);
+            REQUIRE(texture1.getData()->atlasRect->getSize() == tgui::Vector2u{50, 50});
+            REQUIRE(texture2.getData()->atlasRect->getSize() == tgui::Vector2u{64, 32});
+            REQUIRE(texture1.getImageSize() == tgui::Vector2u{50, 50});
+            REQUIRE(texture1.getPartRect() == tgui::UIntRect{0, 0, 50, 50});
+
+            // Sprites only use the part of the atlas that contains their image
+            tgui::Sprite sprite{texture2};
+            const tgui::Vector2f atlasSize{texture2.getData()->backendTexture->getSize()};
+            const tgui::UIntRect atlasRect = *texture2.getData()->atlasRect;
+            for (const auto& vertex : sprite.getVertices())
+            {
+                REQUIRE(vertex.texCoords.x * atlasSize.x >= atlasRect.left);
+                REQUIRE(vertex.texCoords.y * atlasSize.y >= atlasRect.top);
+                REQUIRE(vertex.texCoords.x * atlasSize.x <= atlasRect.left + atlasRect.width);
+                REQUIRE(vertex.texCoords.y * atlasSize.y <= atlasRect.top + atlasRect.height);
+            }
+
+            // Pixels are checked in the correct part of the atlas
+            tgui::TextureManager::setAtlasEnabled(false);
+            tgui::Texture separateTexture{"resources/TransparentParts.png", {}, {}, false};
+            REQUIRE(!separateTexture.getData()->atlasRect);
+            for (unsigned int y = 0; y < 50; ++y)
+            {
+                for (unsigned int x = 0; x < 50; ++x)
+                    REQUIRE(texture1.isTransparentPixel({x, y}) == separateTexture.isTransparentPixel({x, y}));
+            }
+
+            // Images that are too large get their own texture
+            tgui::TextureManager::setAtlasEnabled(true);
+            tgui::TextureManager::setAtlasMaximumImageSize(40);
+            tgui::Texture texture3{"resources/Texture1.png"};
+            REQUIRE(!texture3.getData()->atlasRect);
+            REQUIRE(texture3.getData()->backendTexture->getSize() == tgui::Vector2u{50, 50});
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            tgui::TextureManager::setAtlasMaximumImageSize(128);
+        }
+
+        // The atlas page is released when none of its images are used anymore
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+        tgui::TextureManager::setAtlasEnabled(false);
+    }
 }
@@ -521,6 +521,49 @@ TEST_CASE("[Widget]")
             REQUIRE(renderer->getProperty("NonexistentProperty").getType() == tgui::ObjectConverter::Type::None);
         }
 
+        SECTION("Property ids")
+        {
+            REQUIRE(tgui::RendererPropertyId{tgui::String("Opacity")} == TGUI_RENDERER_PROPERTY_ID("Opacity"));
+            REQUIRE(tgui::RendererPropertyId{U"Opacity"} != TGUI_RENDERER_PROPERTY_ID("OpacityDisabled"));
+
+            renderer->setOpacity(0.5f);
+            REQUIRE(renderer->getProperty(TGUI_RENDERER_PROPERTY_ID("Opacity")).getNumber() == 0.5f);
+            REQUIRE(renderer->getProperty(TGUI_RENDERER_PROPERTY_ID("NonexistentProperty")).getType() == tgui::ObjectConverter::Type::None);
+
+            auto& pairs = renderer->getData()->propertyValuePairs;
+            pairs["ZCustom"] = {1};
+            pairs["ACustom"] = {2};
+            REQUIRE(pairs.find(TGUI_RENDERER_PROPERTY_ID("ACustom"))->second.getNumber() == 2);
+            REQUIRE(pairs.find("ZCustom")->second.getNumber() == 1);
+
+            // Properties are still iterated in alphabetical order
+            REQUIRE(pairs.begin()->first == "ACustom");
+            REQUIRE(std::prev(pairs.end())->first == "ZCustom");
+
+            // Lookups keep working on copies and after properties are removed
+            tgui::RendererPropertyMap copiedPairs = pairs;
+            pairs.erase("ACustom");
+            REQUIRE(pairs.find(TGUI_RENDERER_PROPERTY_ID("ACustom")) == pairs.end());
+            REQUIRE(pairs.find(TGUI_RENDERER_PROPERTY_ID("ZCustom"))->second.getNumber() == 1);
+            REQUIRE(copiedPairs.find(TGUI_RENDERER_PROPERTY_ID("ACustom"))->second.getNumber() == 2);
+            REQUIRE(copiedPairs.size() == pairs.size() + 1);
+
+            // The std::map functions that were available before the properties had ids can still be used
+            REQUIRE(pairs.count("ZCustom") == 1);
+            REQUIRE(pairs.count("ACustom") == 0);
+            REQUIRE(pairs.at("ZCustom").getNumber() == 1);
+            REQUIRE_THROWS_AS(pairs.at("ACustom"), std::out_of_range);
+            REQUIRE(pairs.insert({"ACustom", {3}}).second);
+            REQUIRE(!pairs.insert({"ACustom", {4}}).second);
+            REQUIRE(pairs.emplace("BCustom", 5).second);
+            REQUIRE(pairs.find(TGUI_RENDERER_PROPERTY_ID("ACustom"))->second.getNumber() == 3);
+            REQUIRE(pairs.find(TGUI_RENDERER_PROPERTY_ID("BCustom"))->second.getNumber() == 5);
+
+            const std::map<tgui::String, tgui::ObjectConverter>& pairsMap = pairs;
+            REQUIRE(pairsMap.size() == pairs.size());
+            REQUIRE(pairsMap.begin()->first == "ACustom");
+        }
+
         SECTION("Clone")
         {
             renderer->setOpacity(0.5f);
@@ -76,6 +76,111 @@ static void testCanvasCommon(tgui::CanvasBase::Ptr canvas)
     }
 }
 
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3 || TGUI_HAS_RENDERER_BACKEND_GLES2
+// Custom widget that submits the batch in the middle of the frame, like it would do before making its own OpenGL calls
+template <typename RenderTargetType>
+class BatchFlushingWidget : public tgui::ClickableWidget
+{
+public:
+    mutable unsigned int flushCount = 0;
+
+    void draw(tgui::BackendRenderTarget& target, tgui::RenderStates states) const override
+    {
+        target.drawFilledRect(states, getSize(), tgui::Color::Red);
+        static_cast<RenderTargetType&>(target).flushBatch();
+        ++flushCount;
+        target.drawFilledRect(states, getSize(), tgui::Color::Green);
+    }
+};
+
+template <typename RenderTargetType>
+static void testDrawCallBatching()
+{
+    SECTION("Draw call batching")
+    {
+        auto picture = tgui::Picture::create("resources/Texture1.png");
+        picture->setSize({20, 20});
+        TEST_DRAW_INIT(100, 100, picture)
+
+        // Other tests may have changed the view of the gui, which would cause some widgets to not be drawn
+        gui.setAbsoluteView({0, 0, 100, 100});
+        gui.setRelativeViewport({0, 0, 1, 1});
+
+        auto renderTarget = std::static_pointer_cast<RenderTargetType>(gui.getBackendRenderTarget());
+        const bool oldBatchingEnabled = renderTarget->isBatchingEnabled();
+
+        SECTION("Draw call count")
+        {
+            // Pictures and labels alternate, so consecutive primitives never share the same texture
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                auto label = tgui::Label::create("A");
+                label->setPosition({50, i * 25.f});
+                gui.add(label);
+
+                if (i < 3)
+                {
+                    auto picture2 = tgui::Picture::copy(picture);
+                    picture2->setPosition({0, (i + 1) * 25.f});
+                    gui.add(picture2);
+                }
+            }
+
+            // Each primitive is drawn separately when its texture differs from the previous one
+            renderTarget->setBatchingEnabled(false);
+            gui.draw();
+            REQUIRE(renderTarget->getDrawCallCount() == 8);
+
+            renderTarget->setBatchingEnabled(true);
+            gui.draw();
+            REQUIRE(renderTarget->getDrawCallCount() == 8);
+
+            // The primitives don't overlap, so reordering groups them into one draw call per texture
+            gui.setDrawCallReorderingEnabled(true);
+            gui.draw();
+            REQUIRE(renderTarget->getDrawCallCount() == 2);
+            gui.setDrawCallReorderingEnabled(false);
+        }
+
+        SECTION("flushBatch while reordering draw calls")
+        {
+            picture->setSize({40, 40});
+
+            // More primitives are recorded before the flush than after it
+            for (unsigned int i = 0; i < 10; ++i)
+                gui.add(tgui::Label::create("Text"));
+
+            auto widget = std::make_shared<BatchFlushingWidget<RenderTargetType>>();
+            widget->setPosition({30, 30});
+            widget->setSize({40, 40});
+            gui.add(widget);
+
+            auto picture2 = tgui::Picture::copy(picture);
+            picture2->setPosition({60, 60});
+            gui.add(picture2);
+
+            renderTarget->setBatchingEnabled(false);
+            gui.setDrawCallReorderingEnabled(false);
+            gui.draw();
+            REQUIRE(widget->flushCount == 1);
+            REQUIRE(renderTarget->getDrawCallCount() == 14);
+
+            gui.setDrawCallReorderingEnabled(true);
+            gui.draw();
+            gui.draw();
+            gui.setDrawCallReorderingEnabled(false);
+
+            REQUIRE(widget->flushCount == 3);
+            REQUIRE(renderTarget->getDrawCallCount() == 5);
+        }
+
+        renderTarget->setBatchingEnabled(oldBatchingEnabled);
+        gui.setRelativeView({0, 0, 1, 1});
+        gui.removeAllWidgets();
+    }
+}
+#endif
+
 #if TGUI_HAS_RENDERER_BACKEND_SFML_GRAPHICS
 
 #if !TGUI_BUILD_AS_CXX_MODULE
@@ -258,6 +363,7 @@ TEST_CASE("[CanvasSDL]")
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/Backend/Renderer/OpenGL3/CanvasOpenGL3.hpp>
     #include <TGUI/Backend/Renderer/OpenGL3/BackendRendererOpenGL3.hpp>
+    #include <TGUI/Backend/Renderer/OpenGL3/BackendRenderTargetOpenGL3.hpp>
 #endif
 
 TEST_CASE("[CanvasOpenGL3]")
@@ -288,6 +394,8 @@ TEST_CASE("[CanvasOpenGL3]")
 
             testSavingWidget("CanvasOpenGL3", canvas, false);
         }
+
+        testDrawCallBatching<tgui::BackendRenderTargetOpenGL3>();
     }
 }
 #endif
@@ -297,6 +405,7 @@ TEST_CASE("[CanvasOpenGL3]")
 #if !TGUI_BUILD_AS_CXX_MODULE
     #include <TGUI/Backend/Renderer/GLES2/CanvasGLES2.hpp>
     #include <TGUI/Backend/Renderer/GLES2/BackendRendererGLES2.hpp>
+    #include <TGUI/Backend/Renderer/GLES2/BackendRenderTargetGLES2.hpp>
 #endif
 
 TEST_CASE("[CanvasGLES2]")
@@ -327,6 +436,8 @@ TEST_CASE("[CanvasGLES2]")
 
             testSavingWidget("CanvasGLES2", canvas, false);
         }
+
+        testDrawCallBatching<tgui::BackendRenderTargetGLES2>();
     }
 }
 #endif
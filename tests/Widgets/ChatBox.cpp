@@ -24,6 +24,20 @@
 
 #include "Tests.hpp"
 
+namespace
+{
+    class ChatBoxWithLineAccess : public tgui::ChatBox
+    {
+    public:
+        using tgui::ChatBox::updateTime;
+
+        std::size_t getWrappedLineCount() const
+        {
+            return static_cast<std::size_t>(std::count_if(m_lines.begin(), m_lines.end(), [](const Line& line){ return line.wrapped; }));
+        }
+    };
+}
+
 TEST_CASE("[ChatBox]")
 {
     tgui::ChatBox::Ptr chatBox = tgui::ChatBox::create();
@@ -72,6 +86,88 @@ TEST_CASE("[ChatBox]")
         REQUIRE(chatBox->getLineTextStyle(2) == tgui::TextStyle::Italic);
     }
 
+    SECTION("Adding multiple lines")
+    {
+        chatBox->setSize(150, 100);
+        chatBox->addLines({"Line 1", "Line 2"});
+        chatBox->addLines({"Line 3"}, tgui::Color::Blue, tgui::TextStyle::Italic);
+        chatBox->addLines({});
+        REQUIRE(chatBox->getLineAmount() == 3);
+        REQUIRE(chatBox->getLine(0) == "Line 1");
+        REQUIRE(chatBox->getLine(1) == "Line 2");
+        REQUIRE(chatBox->getLine(2) == "Line 3");
+        REQUIRE(chatBox->getLineColor(2) == tgui::Color::Blue);
+        REQUIRE(chatBox->getLineTextStyle(2) == tgui::TextStyle::Italic);
+
+        // Lines that don't fit within the line limit aren't added
+        chatBox->setLineLimit(4);
+        chatBox->addLines({"Line 4", "Line 5", "Line 6", "Line 7", "Line 8", "Line 9"});
+        REQUIRE(chatBox->getLineAmount() == 4);
+        REQUIRE(chatBox->getLine(0) == "Line 6");
+        REQUIRE(chatBox->getLine(3) == "Line 9");
+
+        chatBox->setNewLinesBelowOthers(false);
+        chatBox->addLines({"Line 10", "Line 11"});
+        REQUIRE(chatBox->getLineAmount() == 4);
+        REQUIRE(chatBox->getLine(0) == "Line 11");
+        REQUIRE(chatBox->getLine(1) == "Line 10");
+        REQUIRE(chatBox->getLine(2) == "Line 6");
+        REQUIRE(chatBox->getLine(3) == "Line 7");
+
+        // The result is the same as when adding the lines one by one, including word-wrapping of long lines
+        const std::vector<tgui::String> longLines = {"A line that is long enough to be split over multiple lines", "Short", "Another long line that needs word-wrapping"};
+        auto chatBox2 = tgui::ChatBox::copy(chatBox);
+        chatBox->addLines(longLines);
+        for (const auto& line : longLines)
+            chatBox2->addLine(line);
+
+        // Lines are word-wrapped at the end of the frame
+        std::static_pointer_cast<tgui::Widget>(chatBox)->updateTime({});
+        std::static_pointer_cast<tgui::Widget>(chatBox2)->updateTime({});
+        REQUIRE(chatBox->getScrollbar()->getMaximum() == chatBox2->getScrollbar()->getMaximum());
+        REQUIRE(chatBox->getScrollbar()->getMaximum() > 6 * tgui::Text::getLineHeight(chatBox->getSharedRenderer()->getFont(), chatBox->getTextSize()));
+
+        chatBox->setSize(300, 100);
+        chatBox2->setSize(300, 100);
+        std::static_pointer_cast<tgui::Widget>(chatBox)->updateTime({});
+        std::static_pointer_cast<tgui::Widget>(chatBox2)->updateTime({});
+        REQUIRE(chatBox->getScrollbar()->getMaximum() == chatBox2->getScrollbar()->getMaximum());
+    }
+
+    SECTION("Only visible lines are word-wrapped")
+    {
+        auto lazyChatBox = std::make_shared<ChatBoxWithLineAccess>();
+        lazyChatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        lazyChatBox->setSize(150, 100);
+
+        const std::vector<tgui::String> lines(1000, "A line that is long enough to be split over multiple lines");
+        lazyChatBox->addLines(lines);
+        REQUIRE(lazyChatBox->getWrappedLineCount() == 0);
+
+        // The chat box scrolls to the newest lines, only the lines that are shown get wrapped
+        lazyChatBox->updateTime({});
+        const std::size_t visibleLineCount = lazyChatBox->getWrappedLineCount();
+        REQUIRE(visibleLineCount > 0);
+        REQUIRE(visibleLineCount < 10);
+        REQUIRE(lazyChatBox->getScrollbar()->getValue() == lazyChatBox->getScrollbar()->getMaxValue());
+
+        // Changing the width several times only lays out the lines once, at the end of the frame
+        lazyChatBox->setSize(130, 100);
+        lazyChatBox->setSize(110, 100);
+        REQUIRE(lazyChatBox->getWrappedLineCount() == visibleLineCount);
+        lazyChatBox->updateTime({});
+        REQUIRE(lazyChatBox->getWrappedLineCount() > 0);
+        REQUIRE(lazyChatBox->getWrappedLineCount() <= visibleLineCount);
+        REQUIRE(lazyChatBox->getScrollbar()->getValue() == lazyChatBox->getScrollbar()->getMaxValue());
+
+        // Lines are wrapped when scrolling to them
+        const std::size_t wrappedLineCount = lazyChatBox->getWrappedLineCount();
+        lazyChatBox->getScrollbar()->setValue(0);
+        lazyChatBox->updateTime({});
+        REQUIRE(lazyChatBox->getWrappedLineCount() > wrappedLineCount);
+        REQUIRE(lazyChatBox->getWrappedLineCount() < 2 * visibleLineCount);
+    }
+
     SECTION("Removing lines")
     {
         REQUIRE(!chatBox->removeLine(0));
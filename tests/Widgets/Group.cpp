@@ -120,6 +120,19 @@ TEST_CASE("[Group]")
             REQUIRE(compareFiles("GroupWidgetFile1.txt", "GroupWidgetFile2.txt"));
         }
 
+        SECTION("Binary file")
+        {
+            REQUIRE_NOTHROW(group->saveWidgetsToFile("GroupWidgetFile1.txt"));
+            REQUIRE_NOTHROW(group->saveWidgetsToFile("GroupWidgetFile3.bin", true));
+
+            group->removeAllWidgets();
+            REQUIRE_NOTHROW(group->loadWidgetsFromFile("GroupWidgetFile3.bin"));
+            REQUIRE(group->getWidgets().size() == 1);
+
+            REQUIRE_NOTHROW(group->saveWidgetsToFile("GroupWidgetFile2.txt"));
+            REQUIRE(compareFiles("GroupWidgetFile1.txt", "GroupWidgetFile2.txt"));
+        }
+
         SECTION("Save entire group")
         {
             testSavingWidget("Group", group, false);
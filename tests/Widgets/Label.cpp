@@ -123,6 +123,33 @@ TEST_CASE("[Label]")
         REQUIRE(label->getMaximumTextWidth() == 500);
     }
 
+    SECTION("Word-wrap after changing font scale")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        label->getRenderer()->setFont(font);
+        label->setText("Lorem ipsum dolor sit");
+
+        // The text only fits on a single line when the font is scaled
+        font.getBackendFont()->setFontScale(1.3f);
+        const float textOffset = tgui::Text::getExtraHorizontalPadding(font, label->getTextSize());
+        const float maxWidth = tgui::Text::getLineWidth("Lorem ipsum dolor sit", font, label->getTextSize()) + 2*textOffset + 1;
+        font.getBackendFont()->setFontScale(1);
+        REQUIRE(tgui::Text::getLineWidth("Lorem ipsum dolor sit", font, label->getTextSize()) + 2*textOffset > maxWidth);
+
+        label->setMaximumTextWidth(maxWidth);
+        font.getBackendFont()->setFontScale(1.3f);
+        label->setMaximumTextWidth(maxWidth + 1);
+        label->setMaximumTextWidth(maxWidth);
+
+        // The label has to wrap the text with the new character widths instead of reusing the old result
+        auto label2 = tgui::Label::create("Lorem ipsum dolor sit");
+        label2->getRenderer()->setFont(font);
+        label2->setMaximumTextWidth(maxWidth);
+        REQUIRE(label->getSize() == label2->getSize());
+
+        font.getBackendFont()->setFontScale(1);
+    }
+
     SECTION("ScrollbarPolicy")
     {
         REQUIRE(label->getScrollbarPolicy() == tgui::Scrollbar::Policy::Automatic);
@@ -298,6 +298,51 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{ {"1,1", "1,2"}, { "2,1", "2,2" }});
     }
 
+    SECTION("Virtual items")
+    {
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addItem("Item");
+
+        const auto cellProvider = [](std::size_t row, std::size_t column){ return tgui::String(row) + "," + tgui::String(column); };
+        listView->setVirtualItems(1000000, cellProvider);
+        REQUIRE(listView->hasVirtualItems());
+        REQUIRE(listView->getItemCount() == 1000000);
+        REQUIRE(listView->getItem(0) == "0,0");
+        REQUIRE(listView->getItemCell(999999, 1) == "999999,1");
+        REQUIRE(listView->getItemCell(1000000, 1) == "");
+        REQUIRE(listView->getItemRow(5) == std::vector<tgui::String>{"5,0", "5,1"});
+
+        listView->setSelectedItem(999999);
+        REQUIRE(listView->getSelectedItemIndex() == 999999);
+
+        // Selected items that no longer exist are deselected
+        listView->setVirtualItemCount(3);
+        REQUIRE(listView->getItemCount() == 3);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"0,0", "0,1"}, {"1,0", "1,1"}, {"2,0", "2,1"}});
+
+        // Sorting only changes the order in which the rows are requested
+        listView->sort(1, [](const tgui::String& a, const tgui::String& b) { return a > b; });
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"2,0", "1,0", "0,0"});
+
+        listView->setVirtualItemCount(4);
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"2,0", "1,0", "0,0", "3,0"});
+
+        // Each cell in the sorted column is only requested once while sorting
+        unsigned int requestCount = 0;
+        listView->setVirtualItems(100, [&requestCount](std::size_t row, std::size_t){ ++requestCount; return tgui::String(row); });
+        requestCount = 0;
+        listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a.toInt() > b.toInt(); });
+        REQUIRE(requestCount == 100);
+        REQUIRE(listView->getItem(0) == "99");
+        REQUIRE(listView->getItem(99) == "0");
+
+        listView->removeAllItems();
+        REQUIRE(!listView->hasVirtualItems());
+        REQUIRE(listView->getItemCount() == 0);
+    }
+
     SECTION("Selecting items")
     {
         listView->addItem("1,1");
@@ -41,6 +41,16 @@ namespace
 #endif
         return event;
     }
+
+    class TextAreaWithTextAccess : public tgui::TextArea
+    {
+    public:
+        // Only the visible lines are placed in the text object when nothing is selected
+        const tgui::String& getVisibleText() const
+        {
+            return m_textBeforeSelection.getString();
+        }
+    };
 }
 
 TEST_CASE("[TextArea]")
@@ -278,6 +288,48 @@ TEST_CASE("[TextArea]")
         REQUIRE(textArea->getLinesCount() == 4);
     }
 
+    SECTION("Editing wrapped paragraphs")
+    {
+        // Only the changed paragraphs are word-wrapped again, which has to give the same result as wrapping the entire text
+        const auto requireSameLayoutAsNewTextArea = [&textArea]{
+            auto otherTextArea = tgui::TextArea::create();
+            otherTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            otherTextArea->setSize(textArea->getSize());
+            otherTextArea->setTextSize(textArea->getTextSize());
+            otherTextArea->setText(textArea->getText());
+            otherTextArea->setCaretPosition(textArea->getCaretPosition());
+            REQUIRE(otherTextArea->getLinesCount() == textArea->getLinesCount());
+            REQUIRE(otherTextArea->getCaretLine() == textArea->getCaretLine());
+            REQUIRE(otherTextArea->getCaretColumn() == textArea->getCaretColumn());
+        };
+
+        textArea->setSize(150, 300);
+        textArea->setTextSize(16);
+        textArea->setText("A first paragraph that is long enough to wrap\nSecond\n\nThe fourth paragraph also wraps over multiple lines");
+        requireSameLayoutAsNewTextArea();
+
+        textArea->setCaretPosition(10);
+        textArea->textEntered('x');
+        requireSameLayoutAsNewTextArea();
+
+        textArea->textEntered('\n');
+        REQUIRE(textArea->getText() == "A first pax\nragraph that is long enough to wrap\nSecond\n\nThe fourth paragraph also wraps over multiple lines");
+        requireSameLayoutAsNewTextArea();
+
+        textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Backspace, false, false));
+        requireSameLayoutAsNewTextArea();
+
+        textArea->setCaretPosition(46);
+        textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::Delete, false, false));
+        REQUIRE(textArea->getText() == "A first paxragraph that is long enough to wrapSecond\n\nThe fourth paragraph also wraps over multiple lines");
+        requireSameLayoutAsNewTextArea();
+
+        textArea->setSelectedText(27, 58);
+        textArea->textEntered('y');
+        REQUIRE(textArea->getText() == "A first paxragraph that is yfourth paragraph also wraps over multiple lines");
+        requireSameLayoutAsNewTextArea();
+    }
+
     SECTION("TabString")
     {
         REQUIRE(textArea->getTabString() == "\t");
@@ -308,6 +360,27 @@ TEST_CASE("[TextArea]")
         testScrollbarAccess(textArea->getHorizontalScrollbar());
     }
 
+    SECTION("Scrolling from code")
+    {
+        auto scrolledTextArea = std::make_shared<TextAreaWithTextAccess>();
+        scrolledTextArea->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        scrolledTextArea->setSize(200, 100);
+        scrolledTextArea->setTextSize(16);
+
+        tgui::String text;
+        for (unsigned int i = 0; i < 100; ++i)
+            text += "Line " + tgui::String(i) + "\n";
+        scrolledTextArea->setText(text);
+
+        scrolledTextArea->setVerticalScrollbarValue(0);
+        REQUIRE(scrolledTextArea->getVisibleText().starts_with("Line 0\n"));
+        REQUIRE(!scrolledTextArea->getVisibleText().contains("Line 99"));
+
+        scrolledTextArea->getVerticalScrollbar()->setValue(scrolledTextArea->getVerticalScrollbar()->getMaxValue());
+        REQUIRE(!scrolledTextArea->getVisibleText().contains("Line 0\n"));
+        REQUIRE(scrolledTextArea->getVisibleText().contains("Line 99"));
+    }
+
     SECTION("Events / Signals")
     {
         textArea->setSize(165, 100);
@@ -241,6 +241,64 @@ TEST_CASE("[TreeView]")
         REQUIRE(treeView->getNodes()[1].nodes[0].nodes[0].expanded);
     }
 
+    SECTION("Lazy items")
+    {
+        std::vector<std::vector<tgui::String>> requestedHierarchies;
+        treeView->setChildrenProvider([&](const std::vector<tgui::String>& hierarchy){
+            requestedHierarchies.push_back(hierarchy);
+            return std::vector<tgui::TreeView::LazyItem>{{"Folder", true}, {"File", false}};
+        });
+
+        REQUIRE(treeView->addLazyItem({"Root"}));
+        treeView->addItem({"Other"});
+        REQUIRE(!treeView->addLazyItem({"Unexisting", "Lazy"}, false));
+        REQUIRE(treeView->getNodes().size() == 2);
+        REQUIRE(!treeView->getNodes()[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes.empty());
+        REQUIRE(requestedHierarchies.empty());
+
+        // Expanding all items doesn't request children
+        treeView->expandAll();
+        REQUIRE(!treeView->getNodes()[0].expanded);
+        REQUIRE(requestedHierarchies.empty());
+
+        REQUIRE(treeView->selectItem({"Other"}));
+        treeView->expand({"Root"});
+        REQUIRE(requestedHierarchies == std::vector<std::vector<tgui::String>>{{"Root"}});
+        REQUIRE(treeView->getNodes()[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 2);
+        REQUIRE(treeView->getNodes()[0].nodes[0].text == "Folder");
+        REQUIRE(!treeView->getNodes()[0].nodes[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes[1].text == "File");
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Other"});
+
+        // Children are only requested once
+        treeView->collapse({"Root"});
+        treeView->expand({"Root"});
+        REQUIRE(requestedHierarchies.size() == 1);
+
+        REQUIRE(treeView->selectItem({"Root", "Folder"}));
+
+        tgui::Event::KeyEvent event;
+        event.alt = false;
+        event.shift = false;
+        event.control = false;
+        event.system = false;
+        event.code = tgui::Event::KeyboardKey::Right;
+        treeView->keyPressed(event);
+        REQUIRE(requestedHierarchies.size() == 2);
+        REQUIRE(requestedHierarchies[1] == std::vector<tgui::String>{"Root", "Folder"});
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 2);
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Root", "Folder"});
+
+        treeView->keyPressed(event);
+        REQUIRE(treeView->getSelectedItem() == std::vector<tgui::String>{"Root", "Folder", "Folder"});
+
+        // Collapsing a node deselects the visible item inside it
+        treeView->collapse({"Root"});
+        REQUIRE(treeView->getSelectedItem().empty());
+    }
+
     SECTION("Selecting items")
     {
         treeView->addItem({"Smilies", "Neither"});